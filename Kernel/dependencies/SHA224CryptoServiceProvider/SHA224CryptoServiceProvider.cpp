@@ -143,9 +143,11 @@ void SHA224CryptoServiceProvider::ProcessBlock()
 
 void SHA224CryptoServiceProvider::Update(const std::string &data)
 {
-    const auto* buffer = reinterpret_cast<const uint8_t*> (data.c_str());
-    size_t length = data.size();
+    Update(reinterpret_cast<const uint8_t*> (data.c_str()), data.size());
+}
 
+void SHA224CryptoServiceProvider::Update(const uint8_t* buffer, size_t length)
+{
     for (size_t i = 0 ; i < length ; i++)
     {
         words[lengthBlock++] = buffer[i];
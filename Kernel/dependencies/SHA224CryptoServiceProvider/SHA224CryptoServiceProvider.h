@@ -8,6 +8,8 @@ class SHA224CryptoServiceProvider {
 public:
     SHA224CryptoServiceProvider();
     static std::string Hashing(const std::string& inputMessage);
+    void Update(const uint8_t* data, size_t length);
+    std::string FinalProcess();
 private:
     uint8_t  words[64]{};
     uint32_t lengthBlock{};
@@ -42,7 +44,6 @@ private:
     void PadInputMessage();
     void ToBigEndian(uint8_t * hash);
     void Update(const std::string &data);
-    std::string FinalProcess();
     void PadTotalInputMessageLength();
 };
 
@@ -41,6 +41,23 @@ MD5::MD5(const span<const byte>& message) {
   
 }
 
+/**
+ * @Construct an empty MD5 object.
+ *
+ */
+MD5::MD5() : MD5(span<const byte>{}) {
+}
+
+/**
+ * @Process another part of the message.
+ *
+ * @param {message} the next part of the message.
+ *
+ */
+void MD5::update(const span<const byte>& message) {
+  init(message.data(), message.size());
+}
+
 /**
  * @Generate md5 digest.
  *
@@ -94,6 +94,12 @@ public:
   // MD5(const string& message);
   MD5(const span<const byte>& message);
 
+  /* Construct an empty MD5 object, feed it with update. */
+  MD5();
+
+  /* Process another part of the message. */
+  void update(const span<const byte>& message);
+
   /* Generate md5 digest. */
   const byte* getDigest();
 
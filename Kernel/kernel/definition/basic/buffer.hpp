@@ -12,6 +12,35 @@ namespace Sen::Kernel::Definition
     template <typename Type>
     concept IsValidArgument = std::is_same<Type, std::size_t>::value && true;
 
+    // allocator that leaves new elements default-initialized, resize does not zero the memory
+
+    template <typename Type>
+    struct DefaultInitializeAllocator : std::allocator<Type>
+    {
+        template <typename Other>
+        struct rebind
+        {
+            using other = DefaultInitializeAllocator<Other>;
+        };
+
+        using std::allocator<Type>::allocator;
+
+        template <typename Other>
+        inline auto construct(
+            Other *pointer) noexcept(std::is_nothrow_default_constructible_v<Other>) -> void
+        {
+            ::new (static_cast<void *>(pointer)) Other;
+        }
+
+        template <typename Other, typename... Args>
+        inline auto construct(
+            Other *pointer,
+            Args &&...args) -> void
+        {
+            ::new (static_cast<void *>(pointer)) Other(std::forward<Args>(args)...);
+        }
+    };
+
     namespace Buffer
     {
         template <auto use_big_endian>
@@ -23,7 +52,7 @@ namespace Sen::Kernel::Definition
             static_assert(use_big_endian == true or use_big_endian == false);
 
         private:
-            std::vector<std::uint8_t> mutable data;
+            std::vector<std::uint8_t, DefaultInitializeAllocator<std::uint8_t>> mutable data;
 
             std::string_view mutable file_path = ""_sv;
 
@@ -31,6 +60,43 @@ namespace Sen::Kernel::Definition
 
             inline static auto constexpr buffer_size = static_cast<size_t>(8192);
 
+            // write buffer mode: capacity grows geometrically and is not zeroed,
+            // bytes skipped by a write past the end are zeroed when the stream is extended
+
+            bool mutable write_buffer = false;
+
+            inline auto grow(
+                std::size_t new_pos) const -> void
+            {
+                if (thiz.write_buffer)
+                {
+                    thiz.reserve(std::max({new_pos, thiz.capacity() * 2, thiz.buffer_size}));
+                }
+                else
+                {
+                    thiz.reserve(new_pos + thiz.buffer_size);
+                }
+                return;
+            }
+
+            inline auto prepare_write(
+                std::size_t new_pos) const -> void
+            {
+                if (new_pos > thiz.capacity())
+                {
+                    thiz.grow(new_pos);
+                }
+                if (new_pos > thiz.length)
+                {
+                    if (thiz.write_buffer && thiz.write_pos > thiz.length)
+                    {
+                        std::fill(thiz.data.begin() + thiz.length, thiz.data.begin() + thiz.write_pos, std::uint8_t{0});
+                    }
+                    thiz.length = new_pos;
+                }
+                return;
+            }
+
             inline static auto constexpr close_file = [](FILE *file)
             {
                 if (file != nullptr)
@@ -51,7 +117,7 @@ namespace Sen::Kernel::Definition
             }
 
             Stream(
-                const std::vector<std::uint8_t> &data) : data(std::move(data)), read_pos(0), write_pos(data.size()), length(data.size())
+                const std::vector<std::uint8_t> &data) : data(data.begin(), data.end()), read_pos(0), write_pos(data.size()), length(data.size())
             {
                 return;
             }
@@ -78,7 +144,9 @@ namespace Sen::Kernel::Definition
 #else
                 auto size = std::filesystem::file_size(std::filesystem::path{source});
 #endif
-                thiz.reserve(static_cast<std::uint64_t>(size + thiz.buffer_size));
+                // the file content overwrites the buffer, only the slack after it is zeroed
+                thiz.data.resize(static_cast<std::size_t>(size + thiz.buffer_size));
+                std::fill(thiz.data.begin() + size, thiz.data.end(), std::uint8_t{0});
                 thiz.file_path = source;
                 thiz.length = size;
                 thiz.write_pos = size;
@@ -150,7 +218,34 @@ namespace Sen::Kernel::Definition
             inline auto constexpr reserve(
                 const std::size_t &capacity) const -> void
             {
+                auto old_capacity = thiz.data.size();
                 thiz.data.resize(capacity);
+                if (!thiz.write_buffer && capacity > old_capacity)
+                {
+                    std::fill(thiz.data.begin() + old_capacity, thiz.data.end(), std::uint8_t{0});
+                }
+                return;
+            }
+
+            // grow to exactly capacity bytes when the final size is known, no slack is added
+
+            inline auto reserve_exact(
+                const std::size_t &capacity) const -> void
+            {
+                if (capacity > thiz.capacity())
+                {
+                    thiz.data.reserve(capacity);
+                    thiz.reserve(capacity);
+                }
+                return;
+            }
+
+            // switch to write buffer mode, meant for encoders that emit large output
+
+            inline auto use_write_buffer(
+                bool value = true) const -> void
+            {
+                thiz.write_buffer = value;
                 return;
             }
 
@@ -171,6 +266,48 @@ namespace Sen::Kernel::Definition
                 return thiz.toBytes();
             }
 
+            // view of the written bytes, invalidated by any write that grows the stream
+
+            inline auto data_view(
+
+            ) const -> std::span<std::uint8_t const>
+            {
+                return std::span<std::uint8_t const>{thiz.data.data(), thiz.length};
+            }
+
+            // writable view of the written bytes, for in-place transforms that keep the size
+
+            inline auto mutable_view(
+
+            ) const -> std::span<std::uint8_t>
+            {
+                return std::span<std::uint8_t>{thiz.data.data(), thiz.length};
+            }
+
+            // take over a filled buffer without copying it, the stream is rewound
+
+            inline auto adopt(
+                std::vector<std::uint8_t, DefaultInitializeAllocator<std::uint8_t>> &&buffer) const -> void
+            {
+                thiz.data = std::move(buffer);
+                thiz.length = thiz.data.size();
+                thiz.read_pos = 0_size;
+                thiz.write_pos = thiz.length;
+                return;
+            }
+
+            // hand the written bytes to the caller, the stream is left empty
+
+            inline auto release(
+
+            ) const -> std::vector<std::uint8_t, DefaultInitializeAllocator<std::uint8_t>>
+            {
+                thiz.data.resize(thiz.length);
+                auto buffer = std::move(thiz.data);
+                thiz.close();
+                return buffer;
+            }
+
             inline auto get(
                 size_t from,
                 size_t to) const -> std::vector<uint8_t>
@@ -329,21 +466,7 @@ namespace Sen::Kernel::Definition
                 {
                     thiz.write_pos = std::get<0>(std::make_tuple(args...));
                 }
-                auto size = 3;
-                if constexpr (use_big_endian)
-                {
-                    for (auto i : Range(size))
-                    {
-                        thiz.writeUint8((value >> ((size - 1 - i) * 8)) & 0xFF);
-                    }
-                }
-                else
-                {
-                    for (auto i : Range(size))
-                    {
-                        thiz.writeUint8((value >> (i * 8)) & 0xFF);
-                    }
-                }
+                thiz.write_24(value);
                 return;
             }
 
@@ -439,21 +562,7 @@ namespace Sen::Kernel::Definition
                 {
                     thiz.write_pos = std::get<0>(std::make_tuple(args...));
                 }
-                auto size = 3;
-                if constexpr (use_big_endian)
-                {
-                    for (auto i : Range(size))
-                    {
-                        thiz.writeInt8((value >> ((size - 1 - i) * 8)) & 0xFF);
-                    }
-                }
-                else
-                {
-                    for (auto i : Range(size))
-                    {
-                        thiz.writeInt8((value >> (i * 8)) & 0xFF);
-                    }
-                }
+                thiz.write_24(static_cast<std::uint32_t>(value));
                 return;
             }
 
@@ -513,14 +622,7 @@ namespace Sen::Kernel::Definition
                     thiz.write_pos = std::get<0>(std::make_tuple(args...));
                 }
                 auto new_pos = thiz.write_pos + inputBytes.size();
-                if (new_pos > thiz.capacity())
-                {
-                    thiz.reserve(new_pos + thiz.buffer_size);
-                }
-                if (new_pos > thiz.length)
-                {
-                    thiz.length = new_pos;
-                }
+                thiz.prepare_write(new_pos);
                 std::move(inputBytes.begin(), inputBytes.end(), thiz.data.begin() + thiz.write_pos);
                 thiz.write_pos = new_pos;
                 return;
@@ -669,14 +771,7 @@ namespace Sen::Kernel::Definition
                     thiz.write_pos = std::get<0>(std::make_tuple(args...));
                 }
                 auto new_pos = thiz.write_pos + str.size();
-                if (new_pos > thiz.capacity())
-                {
-                    thiz.reserve(new_pos + thiz.buffer_size);
-                }
-                if (new_pos > thiz.length)
-                {
-                    thiz.length = new_pos;
-                }
+                thiz.prepare_write(new_pos);
                 std::copy(str.begin(), str.end(), thiz.data.begin() + thiz.write_pos);
                 thiz.write_pos = new_pos;
                 return;
@@ -693,11 +788,8 @@ namespace Sen::Kernel::Definition
                 {
                     thiz.write_pos = std::get<0>(std::make_tuple(args...));
                 }
-                auto new_pos = thiz.write_pos + str.size() * 4;
-                if (new_pos > thiz.capacity())
-                {
-                    thiz.reserve(new_pos + thiz.buffer_size);
-                }
+                auto new_pos = thiz.write_pos + str.size() * 4 + 4;
+                thiz.prepare_write(new_pos);
                 for (auto &c : str)
                 {
                     thiz.data[thiz.write_pos++] = static_cast<std::uint8_t>(c);
@@ -727,10 +819,11 @@ namespace Sen::Kernel::Definition
                 if (thiz.write_pos >= thiz.length)
                 {
                     auto new_length = thiz.write_pos + size;
-                    if (new_length > thiz.capacity()) {
-                        thiz.reserve(new_length + thiz.buffer_size);
+                    thiz.prepare_write(new_length);
+                    if (thiz.write_buffer)
+                    {
+                        std::fill_n(thiz.data.begin() + thiz.write_pos, size, std::uint8_t{0});
                     }
-                    thiz.length = new_length;
                     thiz.write_pos += size;
                 }
                 else
@@ -961,14 +1054,7 @@ namespace Sen::Kernel::Definition
                 auto size = sizeof(T);
                 auto new_pos = thiz.write_pos + size;
                 // append capacity.
-                if (new_pos > thiz.capacity())
-                {
-                    thiz.reserve(new_pos + thiz.buffer_size);
-                }
-                if (new_pos > thiz.length)
-                {
-                    thiz.length = new_pos;
-                }
+                thiz.prepare_write(new_pos);
                 std::memcpy(&thiz.data[thiz.write_pos], &value, size);
                 thiz.write_pos += size;
                 return;
@@ -982,21 +1068,177 @@ namespace Sen::Kernel::Definition
                 auto size = sizeof(T);
                 auto new_pos = thiz.write_pos + size;
                 // append capacity.
-                if (new_pos > thiz.capacity())
+                thiz.prepare_write(new_pos);
+                for (auto i : Range(size))
                 {
-                    thiz.reserve(new_pos + thiz.buffer_size);
+                    thiz.data[thiz.write_pos++] = ((value >> ((size - 1 - i) * 8)) & 0xFF);
                 }
-                if (new_pos > thiz.length)
+                return;
+            }
+
+            inline auto write_24(
+                std::uint32_t value) const -> void
+            {
+                auto new_pos = thiz.write_pos + 3_size;
+                thiz.prepare_write(new_pos);
+                auto destination = thiz.data.data() + thiz.write_pos;
+                if constexpr (use_big_endian)
                 {
-                    thiz.length = new_pos;
+                    destination[0] = static_cast<std::uint8_t>(value >> 16);
+                    destination[1] = static_cast<std::uint8_t>(value >> 8);
+                    destination[2] = static_cast<std::uint8_t>(value);
                 }
-                for (auto i : Range(size))
+                else
                 {
-                    thiz.data[thiz.write_pos++] = ((value >> ((size - 1 - i) * 8)) & 0xFF);
+                    destination[0] = static_cast<std::uint8_t>(value);
+                    destination[1] = static_cast<std::uint8_t>(value >> 8);
+                    destination[2] = static_cast<std::uint8_t>(value >> 16);
                 }
+                thiz.write_pos = new_pos;
                 return;
             }
 
+            /**
+             * Unchecked writer over a range reserved by write_cursor
+             * The caller must write exactly the reserved size, the pointer is invalidated by any write that grows the stream
+             */
+
+            struct WriteCursor
+            {
+                std::uint8_t *position;
+
+                template <typename T>
+                    requires std::is_integral_v<T> || std::is_floating_point_v<T>
+                inline auto write(
+                    T value) -> void
+                {
+                    if constexpr (use_big_endian && sizeof(T) > 1)
+                    {
+                        value = Stream::reverse_endian(value);
+                    }
+                    std::memcpy(thiz.position, &value, sizeof(T));
+                    thiz.position += sizeof(T);
+                    return;
+                }
+
+                inline auto writeUint8(
+                    std::uint8_t value) -> void
+                {
+                    *thiz.position++ = value;
+                    return;
+                }
+
+                inline auto writeUint16(
+                    std::uint16_t value) -> void
+                {
+                    thiz.write(value);
+                    return;
+                }
+
+                inline auto writeUint24(
+                    std::uint32_t value) -> void
+                {
+                    if constexpr (use_big_endian)
+                    {
+                        thiz.position[0] = static_cast<std::uint8_t>(value >> 16);
+                        thiz.position[1] = static_cast<std::uint8_t>(value >> 8);
+                        thiz.position[2] = static_cast<std::uint8_t>(value);
+                    }
+                    else
+                    {
+                        thiz.position[0] = static_cast<std::uint8_t>(value);
+                        thiz.position[1] = static_cast<std::uint8_t>(value >> 8);
+                        thiz.position[2] = static_cast<std::uint8_t>(value >> 16);
+                    }
+                    thiz.position += 3;
+                    return;
+                }
+
+                inline auto writeUint32(
+                    std::uint32_t value) -> void
+                {
+                    thiz.write(value);
+                    return;
+                }
+
+                inline auto writeUint64(
+                    std::uint64_t value) -> void
+                {
+                    thiz.write(value);
+                    return;
+                }
+
+                inline auto writeInt8(
+                    std::int8_t value) -> void
+                {
+                    thiz.write(value);
+                    return;
+                }
+
+                inline auto writeInt16(
+                    std::int16_t value) -> void
+                {
+                    thiz.write(value);
+                    return;
+                }
+
+                inline auto writeInt32(
+                    std::int32_t value) -> void
+                {
+                    thiz.write(value);
+                    return;
+                }
+
+                inline auto writeInt64(
+                    std::int64_t value) -> void
+                {
+                    thiz.write(value);
+                    return;
+                }
+
+                inline auto writeFloat(
+                    float value) -> void
+                {
+                    thiz.write(value);
+                    return;
+                }
+
+                inline auto writeDouble(
+                    double value) -> void
+                {
+                    thiz.write(value);
+                    return;
+                }
+
+                inline auto writeBytes(
+                    std::span<std::uint8_t const> value) -> void
+                {
+                    std::memcpy(thiz.position, value.data(), value.size());
+                    thiz.position += value.size();
+                    return;
+                }
+
+                inline auto writeNull(
+                    std::size_t size) -> void
+                {
+                    std::memset(thiz.position, 0, size);
+                    thiz.position += size;
+                    return;
+                }
+            };
+
+            // reserve size bytes at write_pos in one capacity check and hand them to an unchecked cursor
+
+            inline auto write_cursor(
+                std::size_t size) const -> WriteCursor
+            {
+                auto new_pos = thiz.write_pos + size;
+                thiz.prepare_write(new_pos);
+                auto cursor = WriteCursor{thiz.data.data() + thiz.write_pos};
+                thiz.write_pos = new_pos;
+                return cursor;
+            }
+
             template <typename T>
                 requires std::is_integral_v<T> || std::is_floating_point_v<T>
             inline auto write_of(
@@ -1318,12 +1560,7 @@ namespace Sen::Kernel::Definition
                                        "readString");
                     thiz.read_pos = view;
                 }
-                auto str = std::string{};
-                for (auto i : Range(size))
-                {
-                    str += static_cast<char>(thiz.readUint8());
-                }
-                return str;
+                return std::string{thiz.read_view(size)};
             }
 
             template <typename... Args>
@@ -1468,28 +1705,159 @@ namespace Sen::Kernel::Definition
                                        "readStringByEmpty");
                     thiz.read_pos = view;
                 }
-                auto ss = std::string{};
-                auto byte = 0;
-                while (true)
+                return std::string{thiz.read_view_by_empty()};
+            }
+
+            inline auto getStringByEmpty(std::size_t pos) const -> std::string
+            {
+                return std::string{thiz.getStringViewByEmpty(pos)};
+            }
+
+            // string_view readers point into the stream, they are invalidated by any write that grows it
+
+            template <typename... Args>
+                requires(IsValidArgument<Args> && ...)
+            inline auto readStringView(
+                std::size_t size,
+                Args... args) const -> std::string_view
+            {
+                static_assert(sizeof...(Args) == 1 || sizeof...(Args) == 0, "Expected 0 or 1 argument only");
+                if constexpr (sizeof...(Args) == 1)
                 {
-                    if ((byte = thiz.readUint8()) == 0)
-                    {
-                        break;
-                    }
-                    ss += (char)byte;
+                    auto view = std::get<0>(std::make_tuple(args...));
+                    assert_conditional(view < this->size(), fmt::format("{}, {}: {}, {}: {}", Language::get("buffer.read_offset_outside_bounds_of_dataview"), Language::get("buffer.new_position"), this->write_pos, Language::get("buffer.actual_size"), this->size()),
+                                       "readStringView");
+                    thiz.read_pos = view;
                 }
-                return ss;
+                return thiz.read_view(size);
             }
 
-            inline auto getStringByEmpty(std::size_t pos) const -> std::string
+            template <typename... Args>
+                requires(IsValidArgument<Args> && ...)
+            inline auto readStringViewByUint8(
+                Args... args) const -> std::string_view
+            {
+                static_assert(sizeof...(Args) == 1 || sizeof...(Args) == 0, "Expected 0 or 1 argument only");
+                if constexpr (sizeof...(Args) == 1)
+                {
+                    auto view = std::get<0>(std::make_tuple(args...));
+                    assert_conditional(view < this->size(), fmt::format("{}, {}: {}, {}: {}", Language::get("buffer.read_offset_outside_bounds_of_dataview"), Language::get("buffer.new_position"), this->write_pos, Language::get("buffer.actual_size"), this->size()),
+                                       "readStringViewByUint8");
+                    thiz.read_pos = view;
+                }
+                return thiz.read_view(thiz.readUint8());
+            }
+
+            template <typename... Args>
+                requires(IsValidArgument<Args> && ...)
+            inline auto readStringViewByUint16(
+                Args... args) const -> std::string_view
+            {
+                static_assert(sizeof...(Args) == 1 || sizeof...(Args) == 0, "Expected 0 or 1 argument only");
+                if constexpr (sizeof...(Args) == 1)
+                {
+                    auto view = std::get<0>(std::make_tuple(args...));
+                    assert_conditional(view < this->size(), fmt::format("{}, {}: {}, {}: {}", Language::get("buffer.read_offset_outside_bounds_of_dataview"), Language::get("buffer.new_position"), this->write_pos, Language::get("buffer.actual_size"), this->size()),
+                                       "readStringViewByUint16");
+                    thiz.read_pos = view;
+                }
+                return thiz.read_view(thiz.readUint16());
+            }
+
+            template <typename... Args>
+                requires(IsValidArgument<Args> && ...)
+            inline auto readStringViewByUint32(
+                Args... args) const -> std::string_view
+            {
+                static_assert(sizeof...(Args) == 1 || sizeof...(Args) == 0, "Expected 0 or 1 argument only");
+                if constexpr (sizeof...(Args) == 1)
+                {
+                    auto view = std::get<0>(std::make_tuple(args...));
+                    assert_conditional(view < this->size(), fmt::format("{}, {}: {}, {}: {}", Language::get("buffer.read_offset_outside_bounds_of_dataview"), Language::get("buffer.new_position"), this->write_pos, Language::get("buffer.actual_size"), this->size()),
+                                       "readStringViewByUint32");
+                    thiz.read_pos = view;
+                }
+                return thiz.read_view(thiz.readUint32());
+            }
+
+            template <typename... Args>
+                requires(IsValidArgument<Args> && ...)
+            inline auto readStringViewByVarInt32(
+                Args... args) const -> std::string_view
+            {
+                static_assert(sizeof...(Args) == 1 || sizeof...(Args) == 0, "Expected 0 or 1 argument only");
+                if constexpr (sizeof...(Args) == 1)
+                {
+                    auto view = std::get<0>(std::make_tuple(args...));
+                    assert_conditional(view < this->size(), fmt::format("{}, {}: {}, {}: {}", Language::get("buffer.read_offset_outside_bounds_of_dataview"), Language::get("buffer.new_position"), this->write_pos, Language::get("buffer.actual_size"), this->size()),
+                                       "readStringViewByVarInt32");
+                    thiz.read_pos = view;
+                }
+                return thiz.read_view(static_cast<std::uint32_t>(thiz.readVarInt32()));
+            }
+
+            template <typename... Args>
+                requires(IsValidArgument<Args> && ...)
+            inline auto readStringViewByEmpty(
+                Args... args) const -> std::string_view
+            {
+                static_assert(sizeof...(Args) == 1 || sizeof...(Args) == 0, "Expected 0 or 1 argument only");
+                if constexpr (sizeof...(Args) == 1)
+                {
+                    auto view = std::get<0>(std::make_tuple(args...));
+                    assert_conditional(view < this->size(), fmt::format("{}, {}: {}, {}: {}", Language::get("buffer.read_offset_outside_bounds_of_dataview"), Language::get("buffer.new_position"), this->write_pos, Language::get("buffer.actual_size"), this->size()),
+                                       "readStringViewByEmpty");
+                    thiz.read_pos = view;
+                }
+                return thiz.read_view_by_empty();
+            }
+
+            inline auto getStringViewByEmpty(std::size_t pos) const -> std::string_view
             {
                 auto thiz_pos = read_pos;
                 read_pos = pos;
-                auto str = readStringByEmpty();
+                auto str = thiz.read_view_by_empty();
                 read_pos = thiz_pos;
                 return str;
             }
 
+            // read count null-terminated strings in a row
+
+            inline auto readStringViewListByEmpty(
+                std::size_t count) const -> std::vector<std::string_view>
+            {
+                auto list = std::vector<std::string_view>{};
+                list.reserve(count);
+                for (auto i : Range(count))
+                {
+                    list.emplace_back(thiz.read_view_by_empty());
+                }
+                return list;
+            }
+
+            // split [from, to) into its null-terminated strings, a trailing string without terminator is kept
+
+            inline auto getStringViewListByEmpty(
+                std::size_t from,
+                std::size_t to) const -> std::vector<std::string_view>
+            {
+                if (from > to || to > thiz.size())
+                {
+                    throw Exception(fmt::format("{} {} {} {}", Language::get("buffer.invalid.size"), from, Language::get("to"), to),
+                                    std::source_location::current(), "getStringViewListByEmpty");
+                }
+                auto list = std::vector<std::string_view>{};
+                auto begin = reinterpret_cast<char const *>(thiz.data.data());
+                while (from < to)
+                {
+                    auto terminator = static_cast<char const *>(std::memchr(begin + from, 0, to - from));
+                    auto end = terminator == nullptr ? to : static_cast<std::size_t>(terminator - begin);
+                    list.emplace_back(begin + from, end - from);
+                    from = end + 1;
+                }
+                return list;
+            }
+
             inline auto getBytes(
                 size_t from,
                 size_t to) const -> std::vector<std::uint8_t>
@@ -1694,6 +2062,37 @@ namespace Sen::Kernel::Definition
                 return value;
             }
 
+            inline auto read_view(
+                std::size_t size) const -> std::string_view
+            {
+                if (thiz.read_pos > thiz.size() || size > thiz.size() - thiz.read_pos)
+                {
+                    throw Exception(fmt::format("{}, {}: thiz.read_pos + size <= thiz.size(), {}: {} + {} <= {}", Language::get("offset_outside_bounds_of_data_stream"), Language::get("conditional"), Language::get("but_received"), thiz.read_pos, size, thiz.size()),
+                                    std::source_location::current(), "read_view");
+                }
+                auto value = std::string_view{reinterpret_cast<char const *>(thiz.data.data() + thiz.read_pos), size};
+                thiz.read_pos += size;
+                return value;
+            }
+
+            // the terminator is located with memchr, which libc implements with SIMD
+
+            inline auto read_view_by_empty(
+
+            ) const -> std::string_view
+            {
+                auto begin = reinterpret_cast<char const *>(thiz.data.data() + thiz.read_pos);
+                auto terminator = thiz.read_pos < thiz.size() ? static_cast<char const *>(std::memchr(begin, 0, thiz.size() - thiz.read_pos)) : nullptr;
+                if (terminator == nullptr)
+                {
+                    throw Exception(fmt::format("{}, {}: thiz.read_pos + size <= thiz.size(), {}: {} + {} <= {}", Language::get("offset_outside_bounds_of_data_stream"), Language::get("conditional"), Language::get("but_received"), thiz.read_pos, thiz.size() - std::min(thiz.read_pos, thiz.size()) + 1, thiz.size()),
+                                    std::source_location::current(), "read_view_by_empty");
+                }
+                auto size = static_cast<std::size_t>(terminator - begin);
+                thiz.read_pos += size + 1;
+                return std::string_view{begin, size};
+            }
+
             inline auto constexpr close(
 
             ) const -> void
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "kernel/definition/library.hpp"
+#include "kernel/definition/macro.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define M_CPU_X86_64 1
+#if defined _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <immintrin.h>
+#if defined __GNUC__ || defined __clang__
+#define M_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define M_TARGET_SSE42 __attribute__((target("sse4.2")))
+#define M_TARGET_CLMUL __attribute__((target("sse4.1,pclmul")))
+#define M_TARGET_AVX2 __attribute__((target("avx2")))
+#define M_TARGET_AES __attribute__((target("sse4.1,aes")))
+#else
+#define M_TARGET_SSSE3
+#define M_TARGET_SSE42
+#define M_TARGET_CLMUL
+#define M_TARGET_AVX2
+#define M_TARGET_AES
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define M_CPU_ARM64 1
+#include <arm_neon.h>
+#if defined __ARM_FEATURE_CRC32
+#include <arm_acle.h>
+#endif
+#if defined __ARM_FEATURE_AES || defined __ARM_FEATURE_CRYPTO
+#define M_CPU_ARM64_AES 1
+#endif
+#endif
+
+namespace Sen::Kernel::CPU {
+
+	/**
+	 * Instruction set extensions usable by the SIMD paths, detected once
+	 * Everything is false on targets other than x86-64, AArch64 paths are chosen at compile time
+	*/
+
+	struct Feature {
+		bool ssse3;
+		bool sse41;
+		bool sse42;
+		bool clmul;
+		bool avx2;
+		bool aes;
+	};
+
+	inline static auto feature(
+	) -> Feature const &
+	{
+		static auto const value = []() {
+			auto result = Feature{};
+			#if defined M_CPU_X86_64
+			auto leaf_1 = std::array<unsigned int, 4>{};
+			auto leaf_7 = std::array<unsigned int, 4>{};
+			auto xcr0 = std::uint64_t{};
+			#if defined _MSC_VER
+			auto info = std::array<int, 4>{};
+			__cpuid(info.data(), 0);
+			auto max_leaf = static_cast<unsigned int>(info[0]);
+			__cpuid(info.data(), 1);
+			std::memcpy(leaf_1.data(), info.data(), sizeof(info));
+			if (max_leaf >= 7) {
+				__cpuidex(info.data(), 7, 0);
+				std::memcpy(leaf_7.data(), info.data(), sizeof(info));
+			}
+			if ((leaf_1[2] >> 27) & 1u) {
+				xcr0 = _xgetbv(0);
+			}
+			#else
+			__get_cpuid(1, &leaf_1[0], &leaf_1[1], &leaf_1[2], &leaf_1[3]);
+			__get_cpuid_count(7, 0, &leaf_7[0], &leaf_7[1], &leaf_7[2], &leaf_7[3]);
+			if ((leaf_1[2] >> 27) & 1u) {
+				auto eax = 0u, edx = 0u;
+				__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+				xcr0 = (static_cast<std::uint64_t>(edx) << 32) | eax;
+			}
+			#endif
+			auto avx_state = (xcr0 & 0x6) == 0x6;
+			result.ssse3 = ((leaf_1[2] >> 9) & 1u) != 0u;
+			result.sse41 = ((leaf_1[2] >> 19) & 1u) != 0u;
+			result.sse42 = ((leaf_1[2] >> 20) & 1u) != 0u;
+			result.clmul = result.sse41 && ((leaf_1[2] >> 1) & 1u) != 0u;
+			result.aes = result.sse41 && ((leaf_1[2] >> 25) & 1u) != 0u;
+			result.avx2 = avx_state && ((leaf_1[2] >> 28) & 1u) != 0u && ((leaf_7[1] >> 5) & 1u) != 0u;
+			#endif
+			return result;
+		}();
+		return value;
+	}
+
+}
@@ -7,6 +7,11 @@
 
 #ifdef _WIN32
 #include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 
 namespace Sen::Kernel::FileSystem
@@ -49,24 +54,62 @@ namespace Sen::Kernel::FileSystem
 	}
 
 	// Provide file path to read json
+	// The file is read once into a buffer of its own size and parsed from there
 	// return: if the json is valid, the json data will be parsed as object
 
 	inline static auto read_json(
 		std::string_view source
-	) -> std::shared_ptr<nlohmann::ordered_json> const 
+	) -> std::shared_ptr<ordered_json> const 
 	{
 		#if WINDOWS
-		auto file = std::ifstream(String::utf8view_to_utf16(fmt::format("\\\\?\\{}",
-			String::to_windows_style(source.data()))).data());
+		auto file = std::unique_ptr<FILE, decltype(close_file)>(_wfopen(String::utf8view_to_utf16(fmt::format("\\\\?\\{}",
+			String::to_windows_style(source.data()))).data(), L"rb"), close_file);
 		#else
-		auto file = std::ifstream(source.data());
+		auto file = std::unique_ptr<FILE, decltype(close_file)>(std::fopen(source.data(), "rb"), close_file);
 		#endif
-        if (!file.is_open()) {
+		if (file == nullptr) {
 			throw Exception(fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(source.data())), std::source_location::current(), "read_json");
-        }
-        auto buffer = std::stringstream{};
-        buffer << file.rdbuf();
-		return std::make_shared<nlohmann::ordered_json>(nlohmann::ordered_json::parse(buffer.str()));
+		}
+		std::fseek(file.get(), 0, SEEK_END);
+		auto size = std::ftell(file.get());
+		std::fseek(file.get(), 0, SEEK_SET);
+		if (size < 0) {
+			throw Exception(fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(source.data())), std::source_location::current(), "read_json");
+		}
+		auto buffer = std::string(static_cast<std::size_t>(size), '\0');
+		if (std::fread(buffer.data(), 1, buffer.size(), file.get()) != buffer.size()) {
+			throw Exception(fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(source.data())), std::source_location::current(), "read_json");
+		}
+		return std::make_shared<ordered_json>(ordered_json::parse(buffer.cbegin(), buffer.cend()));
+	}
+
+	// Provide file path to read
+	// return: the file content with the padding simdjson reads past the end
+
+	inline static auto read_padded_string(
+		std::string_view source
+	) -> simdjson::padded_string
+	{
+		#if WINDOWS
+		auto file = std::unique_ptr<FILE, decltype(close_file)>(_wfopen(String::utf8view_to_utf16(fmt::format("\\\\?\\{}",
+			String::to_windows_style(source.data()))).data(), L"rb"), close_file);
+		#else
+		auto file = std::unique_ptr<FILE, decltype(close_file)>(std::fopen(source.data(), "rb"), close_file);
+		#endif
+		if (file == nullptr) {
+			throw Exception(fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(source.data())), std::source_location::current(), "read_padded_string");
+		}
+		std::fseek(file.get(), 0, SEEK_END);
+		auto size = std::ftell(file.get());
+		std::fseek(file.get(), 0, SEEK_SET);
+		if (size < 0) {
+			throw Exception(fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(source.data())), std::source_location::current(), "read_padded_string");
+		}
+		auto buffer = simdjson::padded_string(static_cast<std::size_t>(size));
+		if (std::fread(buffer.data(), 1, buffer.size(), file.get()) != buffer.size()) {
+			throw Exception(fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(source.data())), std::source_location::current(), "read_padded_string");
+		}
+		return buffer;
 	}
 
 	// Provide file path to write
@@ -75,7 +118,7 @@ namespace Sen::Kernel::FileSystem
 
 	inline static auto write_json(
 		std::string_view filepath,
-		const nlohmann::ordered_json & content
+		const ordered_json & content
 	) -> void
 	{
 		#if WINDOWS
@@ -99,7 +142,7 @@ namespace Sen::Kernel::FileSystem
 
 	inline static auto write_json(
 		std::string_view filepath,
-		const nlohmann::ordered_json & content,
+		const ordered_json & content,
 		int indent,
 		char indent_char
 	) -> void
@@ -128,7 +171,7 @@ namespace Sen::Kernel::FileSystem
 
 	inline static auto write_json(
 		std::string_view filepath,
-		const nlohmann::ordered_json & content,
+		const ordered_json & content,
 		char indent_char
 	) -> void
 	{
@@ -158,7 +201,7 @@ namespace Sen::Kernel::FileSystem
 
 	inline static auto write_json(
 		std::string_view filepath,
-		const nlohmann::ordered_json &content,
+		const ordered_json &content,
 		int indent,
 		char indent_char,
 		bool ensureAscii
@@ -310,7 +353,7 @@ namespace Sen::Kernel::FileSystem
 
 	inline static auto out_json(
 		std::string_view filePath,
-		const nlohmann::ordered_json &content
+		const ordered_json &content
 	) -> void
 	{
 		out_file(filePath, content.dump(1, '\t'));
@@ -339,6 +382,41 @@ namespace Sen::Kernel::FileSystem
 		return data;	
 	}
 
+	// Default buffer size of read_chunk
+
+	inline static constexpr auto k_chunk_size = static_cast<std::size_t>(0x100000);
+
+	// filepath: file to read
+	// chunk_size: size of the reusable buffer
+	// callback: receive each chunk in order, the view is only valid during the call
+
+	template <typename Callback> requires std::is_invocable_v<Callback, std::span<std::uint8_t const>>
+	inline static auto read_chunk(
+		std::string_view filepath,
+		std::size_t chunk_size,
+		Callback &&callback
+	) -> void
+	{
+		#if WINDOWS
+		auto file = std::ifstream(String::utf8_to_utf16(fmt::format("\\\\?\\{}",
+				String::to_windows_style(filepath.data()))).data(), std::ios::binary);
+		#else
+		auto file = std::ifstream(filepath.data(), std::ios::binary);
+		#endif
+		assert_conditional(file.is_open(), fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(filepath.data())), "read_chunk");
+		auto buffer = std::make_unique<std::uint8_t[]>(chunk_size);
+		while (file) {
+			file.read(reinterpret_cast<char*>(buffer.get()), static_cast<std::streamsize>(chunk_size));
+			auto size = static_cast<std::size_t>(file.gcount());
+			if (size == 0) {
+				break;
+			}
+			callback(std::span<std::uint8_t const>{buffer.get(), size});
+		}
+		assert_conditional(file.eof(), fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(filepath.data())), "read_chunk");
+		return;
+	}
+
 	// dirPath: directory to read
 	// return: everything inside it even directory or file
 
@@ -474,6 +552,25 @@ namespace Sen::Kernel::FileSystem
 		return;
 	}
 
+	template <typename T> requires CharacterBufferView<T>
+	inline static auto write_binary(
+		std::string_view filepath,
+		std::span<T const> data
+	) -> void
+	{
+		#if WINDOWS
+				auto file = std::unique_ptr<FILE, decltype(close_file)>(_wfopen(String::utf8view_to_utf16(fmt::format("\\\\?\\{}",
+				String::to_windows_style(filepath.data()))).data(), L"wb"), close_file);
+		#else
+				auto file = std::unique_ptr<FILE, decltype(close_file)>(std::fopen(String::to_posix_style(std::string{filepath.data(), filepath.size()}).data(), "wb"), close_file);
+		#endif
+		if(file == nullptr){
+			throw Exception(fmt::format("{}: {}", Language::get("write_file_error"), String::to_posix_style(filepath.data())), std::source_location::current(), "write_binary");
+		}
+		std::fwrite(reinterpret_cast<const char *>(data.data()), sizeof(T), data.size(), file.get());
+		return;
+	}
+
 
 	/**
 	 * file path: the file path to read
@@ -637,6 +734,154 @@ namespace Sen::Kernel::FileSystem
 
 	};
 
+	/**
+	 * Read-only memory mapping of a whole file
+	 * The view stays valid while the object is alive and may be read from many threads
+	*/
+
+	class MappedFile {
+
+		protected:
+
+			uint8_t const* address{nullptr};
+
+			std::size_t length{0};
+
+			#if WINDOWS
+			HANDLE file{INVALID_HANDLE_VALUE};
+
+			HANDLE mapping{nullptr};
+			#else
+			int file{-1};
+			#endif
+
+			auto release(
+
+			) -> void
+			{
+				#if WINDOWS
+				if (thiz.address != nullptr) {
+					UnmapViewOfFile(thiz.address);
+				}
+				if (thiz.mapping != nullptr) {
+					CloseHandle(thiz.mapping);
+				}
+				if (thiz.file != INVALID_HANDLE_VALUE) {
+					CloseHandle(thiz.file);
+				}
+				thiz.mapping = nullptr;
+				thiz.file = INVALID_HANDLE_VALUE;
+				#else
+				if (thiz.address != nullptr) {
+					munmap(const_cast<uint8_t*>(thiz.address), thiz.length);
+				}
+				if (thiz.file != -1) {
+					::close(thiz.file);
+				}
+				thiz.file = -1;
+				#endif
+				thiz.address = nullptr;
+				thiz.length = 0;
+				return;
+			}
+
+			auto raise(
+				std::string_view source
+			) -> void
+			{
+				thiz.release();
+				throw Exception(fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(source.data())), std::source_location::current(), "MappedFile");
+			}
+
+		public:
+
+			explicit MappedFile(
+				std::string_view source
+			)
+			{
+				#if WINDOWS
+				thiz.file = CreateFileW(String::utf8_to_utf16(fmt::format("\\\\?\\{}", String::to_windows_style(source.data()))).data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+				if (thiz.file == INVALID_HANDLE_VALUE) {
+					thiz.raise(source);
+				}
+				auto file_size = LARGE_INTEGER{};
+				if (GetFileSizeEx(thiz.file, &file_size) == 0) {
+					thiz.raise(source);
+				}
+				thiz.length = static_cast<std::size_t>(file_size.QuadPart);
+				if (thiz.length == 0) {
+					return;
+				}
+				thiz.mapping = CreateFileMappingW(thiz.file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (thiz.mapping == nullptr) {
+					thiz.raise(source);
+				}
+				thiz.address = static_cast<uint8_t const*>(MapViewOfFile(thiz.mapping, FILE_MAP_READ, 0, 0, 0));
+				if (thiz.address == nullptr) {
+					thiz.raise(source);
+				}
+				#else
+				thiz.file = ::open(source.data(), O_RDONLY);
+				if (thiz.file == -1) {
+					thiz.raise(source);
+				}
+				struct stat status{};
+				if (fstat(thiz.file, &status) != 0) {
+					thiz.raise(source);
+				}
+				thiz.length = static_cast<std::size_t>(status.st_size);
+				if (thiz.length == 0) {
+					return;
+				}
+				auto view = mmap(nullptr, thiz.length, PROT_READ, MAP_PRIVATE, thiz.file, 0);
+				if (view == MAP_FAILED) {
+					thiz.length = 0;
+					thiz.raise(source);
+				}
+				thiz.address = static_cast<uint8_t const*>(view);
+				#endif
+			}
+
+			auto data(
+
+			) const -> uint8_t const*
+			{
+				return thiz.address;
+			}
+
+			auto size(
+
+			) const -> std::size_t
+			{
+				return thiz.length;
+			}
+
+			auto view(
+
+			) const -> std::span<uint8_t const>
+			{
+				return std::span<uint8_t const>{thiz.address, thiz.length};
+			}
+
+			MappedFile(
+			) = delete;
+
+			MappedFile(
+				MappedFile const& that
+			) = delete;
+
+			MappedFile(
+				MappedFile&& that
+			) = delete;
+
+			~MappedFile(
+			)
+			{
+				thiz.release();
+			}
+
+	};
+
 	class FileSystemWatcher {
 		public:
 			using Callback = std::function<void(const std::string& event, const std::string& filename)>;
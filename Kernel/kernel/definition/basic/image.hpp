@@ -477,6 +477,21 @@ namespace Sen::Kernel::Definition {
 			}
 
 
+			/**
+			 * Size of one side after resizing by percent, rounded up so no edge pixel is dropped
+			 * size: the current size
+			 * percent: the new image percent to resize
+			 * return: the new size
+			*/
+
+			inline static auto resize_dimension(
+				int size,
+				float percent
+			) -> int
+			{
+				return static_cast<int>(Math::ceil(size * percent));
+			}
+
 			/**
 			 * Resize image algorithm
 			 * source: source image
@@ -489,8 +504,8 @@ namespace Sen::Kernel::Definition {
 				float percent
 			) -> Image<T>
 			{
-				auto new_width = static_cast<int>(Math::ceil(source.width * percent));
-				auto new_height = static_cast<int>(Math::ceil(source.height * percent));
+				auto new_width = resize_dimension(source.width, percent);
+				auto new_height = resize_dimension(source.height, percent);
 				auto resized_image_data = std::vector<unsigned char>(new_width * new_height * 4);
 				for (auto j : Range<int>(new_height)) {
 					for (auto i : Range<int>(new_width)) {
@@ -576,8 +591,23 @@ namespace Sen::Kernel::Definition {
 				float percentage
 			) -> Image<int> const
 			{
-				auto new_width = static_cast<int>(source.width * percentage);
-				auto new_height = static_cast<int>(source.height * percentage);
+				return scale(source, static_cast<int>(source.width * percentage), static_cast<int>(source.height * percentage));
+			}
+
+			/**
+			 * Scale image using avir.h
+			 * source: image source
+			 * new_width: the new image width
+			 * new_height: the new image height
+			 * return: new image
+			*/
+
+			inline static auto scale(
+				const Image<int> & source,
+				int new_width,
+				int new_height
+			) -> Image<int> const
+			{
 				const auto area = (new_width * new_height * 4);
 				auto data = std::make_unique<uint8_t[]>(area);
 				avir::CImageResizer<>{8}.resizeImage(
@@ -12,7 +12,7 @@ namespace Sen::Kernel::Definition {
 		*/
 
 		inline static auto keys(
-			const nlohmann::ordered_json &data
+			const ordered_json &data
 		) -> std::vector<std::string>
 		{
 			auto result = std::vector<std::string>();
@@ -28,10 +28,10 @@ namespace Sen::Kernel::Definition {
 		*/
 
 		inline static auto values(
-			const nlohmann::ordered_json &data
-		) -> nlohmann::ordered_json::array_t
+			const ordered_json &data
+		) -> ordered_json::array_t
 		{
-			auto result = nlohmann::ordered_json::array_t{};
+			auto result = ordered_json::array_t{};
 			for(auto & [key, value] : data.items()){
 				result.push_back(value);
 			}
@@ -66,7 +66,7 @@ namespace Sen::Kernel::Definition {
 
 		template <typename T>
 		inline auto to_json(
-			nlohmann::ordered_json& nlohmann_json_j,
+			ordered_json& nlohmann_json_j,
 			const Nullable<T>& nlohmann_json_t
 		) -> void
 		{
@@ -81,7 +81,7 @@ namespace Sen::Kernel::Definition {
 
 		template <typename T>
 		inline auto from_json(
-			const nlohmann::ordered_json& nlohmann_json_j,
+			const ordered_json& nlohmann_json_j,
 			Nullable<T>& nlohmann_json_t
 		) -> void
 		{
@@ -0,0 +1,259 @@
+#pragma once
+
+#include "kernel/definition/library.hpp"
+#include "kernel/definition/macro.hpp"
+#include "kernel/definition/assert.hpp"
+#include "kernel/definition/basic/filesystem.hpp"
+
+namespace Sen::Kernel::Definition
+{
+    struct OnDemand;
+
+    // a definition opts in by declaring from_ondemand(OnDemand::Value &, T &) beside its from_json
+
+    template <typename T>
+    concept HasFromOnDemand = requires(simdjson::ondemand::value &value, T &destination) { from_ondemand(value, destination); };
+
+    /**
+     * Fill definition structs straight from simdjson on-demand in one pass, no json tree is built
+     * Fields are cheapest when read in file order, a field out of order is still found
+     * Any input on-demand rejects is parsed again with nlohmann, which reports the error or reads it
+     */
+
+    struct OnDemand
+    {
+    public:
+        using Value = simdjson::ondemand::value;
+
+        using Object = simdjson::ondemand::object;
+
+        inline static auto as_object(
+            Value &value) -> Object
+        {
+            return value.get_object().value();
+        }
+
+        inline static auto get(
+            Value &value,
+            bool &destination) -> void
+        {
+            destination = value.get_bool().value();
+            return;
+        }
+
+        inline static auto get(
+            Value &value,
+            std::string &destination) -> void
+        {
+            destination = value.get_string().value();
+            return;
+        }
+
+        // out of range numbers are narrowed like nlohmann get_to
+
+        template <typename T>
+            requires std::is_integral_v<T> && (!std::is_same_v<T, bool>)
+        inline static auto get(
+            Value &value,
+            T &destination) -> void
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                destination = static_cast<T>(value.get_int64().value());
+            }
+            else
+            {
+                destination = static_cast<T>(value.get_uint64().value());
+            }
+            return;
+        }
+
+        template <typename T>
+            requires std::is_floating_point_v<T>
+        inline static auto get(
+            Value &value,
+            T &destination) -> void
+        {
+            destination = static_cast<T>(value.get_double().value());
+            return;
+        }
+
+        // enums are stored as their underlying number, as nlohmann does without a serializer
+
+        template <typename T>
+            requires std::is_enum_v<T>
+        inline static auto get(
+            Value &value,
+            T &destination) -> void
+        {
+            auto underlying = std::underlying_type_t<T>{};
+            get(value, underlying);
+            destination = static_cast<T>(underlying);
+            return;
+        }
+
+        template <typename T>
+        inline static auto get(
+            Value &value,
+            std::vector<T> &destination) -> void
+        {
+            destination.clear();
+            for (auto element : value.get_array())
+            {
+                auto element_value = element.value();
+                get(element_value, destination.emplace_back());
+            }
+            return;
+        }
+
+        template <typename T, std::size_t Size>
+        inline static auto get(
+            Value &value,
+            std::array<T, Size> &destination) -> void
+        {
+            auto index = std::size_t{0};
+            for (auto element : value.get_array())
+            {
+                if (index == Size)
+                {
+                    throw simdjson::simdjson_error{simdjson::INDEX_OUT_OF_BOUNDS};
+                }
+                auto element_value = element.value();
+                get(element_value, destination[index++]);
+            }
+            if (index != Size)
+            {
+                throw simdjson::simdjson_error{simdjson::INDEX_OUT_OF_BOUNDS};
+            }
+            return;
+        }
+
+        template <typename T>
+        inline static auto get(
+            Value &value,
+            std::map<std::string, T> &destination) -> void
+        {
+            destination.clear();
+            for (auto element : value.get_object())
+            {
+                auto key = std::string{element.unescaped_key().value()};
+                auto element_value = element.value().value();
+                get(element_value, destination[key]);
+            }
+            return;
+        }
+
+        template <typename T>
+        inline static auto get(
+            Value &value,
+            tsl::ordered_map<std::string, T> &destination) -> void
+        {
+            destination.clear();
+            for (auto element : value.get_object())
+            {
+                auto key = std::string{element.unescaped_key().value()};
+                auto element_value = element.value().value();
+                get(element_value, destination[key]);
+            }
+            return;
+        }
+
+        template <typename T>
+            requires HasFromOnDemand<T>
+        inline static auto get(
+            Value &value,
+            T &destination) -> void
+        {
+            from_ondemand(value, destination);
+            return;
+        }
+
+        template <typename T>
+        inline static auto field(
+            Object &object,
+            std::string_view key,
+            T &destination) -> void
+        {
+            auto value = object.find_field_unordered(key).value();
+            get(value, destination);
+            return;
+        }
+
+        // a null value leaves the destination as it is, return: whether the value was read
+
+        template <typename T>
+        inline static auto nullable_field(
+            Object &object,
+            std::string_view key,
+            T &destination) -> bool
+        {
+            auto value = object.find_field_unordered(key).value();
+            if (value.is_null().value())
+            {
+                return false;
+            }
+            get(value, destination);
+            return true;
+        }
+
+        // a missing or null value leaves the destination as it is, return: whether the value was read
+
+        template <typename T>
+        inline static auto optional_field(
+            Object &object,
+            std::string_view key,
+            T &destination) -> bool
+        {
+            auto value = Value{};
+            if (auto error = object.find_field_unordered(key).get(value); error == simdjson::NO_SUCH_FIELD)
+            {
+                return false;
+            }
+            else if (error != simdjson::SUCCESS)
+            {
+                throw simdjson::simdjson_error{error};
+            }
+            if (value.is_null().value())
+            {
+                return false;
+            }
+            get(value, destination);
+            return true;
+        }
+
+        template <typename T>
+        inline static auto parse(
+            simdjson::padded_string const &source,
+            T &destination) -> void
+        {
+            try
+            {
+                auto parser = simdjson::ondemand::parser{};
+                auto document = static_cast<simdjson::ondemand::document>(parser.iterate(source));
+                auto value = document.get_value().value();
+                get(value, destination);
+                // fields found out of order leave the root unfinished, skipping it again only walks the structural index
+                document.rewind();
+                document.get_value().value().raw_json().value();
+                if (!document.at_end())
+                {
+                    throw simdjson::simdjson_error{simdjson::TRAILING_CONTENT};
+                }
+            }
+            catch (simdjson::simdjson_error const &)
+            {
+                destination = ordered_json::parse(source.data(), source.data() + source.size()).get<T>();
+            }
+            return;
+        }
+
+        template <typename T>
+        inline static auto read_fs(
+            std::string_view source) -> T
+        {
+            auto result = T{};
+            parse(FileSystem::read_padded_string(source), result);
+            return result;
+        }
+    };
+}
@@ -61,7 +61,7 @@ namespace Sen::Kernel::Language
 			#endif
 		}
 		auto buffer = std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-		language = nlohmann::ordered_json::parse(buffer);
+		language = ordered_json::parse(buffer);
 		return;
 	}
 
@@ -173,4 +173,231 @@ concept IsValidArguments = true;
 				return;
 			}
 	};
+
+	/**
+	 * Fixed-size worker pool, every task is queued and run by one of the workers
+	 * The result of each task is delivered through the returned future
+	*/
+
+	class ThreadPool {
+		public:
+			using ThreadCount = std::size_t;
+			using Mutex = std::mutex;
+			using Task = std::function<void()>;
+		private:
+			template <typename MType>
+			using List = std::vector<MType>;
+		protected:
+			List<std::thread> workers{};
+			std::queue<Task> tasks{};
+			Mutex g_mutex{};
+			std::condition_variable condition{};
+			bool stopped{false};
+
+			auto work (
+			) -> void
+			{
+				while (true) {
+					auto task = Task{};
+					{
+						auto lock = std::unique_lock<std::mutex>(thiz.g_mutex);
+						thiz.condition.wait(lock, [this]() { return thiz.stopped || !thiz.tasks.empty(); });
+						if (thiz.stopped && thiz.tasks.empty()) {
+							return;
+						}
+						task = std::move(thiz.tasks.front());
+						thiz.tasks.pop();
+					}
+					task();
+				}
+				return;
+			}
+
+		public:
+			inline static auto default_thread_count (
+			) -> ThreadCount
+			{
+				return (std::max)(static_cast<ThreadCount>(std::thread::hardware_concurrency()), static_cast<ThreadCount>(1));
+			}
+
+			explicit ThreadPool(
+				ThreadCount thread_count = default_thread_count()
+			)
+			{
+				auto count = (std::max)(thread_count, static_cast<ThreadCount>(1));
+				thiz.workers.reserve(count);
+				for (auto index = ThreadCount{0}; index < count; ++index) {
+					thiz.workers.emplace_back([this]() { thiz.work(); });
+				}
+			}
+
+			~ThreadPool(
+			)
+			{
+				{
+					auto lock = std::lock_guard<std::mutex>(thiz.g_mutex);
+					thiz.stopped = true;
+				}
+				thiz.condition.notify_all();
+				for (auto& worker : thiz.workers) {
+					if (worker.joinable()) {
+						worker.join();
+					}
+				}
+			}
+
+			ThreadPool(
+				ThreadPool const& that
+			) = delete;
+
+			ThreadPool(
+				ThreadPool&& that
+			) = delete;
+
+			auto operator =(
+				ThreadPool const& that
+			)->ThreadPool & = delete;
+
+			auto operator =(
+				ThreadPool&& that
+			)->ThreadPool & = delete;
+
+			template <typename Function>
+			auto enqueue (
+				Function&& function
+			) -> std::future<std::invoke_result_t<std::decay_t<Function>>>
+			{
+				using Result = std::invoke_result_t<std::decay_t<Function>>;
+				auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(function));
+				auto result = task->get_future();
+				{
+					auto lock = std::lock_guard<std::mutex>(thiz.g_mutex);
+					assert_conditional(!thiz.stopped, fmt::format("{}", Language::get("os.system.invalid_thread")), "enqueue");
+					thiz.tasks.emplace([task]() { (*task)(); });
+				}
+				thiz.condition.notify_one();
+				return result;
+			}
+
+			auto size (
+			) const -> ThreadCount
+			{
+				return thiz.workers.size();
+			}
+
+			/**
+			 * Wait for every task, the first exception is rethrown once all of them are done
+			*/
+
+			template <typename Result>
+			inline static auto wait_all (
+				std::vector<std::future<Result>>& task
+			) -> void
+			{
+				auto exception = std::exception_ptr{};
+				for (auto& element : task) {
+					try {
+						element.get();
+					}
+					catch (...) {
+						if (exception == nullptr) {
+							exception = std::current_exception();
+						}
+					}
+				}
+				if (exception != nullptr) {
+					std::rethrow_exception(exception);
+				}
+				return;
+			}
+
+			/**
+			 * Run function(index) for every index below count on this pool and wait for all of them
+			*/
+
+			template <typename Function>
+			auto run_all (
+				std::size_t count,
+				Function&& function
+			) -> void
+			{
+				auto task = std::vector<std::future<void>>{};
+				task.reserve(count);
+				for (auto index = std::size_t{0}; index < count; ++index) {
+					task.emplace_back(thiz.enqueue([&function, index]() { function(index); }));
+				}
+				wait_all(task);
+				return;
+			}
+
+			/**
+			 * Run function(element) for every element of container on this pool and wait for all of them
+			 * The container must not be resized while the tasks run
+			*/
+
+			template <typename Container, typename Function>
+			auto for_each (
+				Container& container,
+				Function&& function
+			) -> void
+			{
+				auto task = std::vector<std::future<void>>{};
+				task.reserve(std::size(container));
+				for (auto& element : container) {
+					task.emplace_back(thiz.enqueue([&function, &element]() { function(element); }));
+				}
+				wait_all(task);
+				return;
+			}
+
+			/**
+			 * Worker count for count tasks, clamped to [1, default_thread_count()]
+			*/
+
+			inline static auto bounded_thread_count (
+				std::size_t count,
+				ThreadCount thread_count = default_thread_count()
+			) -> ThreadCount
+			{
+				return std::clamp(std::min(thread_count, count), static_cast<ThreadCount>(1), default_thread_count());
+			}
+
+			/**
+			 * run_all on a pool sized for count
+			*/
+
+			template <typename Function>
+			inline static auto parallel_for (
+				std::size_t count,
+				Function&& function,
+				ThreadCount thread_count = default_thread_count()
+			) -> void
+			{
+				if (count == 0) {
+					return;
+				}
+				auto pool = ThreadPool{bounded_thread_count(count, thread_count)};
+				pool.run_all(count, std::forward<Function>(function));
+				return;
+			}
+
+			/**
+			 * for_each on a pool sized for the container
+			*/
+
+			template <typename Container, typename Function>
+			inline static auto parallel_for_each (
+				Container& container,
+				Function&& function,
+				ThreadCount thread_count = default_thread_count()
+			) -> void
+			{
+				if (std::size(container) == 0) {
+					return;
+				}
+				auto pool = ThreadPool{bounded_thread_count(std::size(container), thread_count)};
+				pool.for_each(container, std::forward<Function>(function));
+				return;
+			}
+	};
 }
\ No newline at end of file
@@ -0,0 +1,408 @@
+#pragma once
+
+#include "kernel/definition/library.hpp"
+#include "kernel/definition/macro.hpp"
+#include "kernel/definition/assert.hpp"
+
+namespace Sen::Kernel::Definition
+{
+    /**
+     * Forward-only XML reader, no document tree is built
+     * Only element tags and their attributes are reported,
+     * text, comment, CDATA, processing instruction and DOCTYPE are skipped
+     * Attribute values are views into the source, use unescape if they may contain entities
+     */
+
+    class XMLReader
+    {
+    public:
+        enum class Token : uint8_t
+        {
+            none,
+            start_element,
+            end_element,
+            end_document
+        };
+
+        struct Attribute
+        {
+            std::string_view name;
+            std::string_view value;
+        };
+
+    protected:
+        std::string_view source;
+
+        std::size_t position = std::size_t{0};
+
+        std::vector<std::string_view> element_stack{};
+
+        std::string_view current_name{};
+
+        std::vector<Attribute> current_attribute{};
+
+        bool pending_end_element = false;
+
+        Token current_token = Token::none;
+
+        inline static constexpr auto is_space(
+            char c) -> bool
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+        }
+
+        inline static constexpr auto is_name_end(
+            char c) -> bool
+        {
+            return is_space(c) || c == '/' || c == '>' || c == '=';
+        }
+
+        inline auto raise(
+
+        ) const -> void
+        {
+            throw Exception(fmt::format("{}: {}", Language::get("xml.read_error"), thiz.position), std::source_location::current(), "read");
+        }
+
+        inline auto skip_space(
+
+        ) -> void
+        {
+            while (thiz.position < thiz.source.size() && is_space(thiz.source[thiz.position]))
+            {
+                ++thiz.position;
+            }
+            return;
+        }
+
+        inline auto skip_past(
+            std::string_view terminator) -> void
+        {
+            auto index = thiz.source.find(terminator, thiz.position);
+            if (index == std::string_view::npos)
+            {
+                thiz.raise();
+            }
+            thiz.position = index + terminator.size();
+            return;
+        }
+
+        inline auto read_name(
+
+        ) -> std::string_view
+        {
+            auto begin = thiz.position;
+            while (thiz.position < thiz.source.size() && !is_name_end(thiz.source[thiz.position]))
+            {
+                ++thiz.position;
+            }
+            if (thiz.position == begin || thiz.position >= thiz.source.size())
+            {
+                thiz.raise();
+            }
+            return thiz.source.substr(begin, thiz.position - begin);
+        }
+
+        inline auto read_start_element(
+
+        ) -> void
+        {
+            thiz.current_name = thiz.read_name();
+            thiz.current_attribute.clear();
+            while (true)
+            {
+                thiz.skip_space();
+                if (thiz.position >= thiz.source.size())
+                {
+                    thiz.raise();
+                }
+                auto c = thiz.source[thiz.position];
+                if (c == '>')
+                {
+                    ++thiz.position;
+                    break;
+                }
+                if (c == '/')
+                {
+                    if (thiz.position + 1 >= thiz.source.size() || thiz.source[thiz.position + 1] != '>')
+                    {
+                        thiz.raise();
+                    }
+                    thiz.position += 2;
+                    thiz.pending_end_element = true;
+                    break;
+                }
+                auto attribute_name = thiz.read_name();
+                thiz.skip_space();
+                if (thiz.position >= thiz.source.size() || thiz.source[thiz.position] != '=')
+                {
+                    thiz.raise();
+                }
+                ++thiz.position;
+                thiz.skip_space();
+                if (thiz.position >= thiz.source.size())
+                {
+                    thiz.raise();
+                }
+                auto quote = thiz.source[thiz.position];
+                if (quote != '"' && quote != '\'')
+                {
+                    thiz.raise();
+                }
+                auto value_begin = thiz.position + 1;
+                auto value_end = thiz.source.find(quote, value_begin);
+                if (value_end == std::string_view::npos)
+                {
+                    thiz.raise();
+                }
+                thiz.current_attribute.emplace_back(Attribute{attribute_name, thiz.source.substr(value_begin, value_end - value_begin)});
+                thiz.position = value_end + 1;
+            }
+            thiz.element_stack.emplace_back(thiz.current_name);
+            thiz.current_token = Token::start_element;
+            return;
+        }
+
+    public:
+        explicit XMLReader(
+            std::string_view source) : source(source)
+        {
+        }
+
+        ~XMLReader() = default;
+
+        /**
+         * Advance to the next element boundary
+         * Self-closing elements are reported as start_element followed by end_element
+         */
+
+        inline auto read(
+
+        ) -> Token
+        {
+            if (thiz.pending_end_element)
+            {
+                thiz.pending_end_element = false;
+                thiz.current_attribute.clear();
+                thiz.element_stack.pop_back();
+                thiz.current_token = Token::end_element;
+                return thiz.current_token;
+            }
+            while (true)
+            {
+                auto index = thiz.source.find('<', thiz.position);
+                if (index == std::string_view::npos)
+                {
+                    if (!thiz.element_stack.empty())
+                    {
+                        thiz.raise();
+                    }
+                    thiz.position = thiz.source.size();
+                    thiz.current_name = std::string_view{};
+                    thiz.current_attribute.clear();
+                    thiz.current_token = Token::end_document;
+                    return thiz.current_token;
+                }
+                thiz.position = index + 1;
+                if (thiz.position >= thiz.source.size())
+                {
+                    thiz.raise();
+                }
+                auto rest = thiz.source.substr(thiz.position);
+                if (rest.starts_with("!--"))
+                {
+                    thiz.skip_past("-->");
+                    continue;
+                }
+                if (rest.starts_with("![CDATA["))
+                {
+                    thiz.skip_past("]]>");
+                    continue;
+                }
+                if (rest.front() == '?' || rest.front() == '!')
+                {
+                    thiz.skip_past(">");
+                    continue;
+                }
+                if (rest.front() == '/')
+                {
+                    ++thiz.position;
+                    thiz.current_name = thiz.read_name();
+                    thiz.skip_space();
+                    if (thiz.position >= thiz.source.size() || thiz.source[thiz.position] != '>' || thiz.element_stack.empty() || thiz.element_stack.back() != thiz.current_name)
+                    {
+                        thiz.raise();
+                    }
+                    ++thiz.position;
+                    thiz.current_attribute.clear();
+                    thiz.element_stack.pop_back();
+                    thiz.current_token = Token::end_element;
+                    return thiz.current_token;
+                }
+                thiz.read_start_element();
+                return thiz.current_token;
+            }
+        }
+
+        inline auto token(
+
+        ) const -> Token
+        {
+            return thiz.current_token;
+        }
+
+        inline auto name(
+
+        ) const -> std::string_view
+        {
+            return thiz.current_name;
+        }
+
+        /**
+         * Depth of the current element, the root element is at depth 1
+         * For end_element, this is the depth of its parent
+         */
+
+        inline auto depth(
+
+        ) const -> std::size_t
+        {
+            return thiz.element_stack.size();
+        }
+
+        inline auto attribute(
+            std::string_view name) const -> std::optional<std::string_view>
+        {
+            for (auto &element : thiz.current_attribute)
+            {
+                if (element.name == name)
+                {
+                    return element.value;
+                }
+            }
+            return std::nullopt;
+        }
+
+        inline auto attribute(
+            std::string_view name,
+            std::string_view default_value) const -> std::string_view
+        {
+            return thiz.attribute(name).value_or(default_value);
+        }
+
+        /**
+         * Skip the children of the current start element, stop at its end_element
+         */
+
+        inline auto skip(
+
+        ) -> void
+        {
+            if (thiz.current_token != Token::start_element)
+            {
+                return;
+            }
+            auto target_depth = thiz.element_stack.size() - 1;
+            while (thiz.read() != Token::end_document)
+            {
+                if (thiz.current_token == Token::end_element && thiz.element_stack.size() == target_depth)
+                {
+                    return;
+                }
+            }
+            thiz.raise();
+            return;
+        }
+
+        /**
+         * Decode predefined and numeric character references
+         */
+
+        inline static auto unescape(
+            std::string_view value) -> std::string
+        {
+            if (value.find('&') == std::string_view::npos)
+            {
+                return std::string{value};
+            }
+            auto result = std::string{};
+            result.reserve(value.size());
+            for (auto index = std::size_t{0}; index < value.size(); ++index)
+            {
+                if (value[index] != '&')
+                {
+                    result += value[index];
+                    continue;
+                }
+                auto end = value.find(';', index);
+                if (end == std::string_view::npos)
+                {
+                    result += value[index];
+                    continue;
+                }
+                auto entity = value.substr(index + 1, end - index - 1);
+                if (entity == "amp")
+                {
+                    result += '&';
+                }
+                else if (entity == "lt")
+                {
+                    result += '<';
+                }
+                else if (entity == "gt")
+                {
+                    result += '>';
+                }
+                else if (entity == "quot")
+                {
+                    result += '"';
+                }
+                else if (entity == "apos")
+                {
+                    result += '\'';
+                }
+                else if (entity.size() > 1 && entity.front() == '#')
+                {
+                    auto is_hex = entity[1] == 'x' || entity[1] == 'X';
+                    auto digit = entity.substr(is_hex ? 2 : 1);
+                    auto code = std::uint32_t{0};
+                    auto [last, error] = std::from_chars(digit.data(), digit.data() + digit.size(), code, is_hex ? 16 : 10);
+                    if (error != std::errc{} || last != digit.data() + digit.size())
+                    {
+                        result += value.substr(index, end - index + 1);
+                        index = end;
+                        continue;
+                    }
+                    if (code < 0x80)
+                    {
+                        result += static_cast<char>(code);
+                    }
+                    else if (code < 0x800)
+                    {
+                        result += static_cast<char>(0xC0 | (code >> 6));
+                        result += static_cast<char>(0x80 | (code & 0x3F));
+                    }
+                    else if (code < 0x10000)
+                    {
+                        result += static_cast<char>(0xE0 | (code >> 12));
+                        result += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                        result += static_cast<char>(0x80 | (code & 0x3F));
+                    }
+                    else
+                    {
+                        result += static_cast<char>(0xF0 | (code >> 18));
+                        result += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+                        result += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                        result += static_cast<char>(0x80 | (code & 0x3F));
+                    }
+                }
+                else
+                {
+                    result += value.substr(index, end - index + 1);
+                }
+                index = end;
+            }
+            return result;
+        }
+    };
+}
@@ -88,6 +88,17 @@ namespace Sen::Kernel::Definition::Compression {
 			inline static auto uncompress(
 				const std::vector<unsigned char> & input
 			) -> std::vector<unsigned char> 
+			{
+				return uncompress(std::span<unsigned char const>{input.data(), input.size()});
+			}
+
+			/**
+			 * input: view of the compressed stream, may point into a larger buffer
+			 * return: result after uncompress
+			*/
+			inline static auto uncompress(
+				std::span<unsigned char const> input
+			) -> std::vector<unsigned char> 
 			{
 				auto bzerror = int{};
 				auto strm = bz_stream{
@@ -96,7 +107,7 @@ namespace Sen::Kernel::Definition::Compression {
 					.opaque = nullptr,
 				};
 				BZ2_bzDecompressInit(&strm, 0, 0);
-				strm.next_in = (char*)input.data();
+				strm.next_in = const_cast<char*>(reinterpret_cast<char const*>(input.data()));
 				strm.avail_in = static_cast<unsigned int>(input.size());
 				auto result = std::vector<unsigned char>{};
 				unsigned char outbuffer[4096];
@@ -104,7 +115,8 @@ namespace Sen::Kernel::Definition::Compression {
 					strm.next_out = reinterpret_cast<char*>(outbuffer);
 					strm.avail_out = sizeof(outbuffer);
 					bzerror = BZ2_bzDecompress(&strm);
-					if (bzerror < 0) {
+					// a truncated stream stops making progress without reporting an error
+					if (bzerror < 0 || (bzerror == BZ_OK && strm.avail_in == 0 && strm.avail_out == sizeof(outbuffer))) {
 						BZ2_bzDecompressEnd(&strm);
 						throw Exception(fmt::format("{}", Language::get("bzip2.uncompress.failed")), std::source_location::current(), "uncompress");
 					}
@@ -94,21 +94,34 @@ namespace Sen::Kernel::Definition::Compression {
 			inline static auto uncompress(
 				const std::vector<unsigned char> &data
 			) -> std::vector<unsigned char>
+			{
+				return uncompress<strict>(std::span<unsigned char const>{data.data(), data.size()});
+			}
+
+			/**
+			 * data: view of the lzma-alone stream, may point into a larger buffer
+			 * return: uncompressed data
+			*/
+			template <auto strict = true>
+			inline static auto uncompress(
+				std::span<unsigned char const> data
+			) -> std::vector<unsigned char>
 			{
 				static_assert(strict == true || strict == false, "strict must be true of false");
-				auto view = DataStreamView{data};
-				auto property = view.readBytes(static_cast<size_t>(LZMA_PROPS_SIZE));
-				assert_conditional(property.front() == 0x5D, fmt::format("{}", Language::get("lzma.uncompress.invalid_magic")), "uncompress");
-				//assert_conditional(view.readUint32() == 67108864, fmt::format("{}", Language::get("lzma.uncompress.invalid_props")), "uncompress");
-				auto destination_length = static_cast<std::size_t>(view.readInt64());
+				auto constexpr header_size = static_cast<std::size_t>(LZMA_PROPS_SIZE) + sizeof(std::int64_t);
+				assert_conditional(data.size() >= header_size, fmt::format("{}", Kernel::Language::get("lzma.uncompress.failed")), "uncompress");
+				assert_conditional(data.front() == 0x5D, fmt::format("{}", Language::get("lzma.uncompress.invalid_magic")), "uncompress");
+				auto destination_size = std::int64_t{};
+				std::memcpy(&destination_size, data.data() + LZMA_PROPS_SIZE, sizeof(std::int64_t));
+				auto destination_length = static_cast<std::size_t>(destination_size);
 				auto result = std::vector<unsigned char>(destination_length);
-				auto source_length = static_cast<size_t>(view.size() - view.read_pos);
+				auto source_length = data.size() - header_size;
 				auto ret = LzmaUncompress(
-					&result.front(),
+					result.data(),
 					&destination_length,
-					&data[view.read_pos],
+					data.data() + header_size,
 					&source_length,
-					&property.front(),
+					data.data(),
 					static_cast<size_t>(LZMA_PROPS_SIZE)
 				);
 				if constexpr (strict) {
@@ -118,6 +118,82 @@ namespace Sen::Kernel::Definition::Compression {
 				return result;
 			}
 
+			/**
+			 * Incremental zlib inflate into a caller buffer of known size
+			 * Input may arrive in any number of pieces, bytes after the end of the stream are ignored
+			 * Inflating stops once the buffer is full, so a prefix of the stream can be decoded
+			 */
+
+			class Inflate {
+
+				protected:
+
+					z_stream stream{};
+
+					bool finished{false};
+
+					// zlib rejects a null next_out even when nothing is written
+
+					unsigned char empty_output{};
+
+				public:
+
+					explicit Inflate(
+						std::span<unsigned char> destination
+					)
+					{
+						thiz.stream.zalloc = Z_NULL;
+						thiz.stream.zfree = Z_NULL;
+						thiz.stream.opaque = Z_NULL;
+						assert_conditional(inflateInit(&thiz.stream) == Z_OK, fmt::format("{}", Kernel::Language::get("zlib.uncompress.failed")), "Inflate");
+						thiz.stream.next_out = destination.empty() ? &thiz.empty_output : destination.data();
+						thiz.stream.avail_out = static_cast<uInt>(destination.size());
+					}
+
+					~Inflate(
+					)
+					{
+						inflateEnd(&thiz.stream);
+					}
+
+					Inflate(
+						Inflate const& that
+					) = delete;
+
+					auto operator =(
+						Inflate const& that
+					)->Inflate & = delete;
+
+					auto update(
+						std::span<unsigned char const> source
+					) -> void
+					{
+						if (thiz.finished || source.empty()) {
+							return;
+						}
+						thiz.stream.next_in = const_cast<Bytef*>(source.data());
+						thiz.stream.avail_in = static_cast<uInt>(source.size());
+						auto ret = inflate(&thiz.stream, Z_NO_FLUSH);
+						assert_conditional(ret == Z_OK || ret == Z_STREAM_END, fmt::format("{}", Kernel::Language::get("zlib.uncompress.failed")), "update");
+						thiz.finished = ret == Z_STREAM_END;
+						assert_conditional(thiz.finished || thiz.stream.avail_in == 0 || thiz.stream.avail_out == 0, fmt::format("{}", Kernel::Language::get("zlib.uncompress.failed")), "update");
+						return;
+					}
+
+					auto is_finished(
+					) const -> bool
+					{
+						return thiz.finished;
+					}
+
+					auto size(
+					) const -> std::size_t
+					{
+						return static_cast<std::size_t>(thiz.stream.total_out);
+					}
+
+			};
+
 			/**
 			 * data: the binary data to uncompress
 			 * return: the uncompressed data
@@ -126,6 +202,18 @@ namespace Sen::Kernel::Definition::Compression {
 			inline static auto uncompress_deflate(
 				const std::vector<unsigned char> &data
 			) -> std::vector<unsigned char>
+			{
+				return uncompress_deflate(std::span<unsigned char const>{data.data(), data.size()});
+			}
+
+			/**
+			 * data: view of the raw deflate stream, may point into a larger buffer
+			 * return: the uncompressed data
+			 */
+			
+			inline static auto uncompress_deflate(
+				std::span<unsigned char const> data
+			) -> std::vector<unsigned char>
 			{
 				auto zlib_init = z_stream {
 					.next_in = const_cast<Bytef*>(data.data()),
@@ -4,6 +4,8 @@
 #include "kernel/definition/library.hpp"
 #include "kernel/definition/macro.hpp"
 #include "kernel/definition/basic/filesystem.hpp"
+#include "kernel/definition/basic/path.hpp"
+#include "kernel/definition/basic/buffer.hpp"
 
 namespace Sen::Kernel::Definition::Diff {
 
@@ -42,6 +44,325 @@ namespace Sen::Kernel::Definition::Diff {
 
 			) = default;
 
+			/**
+			 * Decoder limits, a target larger than these is rejected
+			*/
+
+			struct Limit {
+				std::size_t target_file_size;
+				std::size_t target_window_size;
+			};
+
+			inline static constexpr auto k_default_limit = Limit{
+				.target_file_size = 332873785_size, // 325MB
+				.target_window_size = 332873785_size, // 325MB
+			};
+
+			/**
+			 * Output sink appending to a byte vector
+			*/
+
+			class VectorOutput : public open_vcdiff::OutputStringInterface {
+
+				protected:
+
+					std::vector<unsigned char> & value;
+
+				public:
+
+					explicit VectorOutput(
+						std::vector<unsigned char> & value
+					) : value(value)
+					{
+					}
+
+					auto append(
+						const char* s,
+						std::size_t n
+					) -> VectorOutput & override
+					{
+						thiz.value.insert(thiz.value.end(), reinterpret_cast<unsigned char const*>(s), reinterpret_cast<unsigned char const*>(s) + n);
+						return thiz;
+					}
+
+					auto clear(
+					) -> void override
+					{
+						thiz.value.clear();
+						return;
+					}
+
+					auto push_back(
+						char c
+					) -> void override
+					{
+						thiz.value.emplace_back(static_cast<unsigned char>(c));
+						return;
+					}
+
+					auto ReserveAdditionalBytes(
+						std::size_t res_arg
+					) -> void override
+					{
+						thiz.value.reserve(thiz.value.size() + res_arg);
+						return;
+					}
+
+					auto size(
+					) const -> std::size_t override
+					{
+						return thiz.value.size();
+					}
+
+			};
+
+			/**
+			 * Output sink writing at the write position of a DataStreamView
+			 * clear only rewinds to the position the sink was created at
+			*/
+
+			class StreamOutput : public open_vcdiff::OutputStringInterface {
+
+				protected:
+
+					DataStreamView & stream;
+
+					std::size_t begin;
+
+				public:
+
+					explicit StreamOutput(
+						DataStreamView & stream
+					) : stream(stream), begin(stream.write_pos)
+					{
+					}
+
+					auto append(
+						const char* s,
+						std::size_t n
+					) -> StreamOutput & override
+					{
+						thiz.stream.write_cursor(n).writeBytes(std::span<std::uint8_t const>{reinterpret_cast<std::uint8_t const*>(s), n});
+						return thiz;
+					}
+
+					auto clear(
+					) -> void override
+					{
+						thiz.stream.write_pos = thiz.begin;
+						return;
+					}
+
+					auto push_back(
+						char c
+					) -> void override
+					{
+						thiz.stream.writeUint8(static_cast<std::uint8_t>(c));
+						return;
+					}
+
+					auto ReserveAdditionalBytes(
+						std::size_t res_arg
+					) -> void override
+					{
+						thiz.stream.reserve_exact(thiz.stream.write_pos + res_arg);
+						return;
+					}
+
+					auto size(
+					) const -> std::size_t override
+					{
+						return thiz.stream.write_pos - thiz.begin;
+					}
+
+			};
+
+			/**
+			 * Output sink writing straight to a file, nothing is kept in memory
+			*/
+
+			class FileOutput : public open_vcdiff::OutputStringInterface {
+
+				protected:
+
+					struct Close {
+
+						auto operator ()(
+							FILE* file
+						) const -> void
+						{
+							if (file != nullptr) {
+								std::fclose(file);
+							}
+							return;
+						}
+
+					};
+
+					std::unique_ptr<FILE, Close> file;
+
+					std::string destination;
+
+					std::size_t length{0};
+
+					// "wb" truncates, so reopening is also how clear() drops what was written
+
+					auto open(
+					) -> void
+					{
+						thiz.file.reset();
+						#if WINDOWS
+						thiz.file.reset(_wfopen(String::utf8view_to_utf16(fmt::format("\\\\?\\{}", String::to_windows_style(thiz.destination))).data(), L"wb"));
+						#else
+						thiz.file.reset(std::fopen(String::to_posix_style(thiz.destination).data(), "wb"));
+						#endif
+						if (thiz.file == nullptr) {
+							throw Exception(fmt::format("{}: {}", Language::get("write_file_error"), String::to_posix_style(thiz.destination)), std::source_location::current(), "FileOutput");
+						}
+						thiz.length = 0;
+						return;
+					}
+
+				public:
+
+					explicit FileOutput(
+						std::string_view destination
+					) : file{nullptr}, destination(destination)
+					{
+						thiz.open();
+					}
+
+					/**
+					 * Flush and close the file, a write error still pending in the buffer is reported here
+					*/
+
+					auto close(
+					) -> void
+					{
+						auto file = thiz.file.release();
+						if (file != nullptr && std::fclose(file) != 0) {
+							throw Exception(fmt::format("{}: {}", Language::get("write_file_error"), String::to_posix_style(thiz.destination)), std::source_location::current(), "close");
+						}
+						return;
+					}
+
+					auto append(
+						const char* s,
+						std::size_t n
+					) -> FileOutput & override
+					{
+						if (std::fwrite(s, 1, n, thiz.file.get()) != n) {
+							throw Exception(fmt::format("{}: {}", Language::get("write_file_error"), String::to_posix_style(thiz.destination)), std::source_location::current(), "append");
+						}
+						thiz.length += n;
+						return thiz;
+					}
+
+					auto clear(
+					) -> void override
+					{
+						thiz.open();
+						return;
+					}
+
+					auto push_back(
+						char c
+					) -> void override
+					{
+						thiz.append(&c, 1);
+						return;
+					}
+
+					auto ReserveAdditionalBytes(
+						std::size_t
+					) -> void override
+					{
+						return;
+					}
+
+					auto size(
+					) const -> std::size_t override
+					{
+						return thiz.length;
+					}
+
+			};
+
+			/**
+			 * VCDiffEncoder only accepts string-like output, this forwards to a sink
+			*/
+
+			struct InterfaceOutput {
+
+				open_vcdiff::OutputStringInterface & value;
+
+				auto append(
+					const char* s,
+					std::size_t n
+				) -> void
+				{
+					thiz.value.append(s, n);
+					return;
+				}
+
+				auto clear(
+				) -> void
+				{
+					thiz.value.clear();
+					return;
+				}
+
+				auto push_back(
+					char c
+				) -> void
+				{
+					thiz.value.push_back(c);
+					return;
+				}
+
+				auto reserve(
+					std::size_t capacity
+				) -> void
+				{
+					if (capacity > thiz.value.size()) {
+						thiz.value.ReserveAdditionalBytes(capacity - thiz.value.size());
+					}
+					return;
+				}
+
+				auto size(
+				) const -> std::size_t
+				{
+					return thiz.value.size();
+				}
+
+			};
+
+			/**
+			 * Encode method
+			 * @param before: before buffer
+			 * @param after: after buffer
+			 * @param output: receive the encoded buffer
+			 * @param flag: encoder flag
+			*/
+
+			template <auto flag>
+			inline static auto encode(
+				std::span<std::uint8_t const> before,
+				std::span<std::uint8_t const> after,
+				open_vcdiff::OutputStringInterface & output
+			) -> void
+			{
+				static_assert(flag == open_vcdiff::VCDiffFormatExtensionFlagValues::VCD_FORMAT_CHECKSUM or flag == open_vcdiff::VCDiffFormatExtensionFlagValues::VCD_FORMAT_INTERLEAVED or open_vcdiff::VCDiffFormatExtensionFlagValues::VCD_FORMAT_JSON or open_vcdiff::VCDiffFormatExtensionFlagValues::VCD_STANDARD_FORMAT, "flag must be one of vcdiff supported format");
+				auto encoder = std::make_unique<open_vcdiff::VCDiffEncoder>(reinterpret_cast<const char*>(before.data()), before.size());
+				encoder->SetFormatFlags(static_cast<open_vcdiff::VCDiffFormatExtensionFlags>(flag));
+				auto output_string = InterfaceOutput{output};
+				if (!encoder->Encode(reinterpret_cast<const char*>(after.data()), after.size(), &output_string)) {
+					throw Exception(fmt::format("{}", Language::get("vcdiff.encode.failed")), std::source_location::current(), "encode");
+				}
+				return;
+			}
+
 			/**
 			 * Encode method
 			 * @param before: before buffer
@@ -59,14 +380,35 @@ namespace Sen::Kernel::Definition::Diff {
 				T after_size
 			) -> std::vector<unsigned char>
 			{
-				static_assert(flag == open_vcdiff::VCDiffFormatExtensionFlagValues::VCD_FORMAT_CHECKSUM or flag == open_vcdiff::VCDiffFormatExtensionFlagValues::VCD_FORMAT_INTERLEAVED or open_vcdiff::VCDiffFormatExtensionFlagValues::VCD_FORMAT_JSON or open_vcdiff::VCDiffFormatExtensionFlagValues::VCD_STANDARD_FORMAT, "flag must be one of vcdiff supported format");
-				auto encoding = std::string{};
-				auto encoder = std::make_unique<open_vcdiff::VCDiffEncoder>(before, before_size);
-				encoder->SetFormatFlags(static_cast<open_vcdiff::VCDiffFormatExtensionFlags>(flag));
-				if (!encoder->Encode(after, after_size, &encoding)) {
-					throw Exception(fmt::format("{}", Language::get("vcdiff.encode.failed")), std::source_location::current(), "encode");
+				auto encoding = std::vector<unsigned char>{};
+				auto output = VectorOutput{encoding};
+				VCDiff::encode<flag>(std::span<std::uint8_t const>{reinterpret_cast<std::uint8_t const*>(before), static_cast<std::size_t>(before_size)}, std::span<std::uint8_t const>{reinterpret_cast<std::uint8_t const*>(after), static_cast<std::size_t>(after_size)}, output);
+				return encoding;
+			}
+
+			/**
+			 * Decode method
+			 * @param before: before buffer
+			 * @param patch: patch buffer
+			 * @param output: receive the decoded buffer
+			 * @param limit: decoder limits
+			*/
+
+			inline static auto decode(
+				std::span<std::uint8_t const> before,
+				std::span<std::uint8_t const> patch,
+				open_vcdiff::OutputStringInterface & output,
+				Limit const & limit = k_default_limit
+			) -> void
+			{
+				auto decoder = std::make_unique<open_vcdiff::VCDiffStreamingDecoder>();
+				decoder->SetMaximumTargetFileSize(limit.target_file_size);
+				decoder->SetMaximumTargetWindowSize(limit.target_window_size);
+				decoder->StartDecoding(reinterpret_cast<const char*>(before.data()), before.size());
+				if (!decoder->DecodeChunkToInterface(reinterpret_cast<const char*>(patch.data()), patch.size(), &output) || !decoder->FinishDecoding()) {
+					throw Exception(fmt::format("{}", Language::get("vcdiff.decode.failed")), std::source_location::current(), "decode");
 				}
-				return std::vector<unsigned char>(encoding.begin(), encoding.end());
+				return;
 			}
 
 			/**
@@ -75,7 +417,6 @@ namespace Sen::Kernel::Definition::Diff {
 			 * @param before_size: buffer size
 			 * @param patch: after buffer
 			 * @param patch_size: buffer size
-			 * @param flag: encoder flag
 			 * @returns: decoded buffer
 			*/
 
@@ -87,15 +428,40 @@ namespace Sen::Kernel::Definition::Diff {
 				T patch_size
 			) -> std::vector<unsigned char>
 			{
-				auto decoded_data = std::string{};
+				auto decoded_data = std::vector<unsigned char>{};
+				auto output = VectorOutput{decoded_data};
+				VCDiff::decode(std::span<std::uint8_t const>{reinterpret_cast<std::uint8_t const*>(before), static_cast<std::size_t>(before_size)}, std::span<std::uint8_t const>{reinterpret_cast<std::uint8_t const*>(patch), static_cast<std::size_t>(patch_size)}, output);
+				return decoded_data;
+			}
+
+			/**
+			 * Decode a patch file block by block
+			 * @param before: before buffer, must stay valid until the call returns
+			 * @param patch_file: patch file, only one block is held in memory
+			 * @param output: receive the decoded buffer
+			 * @param limit: decoder limits
+			*/
+
+			inline static auto decode_stream(
+				std::span<std::uint8_t const> before,
+				std::string_view patch_file,
+				open_vcdiff::OutputStringInterface & output,
+				Limit const & limit = k_default_limit
+			) -> void
+			{
 				auto decoder = std::make_unique<open_vcdiff::VCDiffStreamingDecoder>();
-				decoder->SetMaximumTargetFileSize(332873785_size); // 325MB
-				decoder->SetMaximumTargetWindowSize(332873785_size); //  325MB
-				decoder->StartDecoding(before, before_size);
-				if (!decoder->DecodeChunk(patch, patch_size, &decoded_data)) {
-					throw Exception(fmt::format("{}", Language::get("vcdiff.decode.failed")), std::source_location::current(), "decode");
+				decoder->SetMaximumTargetFileSize(limit.target_file_size);
+				decoder->SetMaximumTargetWindowSize(limit.target_window_size);
+				decoder->StartDecoding(reinterpret_cast<const char*>(before.data()), before.size());
+				FileSystem::read_chunk(patch_file, FileSystem::k_chunk_size, [&](std::span<std::uint8_t const> block) {
+					if (!decoder->DecodeChunkToInterface(reinterpret_cast<const char*>(block.data()), block.size(), &output)) {
+						throw Exception(fmt::format("{}", Language::get("vcdiff.decode.failed")), std::source_location::current(), "decode_stream");
+					}
+				});
+				if (!decoder->FinishDecoding()) {
+					throw Exception(fmt::format("{}", Language::get("vcdiff.decode.failed")), std::source_location::current(), "decode_stream");
 				}
-				return std::vector<unsigned char>(decoded_data.data(), decoded_data.data() + decoded_data.size());
+				return;
 			}
 
 			/**
@@ -141,6 +507,8 @@ namespace Sen::Kernel::Definition::Diff {
 
 			/**
 			 * VCDiff decode file method
+			 * The result is written next to after_file and renamed over it once decoding succeeds,
+			 * a failed decode leaves no partial file and after_file may be the before file
 			 * @param before_file: Before file
 			 * @param patch_file: Patch file
 			 * @param after_file: Output after file
@@ -149,12 +517,27 @@ namespace Sen::Kernel::Definition::Diff {
 			inline static auto decode_fs(
 				std::string_view before_file,
 				std::string_view patch_file,
-				std::string_view after_file
+				std::string_view after_file,
+				Limit const & limit = k_default_limit
 			) -> void
 			{
-				auto before = FileSystem::read_binary<char>(before_file);
-				auto patch = FileSystem::read_binary<char>(patch_file);
-				FileSystem::write_binary<unsigned char>(after_file, VCDiff::decode(before.data(), before.size(), patch.data(), patch.size()));
+				auto temporary_file = fmt::format("{}.tmp", after_file);
+				try {
+					auto before = FileSystem::MappedFile{before_file};
+					auto output = FileOutput{temporary_file};
+					VCDiff::decode_stream(before.view(), patch_file, output, limit);
+					output.close();
+				}
+				catch (...) {
+					auto error = std::error_code{};
+					#if WINDOWS
+					std::filesystem::remove(std::filesystem::path{String::utf8_to_utf16(temporary_file)}, error);
+					#else
+					std::filesystem::remove(std::filesystem::path{temporary_file}, error);
+					#endif
+					throw;
+				}
+				Path::Script::rename(temporary_file, after_file);
 				return;
 			}
 	};
@@ -3,6 +3,7 @@
 #include "kernel/definition/library.hpp"
 #include "kernel/definition/macro.hpp"
 #include "kernel/definition/assert.hpp"
+#include "kernel/definition/basic/cpu.hpp"
 #include "kernel/dependencies/Rijndael.hpp"
 
 namespace Sen::Kernel::Definition::Encryption 
@@ -33,6 +34,406 @@ namespace Sen::Kernel::Definition::Encryption
     			return block_size == 128 || block_size == 160 || block_size == 192 || block_size == 224 || block_size == 256;
 			}
 
+			// AES is Rijndael with a 128-bit block, only that block size has a hardware path
+
+			inline static constexpr auto k_aes_block_size = std::size_t{16};
+
+			inline static constexpr auto k_aes_maximum_round = std::size_t{14};
+
+			inline static constexpr auto k_sbox = []() {
+				auto box = std::array<std::uint8_t, 256>{};
+				auto rotate = [](std::uint8_t value, int shift) {
+					return static_cast<std::uint8_t>((value << shift) | (value >> (8 - shift)));
+				};
+				auto p = std::uint8_t{1};
+				auto q = std::uint8_t{1};
+				do {
+					p = static_cast<std::uint8_t>(p ^ (p << 1) ^ ((p & 0x80) != 0 ? 0x1B : 0x00));
+					q = static_cast<std::uint8_t>(q ^ (q << 1));
+					q = static_cast<std::uint8_t>(q ^ (q << 2));
+					q = static_cast<std::uint8_t>(q ^ (q << 4));
+					if ((q & 0x80) != 0) {
+						q = static_cast<std::uint8_t>(q ^ 0x09);
+					}
+					box[p] = static_cast<std::uint8_t>(q ^ rotate(q, 1) ^ rotate(q, 2) ^ rotate(q, 3) ^ rotate(q, 4) ^ 0x63);
+				} while (p != 1);
+				box[0] = 0x63;
+				return box;
+			}();
+
+			// round keys in FIPS-197 byte order, which is what AES-NI and ARMv8 expect
+
+			struct Schedule {
+				std::array<std::array<std::uint8_t, k_aes_block_size>, k_aes_maximum_round + 1> key;
+				std::size_t round;
+			};
+
+			inline static auto make_schedule(
+				std::string_view key
+			) -> Schedule
+			{
+				auto schedule = Schedule{};
+				auto key_word = key.size() / 4;
+				schedule.round = key_word + 6;
+				auto word = std::array<std::array<std::uint8_t, 4>, 4 * (k_aes_maximum_round + 1)>{};
+				std::memcpy(word.data(), key.data(), key.size());
+				auto rcon = std::uint8_t{1};
+				for (auto index = key_word; index < 4 * (schedule.round + 1); ++index) {
+					auto temporary = word[index - 1];
+					if (index % key_word == 0) {
+						temporary = {
+							static_cast<std::uint8_t>(k_sbox[temporary[1]] ^ rcon),
+							k_sbox[temporary[2]],
+							k_sbox[temporary[3]],
+							k_sbox[temporary[0]],
+						};
+						rcon = static_cast<std::uint8_t>((rcon << 1) ^ ((rcon & 0x80) != 0 ? 0x1B : 0x00));
+					}
+					else if (key_word > 6 && index % key_word == 4) {
+						for (auto & element : temporary) {
+							element = k_sbox[element];
+						}
+					}
+					for (auto byte_index : Range<std::size_t>(4)) {
+						word[index][byte_index] = static_cast<std::uint8_t>(word[index - key_word][byte_index] ^ temporary[byte_index]);
+					}
+				}
+				std::memcpy(schedule.key.data(), word.data(), 4 * 4 * (schedule.round + 1));
+				return schedule;
+			}
+
+			inline static auto is_accelerated(
+				std::size_t block_size
+			) -> bool
+			{
+				if (block_size != k_aes_block_size) {
+					return false;
+				}
+				#if defined M_CPU_X86_64
+				return CPU::feature().aes;
+				#elif defined M_CPU_ARM64_AES
+				return true;
+				#else
+				return false;
+				#endif
+			}
+
+			#if defined M_CPU_X86_64
+
+			M_TARGET_AES inline static auto encrypt_block(
+				__m128i block,
+				__m128i const* key,
+				std::size_t round
+			) -> __m128i
+			{
+				block = _mm_xor_si128(block, key[0]);
+				for (auto index = std::size_t{1}; index < round; ++index) {
+					block = _mm_aesenc_si128(block, key[index]);
+				}
+				return _mm_aesenclast_si128(block, key[round]);
+			}
+
+			M_TARGET_AES inline static auto decrypt_block(
+				__m128i block,
+				__m128i const* key,
+				std::size_t round
+			) -> __m128i
+			{
+				block = _mm_xor_si128(block, key[0]);
+				for (auto index = std::size_t{1}; index < round; ++index) {
+					block = _mm_aesdec_si128(block, key[index]);
+				}
+				return _mm_aesdeclast_si128(block, key[round]);
+			}
+
+			M_TARGET_AES inline static auto decrypt_block_4(
+				__m128i (&block)[4],
+				__m128i const* key,
+				std::size_t round
+			) -> void
+			{
+				for (auto & element : block) {
+					element = _mm_xor_si128(element, key[0]);
+				}
+				for (auto index = std::size_t{1}; index < round; ++index) {
+					for (auto & element : block) {
+						element = _mm_aesdec_si128(element, key[index]);
+					}
+				}
+				for (auto & element : block) {
+					element = _mm_aesdeclast_si128(element, key[round]);
+				}
+				return;
+			}
+
+			M_TARGET_AES inline static auto encrypt_block_4(
+				__m128i (&block)[4],
+				__m128i const* key,
+				std::size_t round
+			) -> void
+			{
+				for (auto & element : block) {
+					element = _mm_xor_si128(element, key[0]);
+				}
+				for (auto index = std::size_t{1}; index < round; ++index) {
+					for (auto & element : block) {
+						element = _mm_aesenc_si128(element, key[index]);
+					}
+				}
+				for (auto & element : block) {
+					element = _mm_aesenclast_si128(element, key[round]);
+				}
+				return;
+			}
+
+			template <auto mode>
+			M_TARGET_AES inline static auto encrypt_accelerated(
+				Schedule const & schedule,
+				std::uint8_t const* source,
+				std::uint8_t* destination,
+				std::size_t size,
+				std::uint8_t const* iv
+			) -> void
+			{
+				alignas(16) __m128i key[k_aes_maximum_round + 1];
+				for (auto index : Range<std::size_t>(schedule.round + 1)) {
+					key[index] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(schedule.key[index].data()));
+				}
+				auto chain = _mm_loadu_si128(reinterpret_cast<__m128i const*>(iv));
+				auto offset = std::size_t{0};
+				if constexpr (mode == Mode::ECB) {
+					for (; offset + 4 * k_aes_block_size <= size; offset += 4 * k_aes_block_size) {
+						__m128i block[4];
+						for (auto index : Range<std::size_t>(4)) {
+							block[index] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + offset + index * k_aes_block_size));
+						}
+						encrypt_block_4(block, key, schedule.round);
+						for (auto index : Range<std::size_t>(4)) {
+							_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + offset + index * k_aes_block_size), block[index]);
+						}
+					}
+				}
+				for (; offset < size; offset += k_aes_block_size) {
+					auto block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + offset));
+					if constexpr (mode == Mode::ECB) {
+						block = encrypt_block(block, key, schedule.round);
+					}
+					if constexpr (mode == Mode::CBC) {
+						chain = encrypt_block(_mm_xor_si128(chain, block), key, schedule.round);
+						block = chain;
+					}
+					if constexpr (mode == Mode::CFB) {
+						chain = _mm_xor_si128(encrypt_block(chain, key, schedule.round), block);
+						block = chain;
+					}
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + offset), block);
+				}
+				return;
+			}
+
+			template <auto mode>
+			M_TARGET_AES inline static auto decrypt_accelerated(
+				Schedule const & schedule,
+				std::uint8_t const* source,
+				std::uint8_t* destination,
+				std::size_t size,
+				std::uint8_t const* iv
+			) -> void
+			{
+				alignas(16) __m128i key[k_aes_maximum_round + 1];
+				for (auto index : Range<std::size_t>(schedule.round + 1)) {
+					key[index] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(schedule.key[index].data()));
+				}
+				// CFB only runs the cipher forward, the others need the inverse key schedule
+				if constexpr (mode != Mode::CFB) {
+					std::reverse(key, key + schedule.round + 1);
+					for (auto index = std::size_t{1}; index < schedule.round; ++index) {
+						key[index] = _mm_aesimc_si128(key[index]);
+					}
+				}
+				auto chain = _mm_loadu_si128(reinterpret_cast<__m128i const*>(iv));
+				auto offset = std::size_t{0};
+				for (; offset + 4 * k_aes_block_size <= size; offset += 4 * k_aes_block_size) {
+					__m128i cipher[4];
+					__m128i block[4];
+					for (auto index : Range<std::size_t>(4)) {
+						cipher[index] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + offset + index * k_aes_block_size));
+					}
+					if constexpr (mode == Mode::CFB) {
+						block[0] = chain;
+						block[1] = cipher[0];
+						block[2] = cipher[1];
+						block[3] = cipher[2];
+						encrypt_block_4(block, key, schedule.round);
+					}
+					else {
+						std::copy(std::begin(cipher), std::end(cipher), std::begin(block));
+						decrypt_block_4(block, key, schedule.round);
+					}
+					if constexpr (mode == Mode::CBC) {
+						block[0] = _mm_xor_si128(block[0], chain);
+						block[1] = _mm_xor_si128(block[1], cipher[0]);
+						block[2] = _mm_xor_si128(block[2], cipher[1]);
+						block[3] = _mm_xor_si128(block[3], cipher[2]);
+					}
+					if constexpr (mode == Mode::CFB) {
+						for (auto index : Range<std::size_t>(4)) {
+							block[index] = _mm_xor_si128(block[index], cipher[index]);
+						}
+					}
+					chain = cipher[3];
+					for (auto index : Range<std::size_t>(4)) {
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + offset + index * k_aes_block_size), block[index]);
+					}
+				}
+				for (; offset < size; offset += k_aes_block_size) {
+					auto cipher = _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + offset));
+					auto block = __m128i{};
+					if constexpr (mode == Mode::ECB) {
+						block = decrypt_block(cipher, key, schedule.round);
+					}
+					if constexpr (mode == Mode::CBC) {
+						block = _mm_xor_si128(decrypt_block(cipher, key, schedule.round), chain);
+					}
+					if constexpr (mode == Mode::CFB) {
+						block = _mm_xor_si128(encrypt_block(chain, key, schedule.round), cipher);
+					}
+					chain = cipher;
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + offset), block);
+				}
+				return;
+			}
+
+			#elif defined M_CPU_ARM64_AES
+
+			inline static auto encrypt_block(
+				uint8x16_t block,
+				uint8x16_t const* key,
+				std::size_t round
+			) -> uint8x16_t
+			{
+				for (auto index = std::size_t{0}; index + 1 < round; ++index) {
+					block = vaesmcq_u8(vaeseq_u8(block, key[index]));
+				}
+				return veorq_u8(vaeseq_u8(block, key[round - 1]), key[round]);
+			}
+
+			inline static auto decrypt_block(
+				uint8x16_t block,
+				uint8x16_t const* key,
+				std::size_t round
+			) -> uint8x16_t
+			{
+				for (auto index = std::size_t{0}; index + 1 < round; ++index) {
+					block = vaesimcq_u8(vaesdq_u8(block, key[index]));
+				}
+				return veorq_u8(vaesdq_u8(block, key[round - 1]), key[round]);
+			}
+
+			template <auto mode>
+			inline static auto encrypt_accelerated(
+				Schedule const & schedule,
+				std::uint8_t const* source,
+				std::uint8_t* destination,
+				std::size_t size,
+				std::uint8_t const* iv
+			) -> void
+			{
+				alignas(16) uint8x16_t key[k_aes_maximum_round + 1];
+				for (auto index : Range<std::size_t>(schedule.round + 1)) {
+					key[index] = vld1q_u8(schedule.key[index].data());
+				}
+				auto chain = vld1q_u8(iv);
+				for (auto offset = std::size_t{0}; offset < size; offset += k_aes_block_size) {
+					auto block = vld1q_u8(source + offset);
+					if constexpr (mode == Mode::ECB) {
+						block = encrypt_block(block, key, schedule.round);
+					}
+					if constexpr (mode == Mode::CBC) {
+						chain = encrypt_block(veorq_u8(chain, block), key, schedule.round);
+						block = chain;
+					}
+					if constexpr (mode == Mode::CFB) {
+						chain = veorq_u8(encrypt_block(chain, key, schedule.round), block);
+						block = chain;
+					}
+					vst1q_u8(destination + offset, block);
+				}
+				return;
+			}
+
+			template <auto mode>
+			inline static auto decrypt_accelerated(
+				Schedule const & schedule,
+				std::uint8_t const* source,
+				std::uint8_t* destination,
+				std::size_t size,
+				std::uint8_t const* iv
+			) -> void
+			{
+				alignas(16) uint8x16_t key[k_aes_maximum_round + 1];
+				for (auto index : Range<std::size_t>(schedule.round + 1)) {
+					key[index] = vld1q_u8(schedule.key[index].data());
+				}
+				if constexpr (mode != Mode::CFB) {
+					std::reverse(key, key + schedule.round + 1);
+					for (auto index = std::size_t{1}; index < schedule.round; ++index) {
+						key[index] = vaesimcq_u8(key[index]);
+					}
+				}
+				auto chain = vld1q_u8(iv);
+				for (auto offset = std::size_t{0}; offset < size; offset += k_aes_block_size) {
+					auto cipher = vld1q_u8(source + offset);
+					auto block = uint8x16_t{};
+					if constexpr (mode == Mode::ECB) {
+						block = decrypt_block(cipher, key, schedule.round);
+					}
+					if constexpr (mode == Mode::CBC) {
+						block = veorq_u8(decrypt_block(cipher, key, schedule.round), chain);
+					}
+					if constexpr (mode == Mode::CFB) {
+						block = veorq_u8(encrypt_block(chain, key, schedule.round), cipher);
+					}
+					chain = cipher;
+					vst1q_u8(destination + offset, block);
+				}
+				return;
+			}
+
+			#endif
+
+			// CRijndael reads each input block after writing the output block in some modes, so aliased buffers go one block at a time
+
+			template <auto mode, auto is_encrypt>
+			inline static auto process_generic(
+				std::span<std::uint8_t const> source,
+				std::span<std::uint8_t> destination,
+				std::string_view key,
+				std::string_view iv
+			) -> void
+			{
+				auto rijndael = std::make_unique<CRijndael>();
+				rijndael->MakeKey(key.data(), iv.data(), static_cast<int>(key.size()), static_cast<int>(iv.size()));
+				auto process_block = [&](char const* input, char* output, std::size_t size) {
+					if constexpr (is_encrypt) {
+						rijndael->Encrypt(input, output, size, static_cast<int>(mode));
+					}
+					else {
+						rijndael->Decrypt(input, output, size, static_cast<int>(mode));
+					}
+				};
+				if (source.data() != destination.data()) {
+					process_block(reinterpret_cast<char const*>(source.data()), reinterpret_cast<char*>(destination.data()), source.size());
+					return;
+				}
+				auto block = std::array<char, 32>{};
+				for (auto offset = std::size_t{0}; offset < source.size(); offset += iv.size()) {
+					std::memcpy(block.data(), source.data() + offset, iv.size());
+					process_block(block.data(), reinterpret_cast<char*>(destination.data() + offset), iv.size());
+				}
+				return;
+			}
+
 		public:
 
 			Rijndael(
@@ -51,6 +452,38 @@ namespace Sen::Kernel::Definition::Encryption
 				CFB,
 			};
 
+			/**
+			 * @param plain: plain buffer
+			 * @param destination: encrypted buffer, same size as plain, may be plain itself
+			 * @param key: key
+			 * @param iv: iv
+			 * @param mode: rijndael mode
+			*/
+
+			template <auto mode>
+			inline static auto encrypt(
+				std::span<std::uint8_t const> plain,
+				std::span<std::uint8_t> destination,
+				std::string_view key,
+				std::string_view iv
+			) -> void
+			{
+				static_assert(mode == Mode::CBC || mode == Mode::CFB || mode == Mode::ECB, "mode is invalid, expected cbc, cfb or ecb");
+				assert_conditional(is_valid_block_size<std::size_t>(key.size() * 8), fmt::format("{}", Language::get("rijndael.key_size_is_not_valid")), "encrypt");
+				assert_conditional(is_valid_block_size<std::size_t>(iv.size() * 8), fmt::format("{}", Language::get("rijndael.iv_size_is_not_valid")), "encrypt");
+				assert_conditional(is_padded_size<std::size_t>(key.size(), 32), fmt::format("{}", Language::get("rijndael.key_is_not_padded")), "encrypt");
+				assert_conditional(plain.size() != 0, fmt::format("{}", Language::get("rijndael.encrypt.plain_is_empty")), "encrypt");
+				assert_conditional(is_padded_size<std::size_t>(plain.size(), iv.size()) && destination.size() == plain.size(), fmt::format("{}", Language::get("rijndael.encrypt.plain_size_is_invalid_to_encrypt")), "encrypt");
+				#if defined M_CPU_X86_64 || defined M_CPU_ARM64_AES
+				if (is_accelerated(iv.size())) {
+					encrypt_accelerated<mode>(make_schedule(key), plain.data(), destination.data(), plain.size(), reinterpret_cast<std::uint8_t const*>(iv.data()));
+					return;
+				}
+				#endif
+				process_generic<mode, true>(plain, destination, key, iv);
+				return;
+			}
+
 			/**
 			 * @param plain: plain buffer
 			 * @param key: key
@@ -67,18 +500,42 @@ namespace Sen::Kernel::Definition::Encryption
 				std::string_view iv,
 				T plain_size
 			) -> std::vector<unsigned char>
+			{
+				auto result = std::vector<unsigned char>(static_cast<std::size_t>(plain_size));
+				encrypt<mode>(std::span<std::uint8_t const>{reinterpret_cast<std::uint8_t const*>(plain), static_cast<std::size_t>(plain_size)}, std::span<std::uint8_t>{result}, key, iv);
+				return result;
+			}
+
+			/**
+			 * @param cipher: cipher buffer
+			 * @param destination: decrypted buffer, same size as cipher, may be cipher itself
+			 * @param key: key
+			 * @param iv: iv
+			 * @param mode: rijndael mode
+			*/
+
+			template <auto mode>
+			inline static auto decrypt(
+				std::span<std::uint8_t const> cipher,
+				std::span<std::uint8_t> destination,
+				std::string_view key,
+				std::string_view iv
+			) -> void
 			{
 				static_assert(mode == Mode::CBC || mode == Mode::CFB || mode == Mode::ECB, "mode is invalid, expected cbc, cfb or ecb");
-				assert_conditional(is_valid_block_size<std::size_t>(key.size() * 8), fmt::format("{}", Language::get("rijndael.key_size_is_not_valid")), "encrypt");
-				assert_conditional(is_valid_block_size<std::size_t>(iv.size() * 8), fmt::format("{}", Language::get("rijndael.iv_size_is_not_valid")), "encrypt");
-				assert_conditional(is_padded_size<std::size_t>(key.size(), 32), fmt::format("{}", Language::get("rijndael.key_is_not_padded")), "encrypt");
-				assert_conditional(plain_size != 0, fmt::format("{}", Language::get("rijndael.encrypt.plain_is_empty")), "encrypt");
-				auto rijndael = std::make_shared<CRijndael>();
-				rijndael->MakeKey(key.data(), iv.data(), static_cast<int>(key.size()), static_cast<int>(iv.size()));
-				auto result = std::make_unique<char[]>(plain_size);
-				rijndael->Encrypt(plain, result.get(), plain_size, static_cast<int>(mode));
-				auto m_result = std::vector<unsigned char>{reinterpret_cast<unsigned char*>(result.get()), reinterpret_cast<unsigned char*>(result.get() + plain_size)};
-				return m_result;
+				assert_conditional(is_valid_block_size<std::size_t>(key.size() * 8), fmt::format("{}", Language::get("rijndael.key_size_is_not_valid")), "decrypt");
+				assert_conditional(is_valid_block_size<std::size_t>(iv.size() * 8), fmt::format("{}", Language::get("rijndael.iv_size_is_not_valid")), "decrypt");
+				assert_conditional(is_padded_size<std::size_t>(key.size(), 32), fmt::format("{}", Language::get("rijndael.key_is_not_padded")), "decrypt");
+				assert_conditional(cipher.size() != 0, fmt::format("{}", Language::get("rijndael.decrypt.cipher_is_empty")), "decrypt");
+				assert_conditional(is_padded_size<std::size_t>(cipher.size(), iv.size()) && destination.size() == cipher.size(), fmt::format("{}", Language::get("rijndael.decrypt.cipher_size_is_invalid_to_decrypt")), "decrypt");
+				#if defined M_CPU_X86_64 || defined M_CPU_ARM64_AES
+				if (is_accelerated(iv.size())) {
+					decrypt_accelerated<mode>(make_schedule(key), cipher.data(), destination.data(), cipher.size(), reinterpret_cast<std::uint8_t const*>(iv.data()));
+					return;
+				}
+				#endif
+				process_generic<mode, false>(cipher, destination, key, iv);
+				return;
 			}
 
 			/**
@@ -97,18 +554,9 @@ namespace Sen::Kernel::Definition::Encryption
 				T cipher_len
 			) -> std::vector<unsigned char>
 			{
-				static_assert(mode == Mode::CBC || mode == Mode::CFB || mode == Mode::ECB, "mode is invalid, expected cbc, cfb or ecb");
-				assert_conditional(is_valid_block_size<std::size_t>(key.size() * 8), fmt::format("{}", Language::get("rijndael.key_size_is_not_valid")), "decrypt");
-				assert_conditional(is_valid_block_size<std::size_t>(iv.size() * 8), fmt::format("{}", Language::get("rijndael.iv_size_is_not_valid")), "decrypt");
-				assert_conditional(is_padded_size<std::size_t>(key.size(), 32), fmt::format("{}", Language::get("rijndael.key_is_not_padded")), "decrypt");
-				assert_conditional(cipher_len != 0, fmt::format("{}", Language::get("rijndael.decrypt.cipher_is_empty")), "decrypt");
-				assert_conditional((iv.size() - ((cipher_len + iv.size() - 1) % iv.size() + 1)) == 0, fmt::format("{}", Language::get("rijndael.decrypt.cipher_size_is_invalid_to_decrypt")), "decrypt");
-				auto rijndael = std::make_shared<CRijndael>();
-				rijndael->MakeKey(key.data(), iv.data(), static_cast<int>(key.size()), static_cast<int>(iv.size()));
-				auto result = std::make_unique<char[]>(cipher_len);
-				rijndael->Decrypt(cipher, result.get(), cipher_len, static_cast<int>(mode));
-				auto m_result = std::vector<unsigned char>{reinterpret_cast<unsigned char*>(result.get()), reinterpret_cast<unsigned char*>(result.get() + cipher_len)};
-				return m_result;
+				auto result = std::vector<unsigned char>(static_cast<std::size_t>(cipher_len));
+				decrypt<mode>(std::span<std::uint8_t const>{reinterpret_cast<std::uint8_t const*>(cipher), static_cast<std::size_t>(cipher_len)}, std::span<std::uint8_t>{result}, key, iv);
+				return result;
 			}
 
 			/**
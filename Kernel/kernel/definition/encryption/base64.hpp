@@ -4,6 +4,9 @@
 #include "kernel/definition/basic/filesystem.hpp"
 #include "kernel/definition/basic/path.hpp"
 #include "kernel/definition/macro.hpp"
+#include "kernel/definition/basic/cpu.hpp"
+#include "kernel/definition/basic/thread.hpp"
+#include <unordered_set>
 
 namespace Sen::Kernel::Definition::Encryption {
 
@@ -13,8 +16,421 @@ namespace Sen::Kernel::Definition::Encryption {
 
 	class Base64 {
 
+		protected:
+
+			inline static constexpr auto k_alphabet = std::string_view{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+
+			inline static constexpr auto k_invalid = std::uint8_t{0xFF};
+
+			// same leniency as cpp-base64, the url-safe '-' and '_' are accepted too
+
+			inline static constexpr auto k_decode_table = []() {
+				auto table = std::array<std::uint8_t, 256>{};
+				table.fill(k_invalid);
+				for (auto index = std::size_t{0}; index < k_alphabet.size(); ++index) {
+					table[static_cast<std::uint8_t>(k_alphabet[index])] = static_cast<std::uint8_t>(index);
+				}
+				table['-'] = 62;
+				table['_'] = 63;
+				return table;
+			}();
+
+			inline static constexpr auto is_padding(
+				char c
+			) -> bool
+			{
+				return c == '=' || c == '.';
+			}
+
+			inline static auto decode_character(
+				char c
+			) -> std::uint32_t
+			{
+				auto value = k_decode_table[static_cast<std::uint8_t>(c)];
+				if (value == k_invalid) {
+					throw Exception(fmt::format("{}", Language::get("base64.decode.invalid_data")), std::source_location::current(), "decode");
+				}
+				return value;
+			}
+
+
+			/**
+			 * Each encode_step_* handles whole groups while the wide loads stay inside the source
+			 * return: bytes consumed, a multiple of 3, consumed / 3 * 4 characters are written
+			 * Each decode_step_* stops before a block with a character outside the standard alphabet,
+			 * the scalar loop then decodes it or reports it, so both paths give the same bytes
+			 * return: characters consumed, a multiple of 4, consumed / 4 * 3 bytes are written
+			*/
+
+			#if defined M_CPU_X86_64
+
+			M_TARGET_SSSE3 inline static auto encode_step_ssse3(
+				std::uint8_t const* source,
+				std::size_t size,
+				char* destination
+			) -> std::size_t
+			{
+				auto index = std::size_t{0};
+				// 16 bytes are loaded, 12 are used
+				for (; index + 16 <= size; index += 12, destination += 16) {
+					auto value = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(source + index)), _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+					value = _mm_or_si128(
+						_mm_mulhi_epu16(_mm_and_si128(value, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040)),
+						_mm_mullo_epi16(_mm_and_si128(value, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010))
+					);
+					auto offset = _mm_subs_epu8(value, _mm_set1_epi8(51));
+					offset = _mm_sub_epi8(offset, _mm_cmpgt_epi8(value, _mm_set1_epi8(25)));
+					value = _mm_add_epi8(value, _mm_shuffle_epi8(_mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0), offset));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination), value);
+				}
+				return index;
+			}
+
+			M_TARGET_AVX2 inline static auto encode_step_avx2(
+				std::uint8_t const* source,
+				std::size_t size,
+				char* destination
+			) -> std::size_t
+			{
+				auto index = std::size_t{0};
+				// each lane loads 16 bytes and uses 12
+				for (; index + 28 <= size; index += 24, destination += 32) {
+					auto value = _mm256_set_m128i(_mm_loadu_si128(reinterpret_cast<__m128i const*>(source + index + 12)), _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + index)));
+					value = _mm256_shuffle_epi8(value, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1, 10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+					value = _mm256_or_si256(
+						_mm256_mulhi_epu16(_mm256_and_si256(value, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040)),
+						_mm256_mullo_epi16(_mm256_and_si256(value, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010))
+					);
+					auto offset = _mm256_subs_epu8(value, _mm256_set1_epi8(51));
+					offset = _mm256_sub_epi8(offset, _mm256_cmpgt_epi8(value, _mm256_set1_epi8(25)));
+					value = _mm256_add_epi8(value, _mm256_shuffle_epi8(_mm256_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0, 65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0), offset));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), value);
+				}
+				return index;
+			}
+
+			M_TARGET_SSSE3 inline static auto decode_step_ssse3(
+				char const* source,
+				std::size_t size,
+				std::uint8_t* destination,
+				std::size_t destination_size
+			) -> std::size_t
+			{
+				auto index = std::size_t{0};
+				auto position = std::size_t{0};
+				// 16 bytes are stored, 12 are kept
+				for (; index + 16 <= size && position + 16 <= destination_size; index += 16, position += 12) {
+					auto value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + index));
+					auto high_nibble = _mm_and_si128(_mm_srli_epi32(value, 4), _mm_set1_epi8(0x2F));
+					auto low_nibble = _mm_and_si128(value, _mm_set1_epi8(0x2F));
+					auto high = _mm_shuffle_epi8(_mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10), high_nibble);
+					auto low = _mm_shuffle_epi8(_mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A), low_nibble);
+					if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(low, high), _mm_setzero_si128())) != 0) {
+						break;
+					}
+					auto roll = _mm_shuffle_epi8(_mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0), _mm_add_epi8(_mm_cmpeq_epi8(value, _mm_set1_epi8(0x2F)), high_nibble));
+					value = _mm_add_epi8(value, roll);
+					value = _mm_madd_epi16(_mm_maddubs_epi16(value, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+					value = _mm_shuffle_epi8(value, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + position), value);
+				}
+				return index;
+			}
+
+			M_TARGET_AVX2 inline static auto decode_step_avx2(
+				char const* source,
+				std::size_t size,
+				std::uint8_t* destination,
+				std::size_t destination_size
+			) -> std::size_t
+			{
+				auto index = std::size_t{0};
+				auto position = std::size_t{0};
+				// 32 bytes are stored, 24 are kept
+				for (; index + 32 <= size && position + 32 <= destination_size; index += 32, position += 24) {
+					auto value = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(source + index));
+					auto high_nibble = _mm256_and_si256(_mm256_srli_epi32(value, 4), _mm256_set1_epi8(0x2F));
+					auto low_nibble = _mm256_and_si256(value, _mm256_set1_epi8(0x2F));
+					auto high = _mm256_shuffle_epi8(_mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10), high_nibble);
+					auto low = _mm256_shuffle_epi8(_mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A), low_nibble);
+					if (!_mm256_testz_si256(low, high)) {
+						break;
+					}
+					auto roll = _mm256_shuffle_epi8(_mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0), _mm256_add_epi8(_mm256_cmpeq_epi8(value, _mm256_set1_epi8(0x2F)), high_nibble));
+					value = _mm256_add_epi8(value, roll);
+					value = _mm256_madd_epi16(_mm256_maddubs_epi16(value, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+					value = _mm256_shuffle_epi8(value, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+					value = _mm256_permutevar8x32_epi32(value, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + position), value);
+				}
+				return index;
+			}
+
+			#elif defined M_CPU_ARM64
+
+			inline static auto encode_step_neon(
+				std::uint8_t const* source,
+				std::size_t size,
+				char* destination
+			) -> std::size_t
+			{
+				auto alphabet = uint8x16x4_t{};
+				for (auto part : Range(4_size)) {
+					alphabet.val[part] = vld1q_u8(reinterpret_cast<std::uint8_t const*>(k_alphabet.data()) + part * 16);
+				}
+				auto mask = vdupq_n_u8(0x3F);
+				auto index = std::size_t{0};
+				for (; index + 48 <= size; index += 48, destination += 64) {
+					auto value = vld3q_u8(source + index);
+					auto result = uint8x16x4_t{};
+					result.val[0] = vqtbl4q_u8(alphabet, vshrq_n_u8(value.val[0], 2));
+					result.val[1] = vqtbl4q_u8(alphabet, vandq_u8(vorrq_u8(vshlq_n_u8(value.val[0], 4), vshrq_n_u8(value.val[1], 4)), mask));
+					result.val[2] = vqtbl4q_u8(alphabet, vandq_u8(vorrq_u8(vshlq_n_u8(value.val[1], 2), vshrq_n_u8(value.val[2], 6)), mask));
+					result.val[3] = vqtbl4q_u8(alphabet, vandq_u8(value.val[2], mask));
+					vst4q_u8(reinterpret_cast<std::uint8_t*>(destination), result);
+				}
+				return index;
+			}
+
+			inline static auto decode_step_neon(
+				char const* source,
+				std::size_t size,
+				std::uint8_t* destination,
+				std::size_t destination_size
+			) -> std::size_t
+			{
+				// the first 128 entries of the scalar table, url-safe characters included
+				auto table_low = uint8x16x4_t{};
+				auto table_high = uint8x16x4_t{};
+				for (auto part : Range(4_size)) {
+					table_low.val[part] = vld1q_u8(k_decode_table.data() + part * 16);
+					table_high.val[part] = vld1q_u8(k_decode_table.data() + 64 + part * 16);
+				}
+				auto index = std::size_t{0};
+				auto position = std::size_t{0};
+				for (; index + 64 <= size && position + 48 <= destination_size; index += 64, position += 48) {
+					auto character = vld4q_u8(reinterpret_cast<std::uint8_t const*>(source + index));
+					auto value = uint8x16x4_t{};
+					auto invalid = vdupq_n_u8(0);
+					for (auto part : Range(4_size)) {
+						// out of range indices give 0, so exactly one lookup hits for a character under 128
+						value.val[part] = vorrq_u8(vqtbl4q_u8(table_low, character.val[part]), vqtbl4q_u8(table_high, veorq_u8(character.val[part], vdupq_n_u8(0x40))));
+						invalid = vorrq_u8(invalid, vorrq_u8(vcgeq_u8(character.val[part], vdupq_n_u8(0x80)), vceqq_u8(value.val[part], vdupq_n_u8(k_invalid))));
+					}
+					if (vmaxvq_u8(invalid) != 0) {
+						break;
+					}
+					auto result = uint8x16x3_t{};
+					result.val[0] = vorrq_u8(vshlq_n_u8(value.val[0], 2), vshrq_n_u8(value.val[1], 4));
+					result.val[1] = vorrq_u8(vshlq_n_u8(value.val[1], 4), vshrq_n_u8(value.val[2], 2));
+					result.val[2] = vorrq_u8(vshlq_n_u8(value.val[2], 6), value.val[3]);
+					vst3q_u8(destination + position, result);
+				}
+				return index;
+			}
+
+			#endif
+
+			inline static auto encode_step(
+				std::uint8_t const* source,
+				std::size_t size,
+				char* destination
+			) -> std::size_t
+			{
+				#if defined M_CPU_X86_64
+				if (CPU::feature().avx2) {
+					return encode_step_avx2(source, size, destination);
+				}
+				if (CPU::feature().ssse3) {
+					return encode_step_ssse3(source, size, destination);
+				}
+				return 0_size;
+				#elif defined M_CPU_ARM64
+				return encode_step_neon(source, size, destination);
+				#else
+				return 0_size;
+				#endif
+			}
+
+			inline static auto decode_step(
+				char const* source,
+				std::size_t size,
+				std::uint8_t* destination,
+				std::size_t destination_size
+			) -> std::size_t
+			{
+				#if defined M_CPU_X86_64
+				if (CPU::feature().avx2) {
+					return decode_step_avx2(source, size, destination, destination_size);
+				}
+				if (CPU::feature().ssse3) {
+					return decode_step_ssse3(source, size, destination, destination_size);
+				}
+				return 0_size;
+				#elif defined M_CPU_ARM64
+				return decode_step_neon(source, size, destination, destination_size);
+				#else
+				return 0_size;
+				#endif
+			}
+
+			// Input window of the file codecs, whole 3 byte and 4 character groups so only the last window is partial
+
+			inline static constexpr auto k_window_size = 0xC0000_size;
+
+			inline static auto open_destination(
+				std::string_view destination
+			) -> FileSystem::FileHandler
+			{
+				auto parent = Path::getParents(std::string{destination});
+				if (!parent.empty()) {
+					FileSystem::create_directory(parent);
+				}
+				return FileSystem::FileHandler{destination, "wb"};
+			}
+
+			// a short write means the destination could not take the whole output
+
+			inline static auto write_data(
+				FileSystem::FileHandler & file,
+				std::string_view destination,
+				void const* data,
+				std::size_t size
+			) -> void
+			{
+				assert_conditional(std::fwrite(data, 1_size, size, file.file.get()) == size, fmt::format("{}: {}", Language::get("write_file_error"), String::to_posix_style(std::string{destination})), "write_data");
+				return;
+			}
+
+			inline static auto flush_data(
+				FileSystem::FileHandler & file,
+				std::string_view destination
+			) -> void
+			{
+				assert_conditional(std::fflush(file.file.get()) == 0, fmt::format("{}: {}", Language::get("write_file_error"), String::to_posix_style(std::string{destination})), "flush_data");
+				return;
+			}
+
+			template <typename Callback>
+			inline static auto process_many_fs(
+				const std::vector<std::string> & source,
+				const std::vector<std::string> & destination,
+				std::size_t thread_count,
+				Callback && callback
+			) -> void
+			{
+				assert_conditional(source.size() == destination.size(), String::format(fmt::format("{}", Language::get("base64.source_destination_count_mismatch")), std::to_string(source.size()), std::to_string(destination.size())), "process_many_fs");
+				// two tasks writing the same file at once would interleave their output
+				auto destination_set = std::unordered_set<std::string>{};
+				for (const auto & element : destination) {
+					assert_conditional(destination_set.emplace(Path::Script::normalize(Path::Script::resolve(element))).second, String::format(fmt::format("{}", Language::get("base64.duplicate_destination")), element), "process_many_fs");
+				}
+				ThreadPool::parallel_for(source.size(), [&source, &destination, &callback](std::size_t index) {
+					callback(source[index], destination[index]);
+				}, thread_count);
+				return;
+			}
+
 		public:
 
+			/**
+			 * size: plain size
+			 * return: encoded size, padding included
+			*/
+
+			inline static constexpr auto encoded_size(
+				std::size_t size
+			) -> std::size_t
+			{
+				return (size + 2) / 3 * 4;
+			}
+
+			/**
+			 * message: encoded message
+			 * return: exact decoded size, padding and an unpadded tail are accounted for
+			*/
+
+			inline static auto decoded_size(
+				std::string_view message
+			) -> std::size_t
+			{
+				auto size = message.size();
+				while (size != 0 && message.size() - size < 2 && is_padding(message[size - 1])) {
+					--size;
+				}
+				return size / 4 * 3 + (size % 4 == 0 ? 0 : size % 4 - 1);
+			}
+
+			/**
+			 * Decode into a caller buffer, chunks must be cut on 4 characters
+			 * message: encoded message, only the last chunk may be padded
+			 * destination: at least decoded_size(message) bytes
+			 * return: written size
+			*/
+
+			inline static auto decode(
+				std::string_view message,
+				std::span<std::uint8_t> destination
+			) -> std::size_t
+			{
+				auto size = message.size();
+				while (size != 0 && message.size() - size < 2 && is_padding(message[size - 1])) {
+					--size;
+				}
+				assert_conditional(size % 4 != 1, fmt::format("{}", Language::get("base64.decode.invalid_data")), "decode");
+				auto index = decode_step(message.data(), size, destination.data(), destination.size());
+				auto position = index / 4 * 3;
+				for (; index + 4 <= size; index += 4) {
+					auto value = decode_character(message[index]) << 18 | decode_character(message[index + 1]) << 12 | decode_character(message[index + 2]) << 6 | decode_character(message[index + 3]);
+					destination[position++] = static_cast<std::uint8_t>(value >> 16);
+					destination[position++] = static_cast<std::uint8_t>(value >> 8);
+					destination[position++] = static_cast<std::uint8_t>(value);
+				}
+				if (index + 1 < size) {
+					auto value = decode_character(message[index]) << 18 | decode_character(message[index + 1]) << 12;
+					destination[position++] = static_cast<std::uint8_t>(value >> 16);
+					if (index + 2 < size) {
+						value |= decode_character(message[index + 2]) << 6;
+						destination[position++] = static_cast<std::uint8_t>(value >> 8);
+					}
+				}
+				return position;
+			}
+
+			/**
+			 * Encode into a caller buffer, chunks must be cut on 3 bytes
+			 * message: plain message, only the last chunk may have a partial group
+			 * destination: at least encoded_size(message.size()) characters
+			 * return: written size
+			*/
+
+			inline static auto encode(
+				std::span<std::uint8_t const> message,
+				std::span<char> destination
+			) -> std::size_t
+			{
+				auto index = encode_step(message.data(), message.size(), destination.data());
+				auto position = index / 3 * 4;
+				for (; index + 3 <= message.size(); index += 3) {
+					auto value = static_cast<std::uint32_t>(message[index]) << 16 | static_cast<std::uint32_t>(message[index + 1]) << 8 | static_cast<std::uint32_t>(message[index + 2]);
+					destination[position++] = k_alphabet[(value >> 18) & 0x3F];
+					destination[position++] = k_alphabet[(value >> 12) & 0x3F];
+					destination[position++] = k_alphabet[(value >> 6) & 0x3F];
+					destination[position++] = k_alphabet[value & 0x3F];
+				}
+				if (index < message.size()) {
+					auto value = static_cast<std::uint32_t>(message[index]) << 16;
+					if (index + 1 < message.size()) {
+						value |= static_cast<std::uint32_t>(message[index + 1]) << 8;
+					}
+					destination[position++] = k_alphabet[(value >> 18) & 0x3F];
+					destination[position++] = k_alphabet[(value >> 12) & 0x3F];
+					destination[position++] = index + 1 < message.size() ? k_alphabet[(value >> 6) & 0x3F] : '=';
+					destination[position++] = '=';
+				}
+				return position;
+			}
+
 			/**
 			 * Pass message to decode
 			*/
@@ -23,7 +439,9 @@ namespace Sen::Kernel::Definition::Encryption {
 				const std::string &message
 			) -> std::string const
 			{
-				return Sen::Kernel::Dependencies::Base64::base64_decode(message);
+				auto result = std::string(decoded_size(message), '\0');
+				decode(message, std::span<std::uint8_t>{reinterpret_cast<std::uint8_t*>(result.data()), result.size()});
+				return result;
 			}
 
 			/**
@@ -34,7 +452,7 @@ namespace Sen::Kernel::Definition::Encryption {
 				const std::string &message
 			) -> std::string const
 			{
-				return Sen::Kernel::Dependencies::Base64::base64_encode(message);
+				return encode(reinterpret_cast<unsigned char const*>(message.data()), message.size());
 			}
 
 			/**
@@ -46,11 +464,14 @@ namespace Sen::Kernel::Definition::Encryption {
 				std::size_t size
 			) -> std::string const
 			{
-				return Sen::Kernel::Dependencies::Base64::base64_encode(message, size);
+				auto result = std::string(encoded_size(size), '\0');
+				encode(std::span<std::uint8_t const>{message, size}, std::span<char>{result.data(), result.size()});
+				return result;
 			}
 
 			
 			/**
+			 * Streamed a window at a time, memory does not grow with the file
 			 * filePath: the file path to decode
 			 * outPath: output file
 			*/
@@ -60,11 +481,18 @@ namespace Sen::Kernel::Definition::Encryption {
 				std::string_view destination
 			) -> void
 			{
-				Sen::Kernel::FileSystem::write_file(destination, Sen::Kernel::Definition::Encryption::Base64::decode(Sen::Kernel::FileSystem::read_file(source)));
+				auto file = open_destination(destination);
+				auto buffer = std::vector<std::uint8_t>(k_window_size / 4 * 3);
+				FileSystem::read_chunk(source, k_window_size, [&](std::span<std::uint8_t const> chunk) {
+					auto size = decode(std::string_view{reinterpret_cast<char const*>(chunk.data()), chunk.size()}, buffer);
+					write_data(file, destination, buffer.data(), size);
+				});
+				flush_data(file, destination);
 				return;
 			}
 
 			/**
+			 * Streamed a window at a time, memory does not grow with the file
 			 * filePath: the file path to encode
 			 * outPath: output file
 			*/
@@ -74,53 +502,89 @@ namespace Sen::Kernel::Definition::Encryption {
 				std::string_view destination
 			) -> void
 			{
-				Sen::Kernel::FileSystem::write_file(destination, Sen::Kernel::Definition::Encryption::Base64::encode(Sen::Kernel::FileSystem::read_file(source)));
+				auto file = open_destination(destination);
+				auto buffer = std::vector<char>(encoded_size(k_window_size));
+				FileSystem::read_chunk(source, k_window_size, [&](std::span<std::uint8_t const> chunk) {
+					auto size = encode(chunk, buffer);
+					write_data(file, destination, buffer.data(), size);
+				});
+				flush_data(file, destination);
+				return;
+			}
+
+			/**
+			 * Encode every file on a bounded pool, each worker only holds one window
+			 * source: source files
+			 * destination: destination[i] is written from source[i]
+			 * thread_count: worker count, clamped to the hardware concurrency
+			*/
+
+			inline static auto encode_many_fs(
+				const std::vector<std::string> & source,
+				const std::vector<std::string> & destination,
+				std::size_t thread_count
+			) -> void
+			{
+				process_many_fs(source, destination, thread_count, [](std::string_view source, std::string_view destination) {
+					encode_fs(source, destination);
+				});
+				return;
+			}
+
+			/**
+			 * Decode every file on a bounded pool, each worker only holds one window
+			 * source: source files
+			 * destination: destination[i] is written from source[i]
+			 * thread_count: worker count, clamped to the hardware concurrency
+			*/
+
+			inline static auto decode_many_fs(
+				const std::vector<std::string> & source,
+				const std::vector<std::string> & destination,
+				std::size_t thread_count
+			) -> void
+			{
+				process_many_fs(source, destination, thread_count, [](std::string_view source, std::string_view destination) {
+					decode_fs(source, destination);
+				});
 				return;
 			}
 
 			/**
 			 * Process
+			 * paths: source and destination pairs
 			*/
 
 			inline static auto encode_fs_as_multiple_thread(
 				const std::vector<std::vector<std::string>> & paths
 			) -> void 
 			{
-				auto threads = std::vector<std::thread>{};
-				auto file_mutexes = std::unordered_map<std::string, std::mutex>{};
+				auto source = std::vector<std::string>{};
+				auto destination = std::vector<std::string>{};
 				for (const auto & data : paths) {
-					threads.emplace_back([=, &file_mutexes]() { 
-					auto lock_source = std::lock_guard<std::mutex>(file_mutexes[data[0]]);
-					auto lock_destination = std::lock_guard<std::mutex>(file_mutexes[data[1]]);
-						Base64::encode_fs(data[0], data[1]); 
-					});
-				}
-				for (auto & thread : threads) {
-					thread.join();
+					source.emplace_back(data[0]);
+					destination.emplace_back(data[1]);
 				}
+				encode_many_fs(source, destination, ThreadPool::default_thread_count());
 				return;
 			}
 
 			/**
 			 * Process
+			 * paths: source and destination pairs
 			*/
 
 			inline static auto decode_fs_as_multiple_thread(
 				const std::vector<std::vector<std::string>> & paths
 			) -> void 
 			{
-				auto threads = std::vector<std::thread>{};
-				auto file_mutexes = std::unordered_map<std::string, std::mutex>{};
+				auto source = std::vector<std::string>{};
+				auto destination = std::vector<std::string>{};
 				for (const auto & data : paths) {
-					threads.emplace_back([=, &file_mutexes]() { 
-					auto lock_source = std::lock_guard<std::mutex>(file_mutexes[data[0]]);
-					auto lock_destination = std::lock_guard<std::mutex>(file_mutexes[data[1]]);
-						Base64::decode_fs(data[0], data[1]); 
-					});
-				}
-				for (auto & thread : threads) {
-					thread.join();
+					source.emplace_back(data[0]);
+					destination.emplace_back(data[1]);
 				}
+				decode_many_fs(source, destination, ThreadPool::default_thread_count());
 				return;
 			}
 	};
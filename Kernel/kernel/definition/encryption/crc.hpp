@@ -3,9 +3,161 @@
 #include "kernel/definition/library.hpp"
 #include "kernel/definition/assert.hpp"
 #include "kernel/definition/macro.hpp"
+#include "kernel/definition/basic/cpu.hpp"
 
 namespace Sen::Kernel::Definition::Encryption {
 
+	/**
+	 * Hardware update of the reflected CRC-32 (0xEDB88320) and CRC-32C (0x82F63B78) state
+	 * x86-64 checks SSE4.2 and PCLMULQDQ at runtime, AArch64 uses the CRC extension when the target enables it
+	 * The state is the raw register, the caller keeps the initial and final xor
+	*/
+
+	namespace CRCHardware {
+
+		enum class Kind : std::uint8_t {
+			none,
+			crc32,
+			crc32c,
+		};
+
+		using Buffer = std::span<std::uint8_t const>;
+
+		#if defined M_CPU_X86_64
+
+		M_TARGET_SSE42 inline static auto crc32c_sse42(
+			std::uint32_t c,
+			Buffer buffer
+		) -> std::uint32_t
+		{
+			auto data = buffer.data();
+			auto size = buffer.size();
+			auto state = static_cast<std::uint64_t>(c);
+			for (; size >= 8; data += 8, size -= 8) {
+				auto value = std::uint64_t{};
+				std::memcpy(&value, data, sizeof(value));
+				state = _mm_crc32_u64(state, value);
+			}
+			c = static_cast<std::uint32_t>(state);
+			for (; size > 0; ++data, --size) {
+				c = _mm_crc32_u8(c, *data);
+			}
+			return c;
+		}
+
+		M_TARGET_CLMUL inline static auto crc32_clmul_fold(
+			__m128i x,
+			__m128i k,
+			__m128i next
+		) -> __m128i
+		{
+			return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x11), next), _mm_clmulepi64_si128(x, k, 0x00));
+		}
+
+		// Fold 64 bytes per round with carry-less multiply, then Barrett reduce, size must be a multiple of 16 and at least 64
+
+		M_TARGET_CLMUL inline static auto crc32_clmul(
+			std::uint32_t c,
+			Buffer buffer
+		) -> std::uint32_t
+		{
+			auto data = buffer.data();
+			auto size = buffer.size();
+			auto load = [](const std::uint8_t* source) {
+				return _mm_loadu_si128(reinterpret_cast<__m128i const*>(source));
+			};
+			auto x1 = _mm_xor_si128(load(data), _mm_cvtsi32_si128(static_cast<int>(c)));
+			auto x2 = load(data + 0x10);
+			auto x3 = load(data + 0x20);
+			auto x4 = load(data + 0x30);
+			auto k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+			data += 64;
+			size -= 64;
+			for (; size >= 64; data += 64, size -= 64) {
+				x1 = crc32_clmul_fold(x1, k1k2, load(data));
+				x2 = crc32_clmul_fold(x2, k1k2, load(data + 0x10));
+				x3 = crc32_clmul_fold(x3, k1k2, load(data + 0x20));
+				x4 = crc32_clmul_fold(x4, k1k2, load(data + 0x30));
+			}
+			auto k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+			x1 = crc32_clmul_fold(x1, k3k4, x2);
+			x1 = crc32_clmul_fold(x1, k3k4, x3);
+			x1 = crc32_clmul_fold(x1, k3k4, x4);
+			for (; size >= 16; data += 16, size -= 16) {
+				x1 = crc32_clmul_fold(x1, k3k4, load(data));
+			}
+			auto mask = _mm_setr_epi32(~0, 0, ~0, 0);
+			x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), _mm_clmulepi64_si128(x1, k3k4, 0x10));
+			x2 = _mm_srli_si128(x1, 4);
+			x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask), _mm_set_epi64x(0, 0x0163cd6124), 0x00), x2);
+			auto polynomial = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+			x2 = _mm_and_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask), polynomial, 0x10), mask);
+			x2 = _mm_clmulepi64_si128(x2, polynomial, 0x00);
+			x1 = _mm_xor_si128(x1, x2);
+			return static_cast<std::uint32_t>(_mm_extract_epi32(x1, 1));
+		}
+
+		#endif
+
+		#if defined M_CPU_ARM64 && defined __ARM_FEATURE_CRC32
+
+		template <Kind kind>
+		inline static auto crc32_arm(
+			std::uint32_t c,
+			Buffer buffer
+		) -> std::uint32_t
+		{
+			auto data = buffer.data();
+			auto size = buffer.size();
+			for (; size >= 8; data += 8, size -= 8) {
+				auto value = std::uint64_t{};
+				std::memcpy(&value, data, sizeof(value));
+				c = kind == Kind::crc32c ? __crc32cd(c, value) : __crc32d(c, value);
+			}
+			for (; size > 0; ++data, --size) {
+				c = kind == Kind::crc32c ? __crc32cb(c, *data) : __crc32b(c, *data);
+			}
+			return c;
+		}
+
+		#endif
+
+		/**
+		 * Advance the state with the hardware path
+		 * return: how many bytes of buffer were consumed, 0 when the CPU has no support
+		*/
+
+		template <Kind kind>
+		inline static auto update(
+			std::uint32_t & c,
+			Buffer buffer
+		) -> std::size_t
+		{
+			#if defined M_CPU_X86_64
+			if constexpr (kind == Kind::crc32c) {
+				if (CPU::feature().sse42) {
+					c = crc32c_sse42(c, buffer);
+					return buffer.size();
+				}
+			}
+			if constexpr (kind == Kind::crc32) {
+				if (buffer.size() >= 64 && CPU::feature().clmul) {
+					auto size = buffer.size() & ~static_cast<std::size_t>(15);
+					c = crc32_clmul(c, buffer.first(size));
+					return size;
+				}
+			}
+			#elif defined M_CPU_ARM64 && defined __ARM_FEATURE_CRC32
+			if constexpr (kind != Kind::none) {
+				c = crc32_arm<kind>(c, buffer);
+				return buffer.size();
+			}
+			#endif
+			return 0;
+		}
+
+	}
+
 	template <typename Polinomial> requires std::is_integral<Polinomial>::value
 	struct CRC {
 
@@ -14,11 +166,13 @@ namespace Sen::Kernel::Definition::Encryption {
 			using Type = Polinomial;
 
 		private:
-			using Buffer = std::vector<uint8_t>;
+			using Buffer = std::span<std::uint8_t const>;
 
 			template <typename T, auto size>
 			using ByteArray = std::array<T, size>;
 
+			using SliceTable = std::array<std::array<std::uint32_t, 256>, 8>;
+
 		protected:
 
 			inline static constexpr auto polynomial = static_cast<Polinomial>(0xEDB88320);
@@ -55,29 +209,62 @@ namespace Sen::Kernel::Definition::Encryption {
 				return;
 			}
 
+			// slice[k][i]: the state after byte i is followed by k zero bytes
+
 			template <typename T, auto size>
-			constexpr auto update (
-				const ByteArray<T, size> & table,
-				T initial, 
-				const Buffer & buffer
-			) -> T
+			static auto constexpr generate_slice_table(
+				const ByteArray<T, size> & table
+			) -> SliceTable
 			{
-				auto c = initial ^ 0xFFFFFFFF;
-				for (auto & e : buffer) {
-					c = table[(c ^ e) & 0xFF] ^ (c >> 8);
+				auto slice = SliceTable{};
+				for (auto i = 0_size; i < 256; ++i) {
+					slice[0][i] = static_cast<std::uint32_t>(table[i]);
 				}
-				return c ^ 0xFFFFFFFF;
+				for (auto k = 1_size; k < slice.size(); ++k) {
+					for (auto i = 0_size; i < 256; ++i) {
+						slice[k][i] = (slice[k - 1][i] >> 8) ^ slice[0][slice[k - 1][i] & 0xFF];
+					}
+				}
+				return slice;
 			}
 
-			template <typename P, typename T, auto size>
+			template <auto const & table>
+			inline static constexpr auto slice_table = generate_slice_table(table);
+
+			// Slice-by-8, same register as the byte loop so every variant keeps its result
+
+			static auto constexpr update(
+				const SliceTable & slice,
+				std::uint32_t c,
+				Buffer buffer
+			) -> std::uint32_t
+			{
+				auto index = 0_size;
+				for (; index + 8 <= buffer.size(); index += 8) {
+					auto low = c ^ (static_cast<std::uint32_t>(buffer[index]) | static_cast<std::uint32_t>(buffer[index + 1]) << 8 | static_cast<std::uint32_t>(buffer[index + 2]) << 16 | static_cast<std::uint32_t>(buffer[index + 3]) << 24);
+					c = slice[7][low & 0xFF] ^ slice[6][(low >> 8) & 0xFF] ^ slice[5][(low >> 16) & 0xFF] ^ slice[4][low >> 24] ^
+						slice[3][buffer[index + 4]] ^ slice[2][buffer[index + 5]] ^ slice[1][buffer[index + 6]] ^ slice[0][buffer[index + 7]];
+				}
+				for (; index < buffer.size(); ++index) {
+					c = slice[0][(c ^ buffer[index]) & 0xFF] ^ (c >> 8);
+				}
+				return c;
+			}
+
+			template <auto const & table, auto hardware = CRCHardware::Kind::none>
 			static auto constexpr compute (
-				const ByteArray<T, size> & table,
-				T initial, 
-				const Buffer & buffer
-			) -> T
+				Type initial,
+				Buffer buffer
+			) -> Type
 			{
-				auto crc = CRC<P>{};
-				return crc.template update<T, size>(table, initial, buffer);
+				auto c = static_cast<std::uint32_t>(initial ^ 0xFFFFFFFF);
+				if constexpr (hardware != CRCHardware::Kind::none) {
+					if (!std::is_constant_evaluated()) {
+						buffer = buffer.subspan(CRCHardware::update<hardware>(c, buffer));
+					}
+				}
+				c = update(slice_table<table>, c, buffer);
+				return static_cast<Type>(c ^ 0xFFFFFFFF);
 			}
 	};
 
@@ -96,10 +283,10 @@ namespace Sen::Kernel::Definition::Encryption {
 
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute<TABLE, CRCHardware::Kind::crc32>(initial, buffer);
 				}
 
 			
@@ -116,10 +303,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute<TABLE>(initial, buffer);
 				}
 
 		};
@@ -135,10 +322,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute<TABLE>(initial, buffer);
 				}
 
 		};
@@ -154,10 +341,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute<TABLE>(initial, buffer);
 				}
 
 		};
@@ -173,10 +360,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute<TABLE>(initial, buffer);
 				}
 
 		};
@@ -192,10 +379,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute<TABLE>(initial, buffer);
 				}
 
 		};
@@ -211,10 +398,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute<TABLE>(initial, buffer);
 				}
 
 		};
@@ -230,10 +417,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute<TABLE, CRCHardware::Kind::crc32c>(initial, buffer);
 				}
 
 		};
@@ -249,10 +436,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute<TABLE>(initial, buffer);
 				}
 
 		};
@@ -268,10 +455,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute<TABLE>(initial, buffer);
 				}
 
 		};
@@ -291,10 +478,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint8_t
 				{
-					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC8::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -308,10 +495,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint8_t
 				{
-					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC8::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -325,10 +512,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint8_t
 				{
-					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC8::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -342,10 +529,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint8_t
 				{
-					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC8::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -359,10 +546,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint8_t
 				{
-					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC8::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -376,10 +563,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint8_t
 				{
-					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC8::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -393,10 +580,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint8_t
 				{
-					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC8::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -410,10 +597,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint8_t
 				{
-					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC8::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -427,10 +614,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint8_t
 				{
-					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC8::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -444,10 +631,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint8_t
 				{
-					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC8::compute<TABLE>(initial, buffer);
 				}
 		};
 	}
@@ -466,10 +653,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -484,10 +671,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -502,10 +689,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -520,10 +707,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -538,10 +725,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -556,10 +743,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -574,10 +761,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -592,10 +779,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -610,10 +797,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -628,10 +815,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -646,10 +833,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -664,10 +851,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -682,10 +869,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -700,10 +887,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -718,10 +905,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -736,10 +923,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -754,10 +941,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -772,10 +959,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -790,10 +977,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -808,10 +995,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -826,10 +1013,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -844,10 +1031,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 
@@ -862,10 +1049,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<std::uint8_t const> buffer
 				) -> std::uint16_t
 				{
-					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC16::compute<TABLE>(initial, buffer);
 				}
 		};
 	}
@@ -70,8 +70,22 @@ namespace Sen::Kernel::Definition::Encryption::FNV {
 			) noexcept -> Hash::Type
 			{
 				auto value = Common::offset;
-				while (str != nullptr) {
-					value ^= *str++;
+				while (*str != '\0') {
+					value ^= static_cast<std::uint8_t>(*str++);
+					value *= Common::prime;
+				}
+				return value;
+			}
+
+			// Continue a hash with the next part of the data
+
+			static auto constexpr update (
+				Hash::Type value,
+				std::span<std::uint8_t const> data
+			) noexcept -> Hash::Type
+			{
+				for (auto c : data) {
+					value ^= c;
 					value *= Common::prime;
 				}
 				return value;
@@ -81,9 +95,11 @@ namespace Sen::Kernel::Definition::Encryption::FNV {
 				std::string_view source
 			) -> Hash::Type
 			{
-				auto hash = Hash<T>{};
-				auto destination = hash.make_hash(FileSystem::read_file(source).data());
-				return destination;
+				auto value = Common::offset;
+				FileSystem::read_chunk(source, FileSystem::k_chunk_size, [&](std::span<std::uint8_t const> block) {
+					value = Hash::update(value, block);
+				});
+				return value;
 			}
 	};
 	
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "kernel/definition/library.hpp"
+#include "kernel/definition/macro.hpp"
+#include "kernel/definition/basic/thread.hpp"
+#include "kernel/definition/encryption/md5.hpp"
+#include "kernel/definition/encryption/sha224.hpp"
+#include "kernel/definition/encryption/sha256.hpp"
+#include "kernel/definition/encryption/sha384.hpp"
+#include "kernel/definition/encryption/sha512.hpp"
+#include "kernel/definition/encryption/fnv.hpp"
+
+namespace Sen::Kernel::Definition::Encryption::Hash {
+
+	// Algorithm usable by hash_many_fs
+
+	enum class Algorithm : std::uint8_t {
+		md5,
+		sha224,
+		sha256,
+		sha384,
+		sha512,
+		fnv,
+	};
+
+	/**
+	 * name: md5, sha224, sha256, sha384, sha512 or fnv
+	 * return: the algorithm
+	*/
+
+	inline static auto to_algorithm(
+		std::string_view name
+	) -> Algorithm
+	{
+		if (name == "md5"_sv) {
+			return Algorithm::md5;
+		}
+		if (name == "sha224"_sv) {
+			return Algorithm::sha224;
+		}
+		if (name == "sha256"_sv) {
+			return Algorithm::sha256;
+		}
+		if (name == "sha384"_sv) {
+			return Algorithm::sha384;
+		}
+		if (name == "sha512"_sv) {
+			return Algorithm::sha512;
+		}
+		if (name == "fnv"_sv) {
+			return Algorithm::fnv;
+		}
+		throw Exception(String::format(fmt::format("{}", Language::get("invalid.argument")), std::string{name}), std::source_location::current(), "to_algorithm");
+	}
+
+	/**
+	 * source: source file
+	 * algorithm: hash algorithm
+	 * return: hashed string, fnv is written as 8 hex digits
+	*/
+
+	inline static auto hash_fs(
+		std::string_view source,
+		Algorithm algorithm
+	) -> std::string
+	{
+		switch (algorithm) {
+			case Algorithm::md5:
+				return MD5::hash_fs(source);
+			case Algorithm::sha224:
+				return Sha224::hash_fs(std::string{source});
+			case Algorithm::sha256:
+				return SHA256::hash_fs(std::string{source});
+			case Algorithm::sha384:
+				return SHA384::hash_fs(std::string{source});
+			case Algorithm::sha512:
+				return SHA512::hash_fs(std::string{source});
+			case Algorithm::fnv:
+				return fmt::format("{:08x}", FNV::Hash<std::uint32_t>::hash_fs(source));
+		}
+		return std::string{};
+	}
+
+	/**
+	 * Hash every file on a bounded pool, each worker only holds one read chunk
+	 * source: source files
+	 * algorithm: hash algorithm
+	 * thread_count: worker count, clamped to the hardware concurrency
+	 * return: hashed strings in the order of source
+	*/
+
+	inline static auto hash_many_fs(
+		const std::vector<std::string> & source,
+		Algorithm algorithm,
+		std::size_t thread_count
+	) -> std::vector<std::string>
+	{
+		auto result = std::vector<std::string>(source.size());
+		if (source.empty()) {
+			return result;
+		}
+		thread_count = std::clamp(thread_count, 1_size, ThreadPool::default_thread_count());
+		auto task = std::vector<std::future<std::string>>{};
+		task.reserve(source.size());
+		auto pool = ThreadPool{std::min(thread_count, source.size())};
+		for (auto & path : source) {
+			task.emplace_back(pool.enqueue([&path, algorithm]() {
+				return hash_fs(path, algorithm);
+			}));
+		}
+		for (auto index : Range<std::size_t>(task.size())) {
+			result[index] = task[index].get();
+		}
+		return result;
+	}
+
+}
@@ -33,9 +33,11 @@ namespace Sen::Kernel::Definition::Encryption::MD5
 		std::string_view source
 	) -> std::string
 	{
-		auto str = FileSystem::read_binary<unsigned char>(source);
-		auto result = Kernel::Definition::Encryption::MD5::hash(str);
-		return result;
+		auto md5 = Dependencies::md5::MD5{};
+		FileSystem::read_chunk(source, FileSystem::k_chunk_size, [&](std::span<std::uint8_t const> block) {
+			md5.update(block);
+		});
+		return md5.toStr();
 	}
 
 }
\ No newline at end of file
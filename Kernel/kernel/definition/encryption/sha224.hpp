@@ -28,7 +28,11 @@ namespace Sen::Kernel::Definition::Encryption::Sha224 {
 		const std::string & source
 	) -> std::string
 	{
-		return Sen::Kernel::Definition::Encryption::Sha224::hash(FileSystem::read_file(source));
+		auto sha224 = Dependencies::SHA224CryptoServiceProvider::sha224{};
+		FileSystem::read_chunk(source, FileSystem::k_chunk_size, [&](std::span<std::uint8_t const> block) {
+			sha224.Update(block.data(), block.size());
+		});
+		return sha224.FinalProcess();
 	}
 
 
@@ -33,7 +33,11 @@ namespace Sen::Kernel::Definition::Encryption::SHA256
 		const std::string & source
 	) -> std::string
 	{
-		return SHA256::hash(FileSystem::read_file(source));
+		auto sha = Sen::Kernel::Dependencies::SHA256::SHA256{};
+		FileSystem::read_chunk(source, FileSystem::k_chunk_size, [&](std::span<std::uint8_t const> block) {
+			sha.update(block.data(), block.size());
+		});
+		return Sen::Kernel::Dependencies::SHA256::SHA256::toString(sha.digest());
 	}
 
 
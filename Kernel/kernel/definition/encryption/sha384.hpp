@@ -2,6 +2,7 @@
 
 #include "kernel/definition/library.hpp"
 #include "kernel/definition/macro.hpp"
+#include "kernel/definition/encryption/sha512.hpp"
 
 namespace Sen::Kernel::Definition::Encryption {
 
@@ -32,7 +33,11 @@ namespace Sen::Kernel::Definition::Encryption {
 				const std::string & source
 			) -> std::string 
 			{
-				return SHA384::hash(FileSystem::read_file(source));
+				auto sha384 = SHA512Stream{SHA512Stream::sha384_state};
+				FileSystem::read_chunk(source, FileSystem::k_chunk_size, [&](std::span<std::uint8_t const> block) {
+					sha384.update(block);
+				});
+				return sha384.digest(6);
 			}
 
 	};
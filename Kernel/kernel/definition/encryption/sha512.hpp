@@ -5,6 +5,162 @@
 
 namespace Sen::Kernel::Definition::Encryption {
 
+	/**
+	 * Incremental SHA-512 compression, shared by SHA-384 with its own initial state
+	 * Used by hash_fs so a file never has to be held in memory
+	*/
+
+	class SHA512Stream {
+
+		public:
+
+			using State = std::array<std::uint64_t, 8>;
+
+			inline static constexpr auto sha512_state = State{
+				0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+				0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+			};
+
+			inline static constexpr auto sha384_state = State{
+				0xcbbb9d5dc1059ed8ULL, 0x629a292a367cd507ULL, 0x9159015a3070dd17ULL, 0x152fecd8f70e5939ULL,
+				0x67332667ffc00b31ULL, 0x8eb44a8768581511ULL, 0xdb0c2e0d64f98fa7ULL, 0x47b5481dbefa4fa4ULL
+			};
+
+		protected:
+
+			inline static constexpr auto k = std::array<std::uint64_t, 80>{
+				0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL, 0x3956c25bf348b538ULL,
+				0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL, 0xd807aa98a3030242ULL, 0x12835b0145706fbeULL,
+				0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL, 0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL,
+				0xc19bf174cf692694ULL, 0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+				0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL, 0x983e5152ee66dfabULL,
+				0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL, 0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+				0x06ca6351e003826fULL, 0x142929670a0e6e70ULL, 0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL,
+				0x53380d139d95b3dfULL, 0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+				0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL, 0xd192e819d6ef5218ULL,
+				0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL, 0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL,
+				0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL, 0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL,
+				0x682e6ff3d6b2b8a3ULL, 0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+				0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL, 0xca273eceea26619cULL,
+				0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL, 0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL,
+				0x113f9804bef90daeULL, 0x1b710b35131c471bULL, 0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL,
+				0x431d67c49c100d4cULL, 0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+			};
+
+			State state;
+
+			std::array<std::uint8_t, 128> block{};
+
+			std::size_t block_length{};
+
+			std::uint64_t message_length{};
+
+			inline auto transform(
+				const std::uint8_t* data
+			) -> void
+			{
+				auto w = std::array<std::uint64_t, 80>{};
+				for (auto i : Range<std::size_t>(16)) {
+					auto value = std::uint64_t{};
+					for (auto j : Range<std::size_t>(8)) {
+						value = (value << 8) | data[i * 8 + j];
+					}
+					w[i] = value;
+				}
+				for (auto i = std::size_t{16}; i < w.size(); ++i) {
+					auto s0 = std::rotr(w[i - 15], 1) ^ std::rotr(w[i - 15], 8) ^ (w[i - 15] >> 7);
+					auto s1 = std::rotr(w[i - 2], 19) ^ std::rotr(w[i - 2], 61) ^ (w[i - 2] >> 6);
+					w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+				}
+				auto s = thiz.state;
+				for (auto i : Range<std::size_t>(80)) {
+					auto temp1 = s[7] + (std::rotr(s[4], 14) ^ std::rotr(s[4], 18) ^ std::rotr(s[4], 41)) + ((s[4] & s[5]) ^ (~s[4] & s[6])) + k[i] + w[i];
+					auto temp2 = (std::rotr(s[0], 28) ^ std::rotr(s[0], 34) ^ std::rotr(s[0], 39)) + ((s[0] & s[1]) ^ (s[0] & s[2]) ^ (s[1] & s[2]));
+					s[7] = s[6];
+					s[6] = s[5];
+					s[5] = s[4];
+					s[4] = s[3] + temp1;
+					s[3] = s[2];
+					s[2] = s[1];
+					s[1] = s[0];
+					s[0] = temp1 + temp2;
+				}
+				for (auto i : Range<std::size_t>(8)) {
+					thiz.state[i] += s[i];
+				}
+				return;
+			}
+
+		public:
+
+			explicit SHA512Stream(
+				const State & initial_state
+			) : state(initial_state)
+			{
+
+			}
+
+			~SHA512Stream(
+			) = default;
+
+			inline auto update(
+				std::span<std::uint8_t const> data
+			) -> void
+			{
+				thiz.message_length += data.size();
+				if (thiz.block_length != 0) {
+					auto size = std::min(data.size(), thiz.block.size() - thiz.block_length);
+					std::memcpy(thiz.block.data() + thiz.block_length, data.data(), size);
+					thiz.block_length += size;
+					data = data.subspan(size);
+					if (thiz.block_length < thiz.block.size()) {
+						return;
+					}
+					thiz.transform(thiz.block.data());
+					thiz.block_length = 0;
+				}
+				while (data.size() >= thiz.block.size()) {
+					thiz.transform(data.data());
+					data = data.subspan(thiz.block.size());
+				}
+				std::memcpy(thiz.block.data(), data.data(), data.size());
+				thiz.block_length = data.size();
+				return;
+			}
+
+			/**
+			 * word_count: 8 for SHA-512, 6 for SHA-384
+			 * return: lowercase hex digest
+			*/
+
+			inline auto digest(
+				std::size_t word_count
+			) -> std::string
+			{
+				auto bit_length = thiz.message_length << 3;
+				auto high_bit_length = thiz.message_length >> 61;
+				thiz.block[thiz.block_length++] = 0x80;
+				if (thiz.block_length > thiz.block.size() - 16) {
+					std::memset(thiz.block.data() + thiz.block_length, 0, thiz.block.size() - thiz.block_length);
+					thiz.transform(thiz.block.data());
+					thiz.block_length = 0;
+				}
+				std::memset(thiz.block.data() + thiz.block_length, 0, thiz.block.size() - thiz.block_length);
+				for (auto i : Range<std::size_t>(8)) {
+					thiz.block[112 + i] = static_cast<std::uint8_t>(high_bit_length >> (56 - i * 8));
+					thiz.block[120 + i] = static_cast<std::uint8_t>(bit_length >> (56 - i * 8));
+				}
+				thiz.transform(thiz.block.data());
+				auto result = std::string{};
+				result.reserve(word_count * 16);
+				for (auto i : Range<std::size_t>(word_count)) {
+					result += fmt::format("{:016x}", thiz.state[i]);
+				}
+				return result;
+			}
+
+	};
+
 	class SHA512 {
 
 		public:
@@ -32,7 +188,11 @@ namespace Sen::Kernel::Definition::Encryption {
 				const std::string & source
 			) -> std::string const
 			{
-				return SHA512::hash(FileSystem::read_file(source));
+				auto sha512 = SHA512Stream{SHA512Stream::sha512_state};
+				FileSystem::read_chunk(source, FileSystem::k_chunk_size, [&](std::span<std::uint8_t const> block) {
+					sha512.update(block);
+				});
+				return sha512.digest(8);
 			}
 
 	};
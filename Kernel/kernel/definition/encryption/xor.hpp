@@ -2,10 +2,136 @@
 
 #include "kernel/definition/library.hpp"
 #include "kernel/definition/macro.hpp"
+#include "kernel/definition/basic/cpu.hpp"
 
 namespace Sen::Kernel::Definition::Encryption::XOR 
 {
 
+	// Bytes xored per wide step
+
+	inline static constexpr auto k_step_size = 64_size;
+
+	/**
+	 * Each xor_step_* handles whole 64-byte steps and returns the key phase after them
+	 * pattern holds the key repeated from phase 0, long enough to read 64 bytes from any phase
+	*/
+
+	#if defined M_CPU_X86_64
+
+	M_TARGET_AVX2 inline static auto xor_step_avx2(
+		std::uint8_t* data,
+		std::size_t size,
+		const std::uint8_t* pattern,
+		std::size_t phase,
+		std::size_t key_size
+	) -> std::size_t
+	{
+		auto advance = k_step_size % key_size;
+		for (; size >= k_step_size; data += k_step_size, size -= k_step_size) {
+			auto low = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data));
+			auto high = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data + 32));
+			low = _mm256_xor_si256(low, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pattern + phase)));
+			high = _mm256_xor_si256(high, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pattern + phase + 32)));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(data), low);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(data + 32), high);
+			phase += advance;
+			if (phase >= key_size) {
+				phase -= key_size;
+			}
+		}
+		return phase;
+	}
+
+	inline static auto xor_step_sse2(
+		std::uint8_t* data,
+		std::size_t size,
+		const std::uint8_t* pattern,
+		std::size_t phase,
+		std::size_t key_size
+	) -> std::size_t
+	{
+		auto advance = k_step_size % key_size;
+		for (; size >= k_step_size; data += k_step_size, size -= k_step_size) {
+			for (auto offset = 0_size; offset < k_step_size; offset += 16) {
+				auto value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + offset));
+				value = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<__m128i const*>(pattern + phase + offset)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(data + offset), value);
+			}
+			phase += advance;
+			if (phase >= key_size) {
+				phase -= key_size;
+			}
+		}
+		return phase;
+	}
+
+	#elif defined M_CPU_ARM64
+
+	inline static auto xor_step_neon(
+		std::uint8_t* data,
+		std::size_t size,
+		const std::uint8_t* pattern,
+		std::size_t phase,
+		std::size_t key_size
+	) -> std::size_t
+	{
+		auto advance = k_step_size % key_size;
+		for (; size >= k_step_size; data += k_step_size, size -= k_step_size) {
+			for (auto offset = 0_size; offset < k_step_size; offset += 16) {
+				vst1q_u8(data + offset, veorq_u8(vld1q_u8(data + offset), vld1q_u8(pattern + phase + offset)));
+			}
+			phase += advance;
+			if (phase >= key_size) {
+				phase -= key_size;
+			}
+		}
+		return phase;
+	}
+
+	#endif
+
+	/**
+	 * data: the bytes to xor in place
+	 * key: the repeating key
+	 * key_phase: index of the key byte paired with data[0]
+	*/
+
+	inline static auto xor_inplace(
+		std::span<std::uint8_t> data,
+		std::span<std::uint8_t const> key,
+		std::size_t key_phase
+	) -> void
+	{
+		if (data.empty() || key.empty()) {
+			return;
+		}
+		auto pattern = std::vector<std::uint8_t>(key.size() + k_step_size);
+		for (auto index : Range(pattern.size())) {
+			pattern[index] = key[index % key.size()];
+		}
+		auto phase = key_phase % key.size();
+		auto wide_size = data.size() - data.size() % k_step_size;
+		#if defined M_CPU_X86_64
+		if (CPU::feature().avx2) {
+			phase = xor_step_avx2(data.data(), wide_size, pattern.data(), phase, key.size());
+		}
+		else {
+			phase = xor_step_sse2(data.data(), wide_size, pattern.data(), phase, key.size());
+		}
+		#elif defined M_CPU_ARM64
+		phase = xor_step_neon(data.data(), wide_size, pattern.data(), phase, key.size());
+		#else
+		wide_size = 0_size;
+		#endif
+		for (auto index = wide_size; index < data.size(); ++index) {
+			data[index] ^= pattern[phase++];
+			if (phase == key.size()) {
+				phase = 0_size;
+			}
+		}
+		return;
+	}
+
 	/**
 	 * key: the key to encrypt
 	 * plain: the plain text
@@ -17,10 +143,8 @@ namespace Sen::Kernel::Definition::Encryption::XOR
 		const std::vector<std::uint8_t> & key
 	) -> std::vector<std::uint8_t>
 	{
-		auto result = std::vector<std::uint8_t>(plain.size(), 0x00_byte);
-		for (auto i : Range(plain.size())) {
-			result[i] = plain[i] ^ key[i % key.size()];
-		}
+		auto result = plain;
+		xor_inplace(result, key, 0_size);
 		return result;
 	}
 
@@ -37,7 +161,9 @@ namespace Sen::Kernel::Definition::Encryption::XOR
 		const std::vector<std::uint8_t> & key
 	) -> void
 	{
-		FileSystem::write_binary(destination, XOR::encrypt(FileSystem::read_binary<std::uint8_t>(source), std::vector<std::uint8_t>{key.begin(), key.end()}));
+		auto data = FileSystem::read_binary<std::uint8_t>(source);
+		xor_inplace(data, key, 0_size);
+		FileSystem::write_binary(destination, data);
 		return;
 	}
 	
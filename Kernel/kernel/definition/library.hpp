@@ -30,6 +30,13 @@
 #include <set>
 #include <bitset>
 #include <condition_variable>
+#include <queue>
+#include <deque>
+#include <optional>
+#include <charconv>
+#include <span>
+#include <bit>
+#include <random>
 #include "kernel/definition/assert.hpp"
 #include "kernel/definition/basic/language.hpp"
 #include "kernel/definition/range.hpp"
@@ -13,12 +13,15 @@
 #include "kernel/definition/basic/image.hpp"
 #include "kernel/definition/basic/json.hpp"
 #include "kernel/definition/basic/json_writer.hpp"
+#include "kernel/definition/basic/json_ondemand.hpp"
 #include "kernel/definition/basic/buffer.hpp"
 #include "kernel/definition/basic/collections.hpp"
 #include "kernel/definition/basic/system.hpp"
 #include "kernel/definition/basic/thread.hpp"
+#include "kernel/definition/basic/cpu.hpp"
 #include "kernel/definition/basic/apng_maker.hpp"
 #include "kernel/definition/basic/max_rects_lite.hpp"
+#include "kernel/definition/basic/xml_reader.hpp"
 #include "kernel/definition/basic/utility.hpp"
 
 #include "kernel/definition/encryption/md5.hpp"
@@ -31,6 +34,7 @@
 #include "kernel/definition/encryption/base64.hpp"
 #include "kernel/definition/encryption/fnv.hpp"
 #include "kernel/definition/encryption/Rijndael.hpp"
+#include "kernel/definition/encryption/hash.hpp"
 #include "kernel/definition/compression/zlib.hpp"
 #include "kernel/definition/compression/zip.hpp"
 #include "kernel/definition/compression/lzma.hpp"
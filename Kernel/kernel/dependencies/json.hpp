@@ -9,6 +9,7 @@
 #endif
 
 #include "dependencies/json/json.hpp"
+#include "kernel/dependencies/tsl.hpp"
 
 #if defined MSVC_COMPILER
 #pragma warning(pop)
@@ -25,3 +26,334 @@ namespace Sen::Kernel::Dependencies::json
 	using namespace ::nlohmann;
 
 }
+
+namespace Sen::Kernel
+{
+
+	// string_view hash, so a key lookup never builds a std::string
+
+	struct JsonKeyHash
+	{
+		using is_transparent = void;
+
+		inline auto operator()(
+			std::string_view key
+		) const noexcept -> std::size_t
+		{
+			return std::hash<std::string_view>{}(key);
+		}
+	};
+
+	/**
+	 * Object storage of ordered_json: insertion order is kept like nlohmann::ordered_map,
+	 * but a key is found through the tsl hash index instead of a linear scan
+	 * Elements live in one vector, iterators are the vector iterators
+	 */
+
+	template <typename Key, typename T, typename IgnoredLess = std::less<Key>, typename Allocator = std::allocator<std::pair<Key const, T>>>
+	class JsonOrderedMap
+	{
+	public:
+		using key_type = Key;
+
+		using mapped_type = T;
+
+		using value_type = std::pair<Key, T>;
+
+		using key_compare = std::equal_to<>;
+
+		using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<value_type>;
+
+		using container_type = std::vector<value_type, allocator_type>;
+
+		using iterator = typename container_type::iterator;
+
+		using const_iterator = typename container_type::const_iterator;
+
+		using size_type = typename container_type::size_type;
+
+		using difference_type = typename container_type::difference_type;
+
+	protected:
+		using Map = tsl::ordered_map<Key, T, JsonKeyHash, std::equal_to<>, allocator_type, container_type>;
+
+		Map m_map{};
+
+		// tsl only hands out const values, only the non-const map reaches the vector mutably, the key is never written through it
+
+		inline auto value(
+		) noexcept -> container_type &
+		{
+			return const_cast<container_type &>(this->m_map.values_container());
+		}
+
+		inline auto value(
+		) const noexcept -> container_type const &
+		{
+			return this->m_map.values_container();
+		}
+
+		// the position of a tsl iterator as an element iterator, mutable only through a non-const map
+
+		inline auto to_value_iterator(
+			typename Map::const_iterator it
+		) noexcept -> iterator
+		{
+			return this->value().begin() + (it - this->m_map.cbegin());
+		}
+
+		inline auto to_value_iterator(
+			typename Map::const_iterator it
+		) const noexcept -> const_iterator
+		{
+			return this->value().cbegin() + (it - this->m_map.cbegin());
+		}
+
+		// the position of an element iterator as a tsl iterator
+
+		inline auto to_map_iterator(
+			const_iterator it
+		) const noexcept -> typename Map::const_iterator
+		{
+			return this->m_map.cbegin() + (it - this->value().cbegin());
+		}
+
+	public:
+		JsonOrderedMap(
+		) noexcept(noexcept(Map())) = default;
+
+		explicit JsonOrderedMap(
+			Allocator const &allocator
+		) : m_map(allocator_type(allocator))
+		{
+		}
+
+		template <typename Iterator>
+		JsonOrderedMap(
+			Iterator first,
+			Iterator last,
+			Allocator const &allocator = Allocator()
+		) : m_map(allocator_type(allocator))
+		{
+			for (; first != last; ++first)
+			{
+				this->emplace(first->first, first->second);
+			}
+		}
+
+		inline auto begin(
+		) noexcept -> iterator
+		{
+			return this->value().begin();
+		}
+
+		inline auto begin(
+		) const noexcept -> const_iterator
+		{
+			return this->value().cbegin();
+		}
+
+		inline auto cbegin(
+		) const noexcept -> const_iterator
+		{
+			return this->value().cbegin();
+		}
+
+		inline auto end(
+		) noexcept -> iterator
+		{
+			return this->value().end();
+		}
+
+		inline auto end(
+		) const noexcept -> const_iterator
+		{
+			return this->value().cend();
+		}
+
+		inline auto cend(
+		) const noexcept -> const_iterator
+		{
+			return this->value().cend();
+		}
+
+		inline auto empty(
+		) const noexcept -> bool
+		{
+			return this->m_map.empty();
+		}
+
+		inline auto size(
+		) const noexcept -> size_type
+		{
+			return this->m_map.size();
+		}
+
+		inline auto max_size(
+		) const noexcept -> size_type
+		{
+			return this->m_map.max_size();
+		}
+
+		inline auto reserve(
+			size_type count
+		) -> void
+		{
+			this->m_map.reserve(count);
+			return;
+		}
+
+		inline auto clear(
+		) noexcept -> void
+		{
+			this->m_map.clear();
+			return;
+		}
+
+		template <typename KeyType>
+		inline auto find(
+			KeyType const &key
+		) -> iterator
+		{
+			return this->to_value_iterator(typename Map::const_iterator{this->m_map.find(key)});
+		}
+
+		template <typename KeyType>
+		inline auto find(
+			KeyType const &key
+		) const -> const_iterator
+		{
+			return this->to_value_iterator(this->m_map.find(key));
+		}
+
+		template <typename KeyType>
+		inline auto count(
+			KeyType const &key
+		) const -> size_type
+		{
+			return this->m_map.count(key);
+		}
+
+		template <typename KeyType>
+		inline auto contains(
+			KeyType const &key
+		) const -> bool
+		{
+			return this->m_map.contains(key);
+		}
+
+		// an existing key is left untouched, as std::map::emplace does
+
+		template <typename KeyType, typename... Args>
+		inline auto emplace(
+			KeyType &&key,
+			Args &&...args
+		) -> std::pair<iterator, bool>
+		{
+			if (auto it = this->m_map.find(key); it != this->m_map.end())
+			{
+				return {this->to_value_iterator(typename Map::const_iterator{it}), false};
+			}
+			auto [it, inserted] = this->m_map.try_emplace(Key(std::forward<KeyType>(key)), std::forward<Args>(args)...);
+			return {this->to_value_iterator(typename Map::const_iterator{it}), inserted};
+		}
+
+		inline auto insert(
+			value_type const &element
+		) -> std::pair<iterator, bool>
+		{
+			return this->emplace(element.first, element.second);
+		}
+
+		inline auto insert(
+			value_type &&element
+		) -> std::pair<iterator, bool>
+		{
+			return this->emplace(std::move(element.first), std::move(element.second));
+		}
+
+		template <typename Iterator>
+		inline auto insert(
+			Iterator first,
+			Iterator last
+		) -> void
+		{
+			for (; first != last; ++first)
+			{
+				this->emplace(first->first, first->second);
+			}
+			return;
+		}
+
+		template <typename KeyType>
+		inline auto operator[](
+			KeyType &&key
+		) -> T &
+		{
+			return this->emplace(std::forward<KeyType>(key)).first->second;
+		}
+
+		template <typename KeyType>
+		inline auto at(
+			KeyType const &key
+		) -> T &
+		{
+			return this->m_map.at(key);
+		}
+
+		template <typename KeyType>
+		inline auto at(
+			KeyType const &key
+		) const -> T const &
+		{
+			return this->m_map.at(key);
+		}
+
+		// erase keeps the order, the elements after it shift down like nlohmann::ordered_map
+
+		inline auto erase(
+			const_iterator position
+		) -> iterator
+		{
+			return this->to_value_iterator(typename Map::const_iterator{this->m_map.erase(this->to_map_iterator(position))});
+		}
+
+		inline auto erase(
+			const_iterator first,
+			const_iterator last
+		) -> iterator
+		{
+			return this->to_value_iterator(typename Map::const_iterator{this->m_map.erase(this->to_map_iterator(first), this->to_map_iterator(last))});
+		}
+
+		template <typename KeyType>
+			requires(!std::is_convertible_v<KeyType, const_iterator>)
+		inline auto erase(
+			KeyType const &key
+		) -> size_type
+		{
+			return this->m_map.erase(key);
+		}
+
+		friend inline auto operator==(
+			JsonOrderedMap const &lhs,
+			JsonOrderedMap const &rhs
+		) -> bool
+		{
+			return lhs.value() == rhs.value();
+		}
+
+		friend inline auto operator<(
+			JsonOrderedMap const &lhs,
+			JsonOrderedMap const &rhs
+		) -> bool
+		{
+			return lhs.value() < rhs.value();
+		}
+	};
+
+	// the json used throughout the kernel, key order is kept and a key lookup is hashed
+
+	using ordered_json = nlohmann::basic_json<JsonOrderedMap>;
+
+}
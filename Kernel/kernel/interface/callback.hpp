@@ -231,6 +231,8 @@ namespace Sen::Kernel::Interface {
 					javascript->add_proxy(Script::Thread::sleep, "Sen"_sv, "Kernel"_sv, "Thread"_sv, "sleep"_sv);
 					// now
 					javascript->add_proxy(Script::Thread::now, "Sen"_sv, "Kernel"_sv, "Thread"_sv, "now"_sv);
+					// hardware_concurrency
+					javascript->add_proxy(Script::Thread::hardware_concurrency, "Sen"_sv, "Kernel"_sv, "Thread"_sv, "hardware_concurrency"_sv);
 				}
 				// array buffer
 				{
@@ -280,6 +282,19 @@ namespace Sen::Kernel::Interface {
 					// evaluate file
 					javascript->add_proxy(Script::JavaScript::evaluate_fs, "Sen"_sv, "Kernel"_sv, "JavaScript"_sv, "evaluate_fs"_sv);
 				}
+				// runtime
+				{
+					// set_memory_limit
+					javascript->add_proxy(Script::Runtime::set_memory_limit, "Sen"_sv, "Kernel"_sv, "Runtime"_sv, "set_memory_limit"_sv);
+					// set_gc_threshold
+					javascript->add_proxy(Script::Runtime::set_gc_threshold, "Sen"_sv, "Kernel"_sv, "Runtime"_sv, "set_gc_threshold"_sv);
+					// set_max_stack_size
+					javascript->add_proxy(Script::Runtime::set_max_stack_size, "Sen"_sv, "Kernel"_sv, "Runtime"_sv, "set_max_stack_size"_sv);
+					// gc
+					javascript->add_proxy(Script::Runtime::gc, "Sen"_sv, "Kernel"_sv, "Runtime"_sv, "gc"_sv);
+					// memory_usage
+					javascript->add_proxy(Script::Runtime::memory_usage, "Sen"_sv, "Kernel"_sv, "Runtime"_sv, "memory_usage"_sv);
+				}
 				// md5
 				{
 					// hash method
@@ -313,7 +328,7 @@ namespace Sen::Kernel::Interface {
 					// hash method
 					javascript->add_proxy(Script::Encryption::SHA256::hash, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA256"_sv, "hash"_sv);
 					// hash file method
-					javascript->add_proxy(Script::Encryption::SHA224::hash_fs, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA256"_sv, "hash_fs"_sv);
+					javascript->add_proxy(Script::Encryption::SHA256::hash_fs, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA256"_sv, "hash_fs"_sv);
 				}
 				// sha384
 				{
@@ -329,6 +344,11 @@ namespace Sen::Kernel::Interface {
 					// hash file method
 					javascript->add_proxy(Script::Encryption::SHA512::hash_fs, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA512"_sv, "hash_fs"_sv);
 				}
+				// hash
+				{
+					// hash many files method
+					javascript->add_proxy(Script::Encryption::Hash::hash_many_fs, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "Hash"_sv, "hash_many_fs"_sv);
+				}
 				// xor
 				{
 					// encrypt method
@@ -388,9 +408,13 @@ namespace Sen::Kernel::Interface {
 					// decode base64 for file
 					javascript->add_proxy(Script::Encryption::Base64::decode_fs, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "Base64"_sv, "decode_fs"_sv);
 					// encode base64 for file as thread
-					javascript->add_proxy(Script::Encryption::Base64::encode_fs_as_multiple_threads, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "Base64"_sv, "encode_fs_as_multiple_thread"_sv);
+					javascript->add_proxy(Script::Encryption::Base64::encode_fs_as_multiple_threads, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "Base64"_sv, "encode_fs_as_multiple_threads"_sv);
 					// decode base64 for file as thread
 					javascript->add_proxy(Script::Encryption::Base64::decode_fs_as_multiple_threads, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "Base64"_sv, "decode_fs_as_multiple_threads"_sv);
+					// encode base64 for many files
+					javascript->add_proxy(Script::Encryption::Base64::encode_many_fs, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "Base64"_sv, "encode_many_fs"_sv);
+					// decode base64 for many files
+					javascript->add_proxy(Script::Encryption::Base64::decode_many_fs, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "Base64"_sv, "decode_many_fs"_sv);
 				}
 				// texture
 				{
@@ -439,6 +463,11 @@ namespace Sen::Kernel::Interface {
 					// encode_fs_as_multiple_threads
 					javascript->add_proxy(Script::Support::PopCap::RTON::encode_fs_as_multiple_threads, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "RTON"_sv, "encode_fs_as_multiple_threads"_sv);
 				}
+				// lawnstrings
+				{
+					// convert fs
+					javascript->add_proxy(Script::Support::PopCap::LawnStrings::convert_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "LawnStrings"_sv, "convert_fs"_sv);
+				}
 				// zlib
 				{
 					// uncompress fs
@@ -516,6 +545,18 @@ namespace Sen::Kernel::Interface {
 					javascript->add_proxy(Script::Support::PopCap::RSB::unpack_resource, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "unpack_resource"_sv);
 					// pack_resource
 					javascript->add_proxy(Script::Support::PopCap::RSB::pack_resource, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "pack_resource"_sv);
+					// list_resource
+					javascript->add_proxy(Script::Support::PopCap::RSB::list_resource, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "list_resource"_sv);
+					// extract_resource
+					javascript->add_proxy(Script::Support::PopCap::RSB::extract_resource, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "extract_resource"_sv);
+					// extract_resource_list
+					javascript->add_proxy(Script::Support::PopCap::RSB::extract_resource_list, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "extract_resource_list"_sv);
+					// extract_resource_fs
+					javascript->add_proxy(Script::Support::PopCap::RSB::extract_resource_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "extract_resource_fs"_sv);
+					// obfuscate_fs
+					javascript->add_proxy(Script::Support::PopCap::RSB::obfuscate_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "obfuscate_fs"_sv);
+					// convert_android_to_ios_fs
+					javascript->add_proxy(Script::Support::PopCap::RSB::convert_android_to_ios_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "convert_android_to_ios_fs"_sv);
 				}
 				// rsb-patch
 				{
@@ -566,6 +607,8 @@ namespace Sen::Kernel::Interface {
 				{
 					// decode_fs
 					javascript->add_proxy(Script::Support::PopCap::ReAnimation::decode_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "ReAnimation"_sv, "decode_fs"_sv);
+					// decode_many_fs
+					javascript->add_proxy(Script::Support::PopCap::ReAnimation::decode_many_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "ReAnimation"_sv, "decode_many_fs"_sv);
 					// encode_fs
 					javascript->add_proxy(Script::Support::PopCap::ReAnimation::encode_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "ReAnimation"_sv, "encode_fs"_sv);
 					// to_xml
@@ -585,6 +628,8 @@ namespace Sen::Kernel::Interface {
 				{
 					// decode_fs
 					javascript->add_proxy(Script::Support::WWise::SoundBank::decode_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "WWise"_sv, "SoundBank"_sv, "decode_fs"_sv);
+					// decode_index_fs
+					javascript->add_proxy(Script::Support::WWise::SoundBank::decode_index_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "WWise"_sv, "SoundBank"_sv, "decode_index_fs"_sv);
 					// encode_fs
 					javascript->add_proxy(Script::Support::WWise::SoundBank::encode_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "WWise"_sv, "SoundBank"_sv, "encode_fs"_sv);
 					// hash
@@ -152,20 +152,20 @@ namespace Sen::Kernel::Interface::Script
 	{
 
 		/**
-		 * Convert nlohmann::ordered_json to JSValue for quickjs
+		 * Convert ordered_json to JSValue for quickjs
 		 */
 
 		inline static auto json_to_js_value(
 			JSContext *context,
-			const nlohmann::ordered_json &json) -> JSElement::Object
+			const ordered_json &json) -> JSElement::Object
 		{
 			switch (json.type())
 			{
-			case nlohmann::ordered_json::value_t::null:
+			case ordered_json::value_t::null:
 			{
 				return JS::Converter::get_null();
 			}
-			case nlohmann::ordered_json::value_t::object:
+			case ordered_json::value_t::object:
 			{
 				auto js_obj = JS_NewObject(context);
 				for (auto &[key, value] : json.items())
@@ -176,7 +176,7 @@ namespace Sen::Kernel::Interface::Script
 				}
 				return js_obj;
 			}
-			case nlohmann::ordered_json::value_t::array:
+			case ordered_json::value_t::array:
 			{
 				auto js_arr = JS_NewArray(context);
 				for (auto i : Range<size_t>(json.size()))
@@ -185,23 +185,23 @@ namespace Sen::Kernel::Interface::Script
 				}
 				return js_arr;
 			}
-			case nlohmann::ordered_json::value_t::string:
+			case ordered_json::value_t::string:
 			{
 				return JS_NewStringLen(context, json.get<std::string>().data(), json.get<std::string>().size());
 			}
-			case nlohmann::ordered_json::value_t::boolean:
+			case ordered_json::value_t::boolean:
 			{
 				return JS_NewBool(context, json.get<bool>());
 			}
-			case nlohmann::ordered_json::value_t::number_integer:
+			case ordered_json::value_t::number_integer:
 			{
 				return JS_NewBigInt64(context, json.get<int64_t>());
 			}
-			case nlohmann::ordered_json::value_t::number_unsigned:
+			case ordered_json::value_t::number_unsigned:
 			{
 				return JS_NewBigInt64(context, json.get<uint64_t>());
 			}
-			case nlohmann::ordered_json::value_t::number_float:
+			case ordered_json::value_t::number_float:
 			{
 				return JS_NewFloat64(context, json.get<double>());
 			}
@@ -229,7 +229,7 @@ namespace Sen::Kernel::Interface::Script
 			M_JS_PROXY_WRAPPER(context, {
 				try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
 				auto source = JS::Converter::get_string(context, argv[0]);
-				auto json = nlohmann::ordered_json::parse(source);
+				auto json = ordered_json::parse(source);
 				auto js_obj = json_to_js_value(context, json);
 				return js_obj; }, "deserialize"_sv);
 		}
@@ -252,12 +252,12 @@ namespace Sen::Kernel::Interface::Script
 		}
 
 		/**
-		 * QuickJS JSON Value to nlohmann::ordered_json and then to string
+		 * QuickJS JSON Value to ordered_json and then to string
 		 */
 
 		inline static auto js_object_to_json(
 			JSContext *context,
-			JSValueConst value) -> nlohmann::ordered_json
+			JSValueConst value) -> ordered_json
 		{
 			switch (JS_VALUE_GET_TAG(value))
 			{
@@ -273,7 +273,7 @@ namespace Sen::Kernel::Interface::Script
 			{
 				if (JS_IsArray(context, value))
 				{
-					auto json = nlohmann::ordered_json::array();
+					auto json = ordered_json::array();
 					auto length = uint32_t{};
 					JS_ToUint32(context, &length, JS_GetPropertyStr(context, value, "length"));
 					for (auto i : Range<uint32_t>(length))
@@ -286,7 +286,7 @@ namespace Sen::Kernel::Interface::Script
 				}
 				else if (JS_IsObject(value))
 				{
-					auto json = nlohmann::ordered_json::object();
+					auto json = ordered_json::object();
 					auto *tab = static_cast<JSPropertyEnum *>(nullptr);
 					auto tab_size = uint32_t{};
 					if (JS_GetOwnPropertyNames(context, &tab, &tab_size, value, JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY) == 0)
@@ -315,26 +315,26 @@ namespace Sen::Kernel::Interface::Script
 			case JS_TAG_STRING:
 			{
 				auto str = JS::Converter::get_string(context, value);
-				auto json = nlohmann::ordered_json(str);
+				auto json = ordered_json(str);
 				return json;
 			}
 			case JS_TAG_BOOL:
 			{
-				return nlohmann::ordered_json(JS_VALUE_GET_BOOL(value) == 0 ? false : true);
+				return ordered_json(JS_VALUE_GET_BOOL(value) == 0 ? false : true);
 			}
 			case JS_TAG_INT:
 			{
-				return nlohmann::ordered_json(static_cast<double>(JS_VALUE_GET_INT(value)));
+				return ordered_json(static_cast<double>(JS_VALUE_GET_INT(value)));
 			}
 			case JS_TAG_FLOAT64:
 			{
-				return nlohmann::ordered_json(JS_VALUE_GET_FLOAT64(value));
+				return ordered_json(JS_VALUE_GET_FLOAT64(value));
 			}
 			case JS_TAG_BIG_INT:
 			{
 				auto val = int64_t{};
 				JS_ToBigInt64(context, &val, value);
-				return nlohmann::ordered_json(val);
+				return ordered_json(val);
 			}
 			}
 		}
@@ -7307,6 +7307,24 @@ namespace Sen::Kernel::Interface::Script
 				return JS::Converter::to_number(context, current); }, "now"_sv);
 		}
 
+		/**
+		 * ----------------------------------------
+		 * JavaScript Hardware Concurrency
+		 * @return: the worker count a kernel pool uses by default
+		 * ----------------------------------------
+		 */
+
+		inline static auto hardware_concurrency(
+			JSContext *context,
+			JSValueConst this_val,
+			int argc,
+			JSValueConst *argv) -> JSElement::bigint
+		{
+			M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 0, fmt::format("{} 0, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+				return JS_NewBigInt64(context, static_cast<int64_t>(ThreadPool::default_thread_count())); }, "hardware_concurrency"_sv);
+		}
+
 	}
 
 	/**
@@ -9233,6 +9251,146 @@ namespace Sen::Kernel::Interface::Script
 		}
 	}
 
+	/**
+	 * JavaScript Runtime: heap limits and statistics of the runtime running the script
+	 */
+
+	namespace Runtime
+	{
+		/**
+		 * ----------------------------------------
+		 * JavaScript set memory limit
+		 * @param argv[0]: limit in bytes, 0 is unlimited
+		 * @return: undefined
+		 * ----------------------------------------
+		 */
+
+		inline static auto set_memory_limit(
+			JSContext *context,
+			JSValueConst this_val,
+			int argc,
+			JSValueConst *argv) -> JSValue
+		{
+			M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+				auto limit = JS::Converter::get_bigint64(context, argv[0]);
+				assert_conditional(limit >= 0, fmt::format("{}", Kernel::Language::get("js.runtime.invalid_size")), "set_memory_limit");
+				// quickjs takes -1 as no limit
+				JS_SetMemoryLimit(JS_GetRuntime(context), limit == 0 ? static_cast<std::size_t>(-1) : static_cast<std::size_t>(limit));
+				return JS::Converter::get_undefined(); }, "set_memory_limit"_sv);
+		}
+
+		/**
+		 * ----------------------------------------
+		 * JavaScript set gc threshold
+		 * @param argv[0]: bytes allocated since the last collection before the next one runs
+		 * @return: undefined
+		 * ----------------------------------------
+		 */
+
+		inline static auto set_gc_threshold(
+			JSContext *context,
+			JSValueConst this_val,
+			int argc,
+			JSValueConst *argv) -> JSValue
+		{
+			M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+				auto threshold = JS::Converter::get_bigint64(context, argv[0]);
+				assert_conditional(threshold > 0, fmt::format("{}", Kernel::Language::get("js.runtime.invalid_size")), "set_gc_threshold");
+				JS_SetGCThreshold(JS_GetRuntime(context), static_cast<std::size_t>(threshold));
+				return JS::Converter::get_undefined(); }, "set_gc_threshold"_sv);
+		}
+
+		/**
+		 * ----------------------------------------
+		 * JavaScript set max stack size
+		 * @param argv[0]: stack size in bytes, 0 disables the check
+		 * @return: undefined
+		 * ----------------------------------------
+		 */
+
+		inline static auto set_max_stack_size(
+			JSContext *context,
+			JSValueConst this_val,
+			int argc,
+			JSValueConst *argv) -> JSValue
+		{
+			M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+				auto size = JS::Converter::get_bigint64(context, argv[0]);
+				assert_conditional(size >= 0, fmt::format("{}", Kernel::Language::get("js.runtime.invalid_size")), "set_max_stack_size");
+				JS_SetMaxStackSize(JS_GetRuntime(context), static_cast<std::size_t>(size));
+				return JS::Converter::get_undefined(); }, "set_max_stack_size"_sv);
+		}
+
+		/**
+		 * ----------------------------------------
+		 * JavaScript run gc
+		 * @return: undefined
+		 * ----------------------------------------
+		 */
+
+		inline static auto gc(
+			JSContext *context,
+			JSValueConst this_val,
+			int argc,
+			JSValueConst *argv) -> JSValue
+		{
+			M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 0, fmt::format("{} 0, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+				JS_RunGC(JS_GetRuntime(context));
+				return JS::Converter::get_undefined(); }, "gc"_sv);
+		}
+
+		/**
+		 * ----------------------------------------
+		 * JavaScript memory usage
+		 * @return: heap statistics of the runtime, sizes in bytes
+		 * ----------------------------------------
+		 */
+
+		inline static auto memory_usage(
+			JSContext *context,
+			JSValueConst this_val,
+			int argc,
+			JSValueConst *argv) -> JSValue
+		{
+			M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 0, fmt::format("{} 0, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+				auto usage = JSMemoryUsage{};
+				JS_ComputeMemoryUsage(JS_GetRuntime(context), &usage);
+				auto json = ordered_json{};
+				json["malloc_size"] = usage.malloc_size;
+				json["malloc_limit"] = usage.malloc_limit;
+				json["memory_used_size"] = usage.memory_used_size;
+				json["malloc_count"] = usage.malloc_count;
+				json["memory_used_count"] = usage.memory_used_count;
+				json["atom_count"] = usage.atom_count;
+				json["atom_size"] = usage.atom_size;
+				json["str_count"] = usage.str_count;
+				json["str_size"] = usage.str_size;
+				json["obj_count"] = usage.obj_count;
+				json["obj_size"] = usage.obj_size;
+				json["prop_count"] = usage.prop_count;
+				json["prop_size"] = usage.prop_size;
+				json["shape_count"] = usage.shape_count;
+				json["shape_size"] = usage.shape_size;
+				json["js_func_count"] = usage.js_func_count;
+				json["js_func_size"] = usage.js_func_size;
+				json["js_func_code_size"] = usage.js_func_code_size;
+				json["js_func_pc2line_count"] = usage.js_func_pc2line_count;
+				json["js_func_pc2line_size"] = usage.js_func_pc2line_size;
+				json["c_func_count"] = usage.c_func_count;
+				json["array_count"] = usage.array_count;
+				json["fast_array_count"] = usage.fast_array_count;
+				json["fast_array_elements"] = usage.fast_array_elements;
+				json["binary_object_count"] = usage.binary_object_count;
+				json["binary_object_size"] = usage.binary_object_size;
+				return JSON::json_to_js_value(context, json); }, "memory_usage"_sv);
+		}
+	}
+
 	/**
 	 * JavaScript Encryption System
 	 */
@@ -9505,10 +9663,60 @@ namespace Sen::Kernel::Interface::Script
 							try_assert(data.size() == 2, fmt::format("{} 2, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), data.size()));
 							paths.emplace_back(data);
 						}
-						Sen::Kernel::Definition::Encryption::Base64::encode_fs_as_multiple_thread(paths);
+						Sen::Kernel::Definition::Encryption::Base64::decode_fs_as_multiple_thread(paths);
 						return JS::Converter::get_undefined(); }, "decode_fs_as_multiple_threads"_sv);
 			}
 
+			/**
+			 * ----------------------------------------
+			 * JavaScript Base64 Encode many files
+			 * @param argv[0]: source files
+			 * @param argv[1]: destination files
+			 * @param argv[2]: thread count
+			 * @returns: Encoded files
+			 * ----------------------------------------
+			 */
+
+			inline static auto encode_many_fs(
+				JSContext *context,
+				JSValueConst this_val,
+				int argc,
+				JSValueConst *argv) -> JSValue
+			{
+				M_JS_PROXY_WRAPPER(context, {
+						try_assert(argc == 3, fmt::format("{} 3, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_vector<std::string>(context, argv[0]);
+						auto destination = JS::Converter::get_vector<std::string>(context, argv[1]);
+						auto thread_count = static_cast<std::size_t>(JS::Converter::get_bigint64(context, argv[2]));
+						Sen::Kernel::Definition::Encryption::Base64::encode_many_fs(source, destination, thread_count);
+						return JS::Converter::get_undefined(); }, "encode_many_fs"_sv);
+			}
+
+			/**
+			 * ----------------------------------------
+			 * JavaScript Base64 Decode many files
+			 * @param argv[0]: source files
+			 * @param argv[1]: destination files
+			 * @param argv[2]: thread count
+			 * @returns: Decoded files
+			 * ----------------------------------------
+			 */
+
+			inline static auto decode_many_fs(
+				JSContext *context,
+				JSValueConst this_val,
+				int argc,
+				JSValueConst *argv) -> JSValue
+			{
+				M_JS_PROXY_WRAPPER(context, {
+						try_assert(argc == 3, fmt::format("{} 3, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_vector<std::string>(context, argv[0]);
+						auto destination = JS::Converter::get_vector<std::string>(context, argv[1]);
+						auto thread_count = static_cast<std::size_t>(JS::Converter::get_bigint64(context, argv[2]));
+						Sen::Kernel::Definition::Encryption::Base64::decode_many_fs(source, destination, thread_count);
+						return JS::Converter::get_undefined(); }, "decode_many_fs"_sv);
+			}
+
 			/**
 			 * ----------------------------------------
 			 * JavaScript Base 64 Decode method
@@ -9772,6 +9980,38 @@ namespace Sen::Kernel::Interface::Script
 			}
 		}
 
+		/**
+		 * JavaScript Batch Hash
+		 */
+
+		namespace Hash
+		{
+			/**
+			 * ----------------------------------------
+			 * JavaScript Hash many files
+			 * @param argv[0]: source files
+			 * @param argv[1]: algorithm
+			 * @param argv[2]: thread count
+			 * @returns: hashed strings
+			 * ----------------------------------------
+			 */
+
+			inline static auto hash_many_fs(
+				JSContext *context,
+				JSValueConst this_val,
+				int argc,
+				JSValueConst *argv) -> JSValue
+			{
+				M_JS_PROXY_WRAPPER(context, {
+					try_assert(argc == 3, fmt::format("{} 3, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+					auto source = JS::Converter::get_vector<std::string>(context, argv[0]);
+					auto algorithm = Sen::Kernel::Definition::Encryption::Hash::to_algorithm(JS::Converter::get_string(context, argv[1]));
+					auto thread_count = static_cast<std::size_t>(JS::Converter::get_bigint64(context, argv[2]));
+					auto result = Sen::Kernel::Definition::Encryption::Hash::hash_many_fs(source, algorithm, thread_count);
+					return JS::Converter::to_array(context, result); }, "hash_many_fs"_sv);
+			}
+		}
+
 		/**
 		 * JavaScript XOR Encryption
 		 */
@@ -11513,6 +11753,40 @@ namespace Sen::Kernel::Interface::Script
 
 			}
 
+			/**
+			 * JavaScript LawnStrings Support
+			 */
+
+			namespace LawnStrings
+			{
+				/**
+				 * ----------------------------------------
+				 * JavaScript LawnStrings Convert File
+				 * @param argv[0]: source file
+				 * @param argv[1]: destination file
+				 * @param argv[2]: source type
+				 * @param argv[3]: destination type
+				 * @returns: Converted file
+				 * ----------------------------------------
+				 */
+
+				inline static auto convert_fs(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+						try_assert(argc == 4, fmt::format("{} 4, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_string(context, argv[0]);
+						auto destination = JS::Converter::get_string(context, argv[1]);
+						auto source_type = Sen::Kernel::Support::PopCap::LawnStrings::Convert::exchange_type(JS::Converter::get_string(context, argv[2]));
+						auto destination_type = Sen::Kernel::Support::PopCap::LawnStrings::Convert::exchange_type(JS::Converter::get_string(context, argv[3]));
+						Sen::Kernel::Support::PopCap::LawnStrings::Convert::process_fs(source, destination, source_type, destination_type);
+						return JS::Converter::get_undefined(); }, "convert_fs"_sv);
+				}
+			}
+
 			/**
 			 * JavaScript RSB Support
 			 */
@@ -11608,6 +11882,153 @@ namespace Sen::Kernel::Interface::Script
 						return JS::Converter::get_undefined(); }, "unpack_cipher"_sv);
 				}
 
+				/**
+				 * ----------------------------------------
+				 * JavaScript RSB List Resource
+				 * @param argv[0]: source file
+				 * @returns: every resource path in the bundle
+				 * ----------------------------------------
+				 */
+
+				inline static auto list_resource(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+					try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_string(context, argv[0]);
+						auto result = Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous::RsbIndex::list_fs(source);
+						return JS::Converter::to_array(context, result); }, "list_resource"_sv);
+				}
+
+				/**
+				 * ----------------------------------------
+				 * JavaScript RSB Extract Resource
+				 * @param argv[0]: source file
+				 * @param argv[1]: resource path
+				 * @returns: resource data
+				 * ----------------------------------------
+				 */
+
+				inline static auto extract_resource(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+					try_assert(argc == 2, fmt::format("{} 2, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_string(context, argv[0]);
+						auto path = JS::Converter::get_string(context, argv[1]);
+						auto index = Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous::RsbIndex{source};
+						return JS::Converter::toArrayBuffer(context, index.extract(path)); }, "extract_resource"_sv);
+				}
+
+				/**
+				 * ----------------------------------------
+				 * JavaScript RSB Extract Resource List
+				 * @param argv[0]: source file
+				 * @param argv[1]: resource paths
+				 * @returns: resource data of each path, the bundle is indexed once
+				 * ----------------------------------------
+				 */
+
+				inline static auto extract_resource_list(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+					try_assert(argc == 2, fmt::format("{} 2, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_string(context, argv[0]);
+						auto resource = JS::Converter::get_vector<std::string>(context, argv[1]);
+						auto index = Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous::RsbIndex{source};
+						auto js_array = JS_NewArray(context);
+						index.extract_each(resource, [&](size_t current, std::span<uint8_t const> data) {
+							JS_SetPropertyUint32(context, js_array, static_cast<uint32_t>(current), JS_NewArrayBufferCopy(context, data.data(), data.size()));
+						});
+						return js_array; }, "extract_resource_list"_sv);
+				}
+
+				/**
+				 * ----------------------------------------
+				 * JavaScript RSB Extract Resource File
+				 * @param argv[0]: source file
+				 * @param argv[1]: resource paths
+				 * @param argv[2]: destination directory
+				 * @returns: extracted files
+				 * ----------------------------------------
+				 */
+
+				inline static auto extract_resource_fs(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+					try_assert(argc == 3, fmt::format("{} 3, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_string(context, argv[0]);
+						auto resource = JS::Converter::get_vector<std::string>(context, argv[1]);
+						auto destination = JS::Converter::get_string(context, argv[2]);
+						Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous::RsbIndex::extract_fs(source, resource, destination);
+						return JS::Converter::get_undefined(); }, "extract_resource_fs"_sv);
+				}
+
+				/**
+				 * ----------------------------------------
+				 * JavaScript RSB Obfuscate File
+				 * @param argv[0]: source file
+				 * @param argv[1]: destination file
+				 * @returns: written version and modified subgroup count
+				 * ----------------------------------------
+				 */
+
+				inline static auto obfuscate_fs(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+					try_assert(argc == 2, fmt::format("{} 2, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_string(context, argv[0]);
+						auto destination = JS::Converter::get_string(context, argv[1]);
+						auto result = Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous::Obfuscate::process_fs(source, destination);
+						auto json = ordered_json{};
+						json["version"] = result.version;
+						json["modify_count"] = result.modify_count;
+						return JSON::json_to_js_value(context, json); }, "obfuscate_fs"_sv);
+				}
+
+				/**
+				 * ----------------------------------------
+				 * JavaScript RSB Convert Android to iOS File
+				 * @param argv[0]: source file
+				 * @param argv[1]: destination file
+				 * @param argv[2]: resolution
+				 * @returns: Converted file
+				 * ----------------------------------------
+				 */
+
+				inline static auto convert_android_to_ios_fs(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+					try_assert(argc == 3, fmt::format("{} 3, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_string(context, argv[0]);
+						auto destination = JS::Converter::get_string(context, argv[1]);
+						auto resolution = JS::Converter::get_string(context, argv[2]);
+						Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous::ConvertAndroidToIOS::process_fs(source, destination, resolution);
+						return JS::Converter::get_undefined(); }, "convert_android_to_ios_fs"_sv);
+				}
+
 				/**
 				 * ----------------------------------------
 				 * JavaScript RSB Unpack File
@@ -12207,7 +12628,7 @@ namespace Sen::Kernel::Interface::Script
 						auto source = JS::Converter::get_string(context, argv[0]);
 						auto destination = JS::Converter::get_string(context, argv[1]);
 						Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup::CustomResourceInformation json = *Sen::Kernel::FileSystem::read_json(source);
-						auto result = nlohmann::ordered_json{};
+						auto result = ordered_json{};
 						if (JS::Converter::get_bool(context, argv[2])) {
 							Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup::Common::exchange_custom_resource_info<true>(json, result);
 						}
@@ -12393,6 +12814,33 @@ namespace Sen::Kernel::Interface::Script
 						return JS::Converter::get_undefined(); }, "decode_fs"_sv);
 				}
 
+				/**
+				 * ----------------------------------------
+				 * JavaScript Reanim Decode many files
+				 * @param argv[0]: source files
+				 * @param argv[1]: destination files
+				 * @param argv[2]: platform
+				 * @param argv[3]: thread count
+				 * @returns: Decoded files
+				 * ----------------------------------------
+				 */
+
+				inline static auto decode_many_fs(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+						try_assert(argc == 4, fmt::format("{} 4, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_vector<std::string>(context, argv[0]);
+						auto destination = JS::Converter::get_vector<std::string>(context, argv[1]);
+						auto platform = get_platform(JS::Converter::get_string(context, argv[2]));
+						auto thread_count = static_cast<std::size_t>(JS::Converter::get_bigint64(context, argv[3]));
+						Sen::Kernel::Support::PopCap::ReAnimation::Decode::process_fs(source, destination, platform, thread_count);
+						return JS::Converter::get_undefined(); }, "decode_many_fs"_sv);
+				}
+
 				/**
 				 * ----------------------------------------
 				 * JavaScript Reanim Encode File
@@ -12661,6 +13109,29 @@ namespace Sen::Kernel::Interface::Script
 						return JS::Converter::get_undefined(); }, "decode_fs"_sv);
 				}
 
+				/**
+				 * ----------------------------------------
+				 * JavaScript WWise Soundbank Decode Index
+				 * @param argv[0]: source file
+				 * @param argv[1]: destination json
+				 * @returns: Bank header and media list, HIRC is not decoded
+				 * ----------------------------------------
+				 */
+
+				inline static auto decode_index_fs(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+						try_assert(argc == 2, fmt::format("{} 2, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_string(context, argv[0]);
+						auto destination = JS::Converter::get_string(context, argv[1]);
+						Kernel::Support::WWise::SoundBank::Decode::process_index_fs(source, destination);
+						return JS::Converter::get_undefined(); }, "decode_index_fs"_sv);
+				}
+
 				/**
 				 * ----------------------------------------
 				 * JavaScript WWise Soundbank Encode File
@@ -13142,9 +13613,9 @@ namespace Sen::Kernel::Interface::Script
 		using XMLDocument = tinyxml2::XMLDocument;
 
 		inline static auto xml2json(
-			const tinyxml2::XMLNode *node) -> nlohmann::ordered_json
+			const tinyxml2::XMLNode *node) -> ordered_json
 		{
-			auto j = nlohmann::ordered_json{};
+			auto j = ordered_json{};
 			auto element = node->ToElement();
 			if (element)
 			{
@@ -13201,7 +13672,7 @@ namespace Sen::Kernel::Interface::Script
 		}
 
 		inline static auto json2xml(
-			const nlohmann::ordered_json &j,
+			const ordered_json &j,
 			tinyxml2::XMLNode *node,
 			tinyxml2::XMLDocument &doc) -> void
 		{
@@ -13276,7 +13747,7 @@ namespace Sen::Kernel::Interface::Script
 		}
 
 		inline static auto convert(
-			const nlohmann::ordered_json &j,
+			const ordered_json &j,
 			tinyxml2::XMLDocument &doc) -> void
 		{
 			auto &root_name = j.begin().key();
@@ -13300,7 +13771,7 @@ namespace Sen::Kernel::Interface::Script
 				if (eResult != tinyxml2::XML_SUCCESS) {
 					throw Exception(fmt::format("XML cannot be parsed, data: {}", source));
 				}
-				auto j = nlohmann::ordered_json{};
+				auto j = ordered_json{};
 				j[doc.RootElement()->Value()] = xml2json(doc.RootElement());
 				return JSON::json_to_js_value(context, j); }, "deserialize"_sv);
 		}
@@ -13320,7 +13791,7 @@ namespace Sen::Kernel::Interface::Script
 				if (eResult != tinyxml2::XML_SUCCESS) {
 					throw Exception(fmt::format("XML cannot be loaded, data: {}", source));
 				}
-				auto j = nlohmann::ordered_json{};
+				auto j = ordered_json{};
 				j[doc.RootElement()->Value()] = xml2json(doc.RootElement());
 				return JSON::json_to_js_value(context, j); }, "deserialize_fs"_sv);
 		}
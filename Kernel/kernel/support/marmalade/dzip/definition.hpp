@@ -24,7 +24,7 @@ namespace Sen::Kernel::Support::Marmalade::DZip
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Chunk &nlohmann_json_t) -> void
     {
         nlohmann_json_j["flag"] = magic_enum::enum_name(nlohmann_json_t.flag);
@@ -32,7 +32,7 @@ namespace Sen::Kernel::Support::Marmalade::DZip
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Chunk &nlohmann_json_t) -> void
     {
         nlohmann_json_t.flag = magic_enum_cast<ChunkFlagEnum>(nlohmann_json_j.at("flag").get<std::string>());
@@ -46,7 +46,7 @@ namespace Sen::Kernel::Support::Marmalade::DZip
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Resource &nlohmann_json_t) -> void
     {
         nlohmann_json_j["path"] = nlohmann_json_t.path;
@@ -55,7 +55,7 @@ namespace Sen::Kernel::Support::Marmalade::DZip
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Resource &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("path").get_to(nlohmann_json_t.path);
@@ -69,7 +69,7 @@ namespace Sen::Kernel::Support::Marmalade::DZip
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Package &nlohmann_json_t) -> void
     {
         nlohmann_json_j["resource"] = nlohmann_json_t.resource;
@@ -77,7 +77,7 @@ namespace Sen::Kernel::Support::Marmalade::DZip
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Package &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("resource").get_to(nlohmann_json_t.resource);
@@ -12,6 +12,42 @@ namespace Sen::Kernel::Support::Marmalade::DZip
     struct Pack : Common
     {
     private:
+        struct ChunkData
+        {
+            std::vector<uint8_t> data;
+            size_t size_uncompressed;
+            size_t size_compressed;
+        };
+
+        // each chunk is compressed on the pool, results are appended in chunk order so the output does not depend on scheduling
+
+        inline static auto compress_chunk(
+            std::string const &resource_path,
+            std::bitset<ChunkFlag::k_count> const &chunk_flag) -> ChunkData
+        {
+            auto chunk = ChunkData{};
+            auto chunk_data = FileSystem::read_binary<uint8_t>(resource_path);
+            chunk.size_uncompressed = chunk_data.size();
+            chunk.size_compressed = chunk_flag.test(ChunkFlag::zerod_out) ? k_none_size : chunk.size_uncompressed;
+            if (chunk_flag.test(ChunkFlag::zlib))
+            {
+                chunk.data = Kernel::Definition::Compression::Zlib::compress_gzip<6>(chunk_data);
+            }
+            if (chunk_flag.test(ChunkFlag::bzip2))
+            {
+                chunk.data = Kernel::Definition::Compression::Bzip2::compress(chunk_data, 9, 30);
+            }
+            if (chunk_flag.test(ChunkFlag::copy_coded))
+            {
+                chunk.data = std::move(chunk_data);
+            }
+            if (chunk_flag.test(ChunkFlag::lzma))
+            {
+                chunk.data = Kernel::Definition::Compression::Lzma::compress<6>(chunk_data);
+            }
+            return chunk;
+        }
+
         inline static auto process_packages(
             DataStreamView &stream,
             Package const &definition,
@@ -45,6 +81,8 @@ namespace Sen::Kernel::Support::Marmalade::DZip
             information_structure.resource_information.resize(definition.resource.size());
             auto global_chunk_index = k_begin_index;
             auto chunk_information = DataStreamView{};
+            auto thread_pool = ThreadPool{};
+            auto chunk_data_list = std::vector<std::future<ChunkData>>{};
             for (auto resource_index : Range(definition.resource.size()))
             {
                 auto &resource_definition = definition.resource[resource_index];
@@ -100,52 +138,24 @@ namespace Sen::Kernel::Support::Marmalade::DZip
                         assert_conditional(false, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_flag")), "process_packages"); 
                         break;
                     }
-                    auto chunk_size_uncompressed = 0_size;
-                    auto chunk_size_compressed = 0_size;
-                    chunk_information_structure.offset = static_cast<uint32_t>(chunk_information.write_pos);
-                    if (chunk_flag.test(ChunkFlag::zlib))
-                    {
-                        auto chunk_data = FileSystem::read_binary<uint8_t>(resource_path);
-                        chunk_information.writeBytes(Kernel::Definition::Compression::Zlib::compress_gzip<6>(chunk_data));
-                        chunk_size_uncompressed = chunk_data.size();
-                        chunk_size_compressed = chunk_size_uncompressed;
-                    }
-                    if (chunk_flag.test(ChunkFlag::bzip2))
-                    {
-                        auto chunk_data = FileSystem::read_binary<uint8_t>(resource_path);
-                        chunk_information.writeBytes(Kernel::Definition::Compression::Bzip2::compress(chunk_data, 9, 30));
-                        chunk_size_uncompressed = chunk_data.size();
-                        chunk_size_compressed = chunk_size_uncompressed;
-                    }
-                    if (chunk_flag.test(ChunkFlag::zerod_out))
-                    {
-                        auto chunk_data = FileSystem::read_binary<uint8_t>(resource_path);
-                        //chunk_information.writeBytes(chunk_data);
-                        chunk_size_uncompressed = chunk_data.size();
-                        chunk_size_compressed = k_none_size;
-                    }
-                    if (chunk_flag.test(ChunkFlag::copy_coded))
-                    {
-                        auto chunk_data = FileSystem::read_binary<uint8_t>(resource_path);
-                        chunk_information.writeBytes(chunk_data);
-                        chunk_size_uncompressed = chunk_data.size();
-                        chunk_size_compressed = chunk_size_uncompressed;
-                    }
-                    if (chunk_flag.test(ChunkFlag::lzma))
-                    {
-                        auto chunk_data = FileSystem::read_binary<uint8_t>(resource_path);
-                        chunk_information.writeBytes(Kernel::Definition::Compression::Lzma::compress<6>(chunk_data));
-                        chunk_size_uncompressed = chunk_data.size();
-                        chunk_size_compressed = chunk_size_uncompressed;
-                    }
-                    chunk_information_structure.size_compressed = static_cast<uint32_t>(chunk_size_compressed);
-                    chunk_information_structure.size_uncompressed = static_cast<uint32_t>(chunk_size_uncompressed);
                     chunk_information_structure.flag = static_cast<uint16_t>(chunk_flag.to_ullong());
                     chunk_information_structure.file = 0_us;
                     information_structure.chunk_information.emplace_back(chunk_information_structure);
+                    chunk_data_list.emplace_back(thread_pool.enqueue([resource_path, chunk_flag]() -> ChunkData {
+                        return compress_chunk(resource_path, chunk_flag);
+                    }));
                     ++global_chunk_index;
                 }
             }
+            for (auto chunk_index : Range(chunk_data_list.size()))
+            {
+                auto chunk_data = chunk_data_list[chunk_index].get();
+                auto &chunk_information_structure = information_structure.chunk_information[chunk_index];
+                chunk_information_structure.offset = static_cast<uint32_t>(chunk_information.write_pos);
+                chunk_information.writeBytes(chunk_data.data);
+                chunk_information_structure.size_compressed = static_cast<uint32_t>(chunk_data.size_compressed);
+                chunk_information_structure.size_uncompressed = static_cast<uint32_t>(chunk_data.size_uncompressed);
+            }
             information_structure.chunk_setting.archive_resource_count = 1_us;
             information_structure.chunk_setting.chunk_count = static_cast<uint16_t>(global_chunk_index);
             information_structure.archive_setting.resource_file_count = static_cast<uint16_t>(information_structure.resource_file.size());
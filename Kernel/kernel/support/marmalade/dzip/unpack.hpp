@@ -13,14 +13,64 @@ namespace Sen::Kernel::Support::Marmalade::DZip
     struct Unpack : Common
     {
     private:
-        inline static auto process_package(
+        struct ChunkTask
+        {
+            ChunkInformation information;
+            ChunkFlagEnum flag;
+        };
+
+        struct ResourceTask
+        {
+            std::string destination;
+            std::vector<ChunkTask> chunk;
+        };
+
+        // walk the header layout only to know how many bytes it spans, the real parse is done by exchange_information
+
+        inline static auto information_size(
+            std::span<uint8_t const> archive
+        ) -> std::size_t
+        {
+            auto position = sizeof(uint32_t);
+            auto read_uint16 = [&]() -> uint16_t {
+                auto value = 0_us;
+                if (position + sizeof(uint16_t) <= archive.size()) {
+                    std::memcpy(&value, archive.data() + position, sizeof(uint16_t));
+                }
+                position += sizeof(uint16_t);
+                return value;
+            };
+            auto resource_file_count = static_cast<size_t>(read_uint16());
+            auto resource_directory_count = static_cast<size_t>(read_uint16());
+            position += sizeof(uint8_t);
+            auto string_count = resource_file_count + (resource_directory_count > 1_size ? resource_directory_count - 1_size : k_none_size);
+            for ([[maybe_unused]] auto _ : Range(string_count)) {
+                if (position >= archive.size()) {
+                    return archive.size();
+                }
+                auto terminator = static_cast<uint8_t const *>(std::memchr(archive.data() + position, 0, archive.size() - position));
+                if (terminator == nullptr) {
+                    return archive.size();
+                }
+                position = static_cast<size_t>(terminator - archive.data()) + 1_size;
+            }
+            for ([[maybe_unused]] auto _ : Range(resource_file_count)) {
+                read_uint16();
+                while (position < archive.size() && read_uint16() != 0xFFFF_us) {
+                }
+            }
+            read_uint16();
+            auto chunk_count = static_cast<size_t>(read_uint16());
+            position += chunk_count * 16_size;
+            return std::min(position, archive.size());
+        }
+
+        inline static auto exchange_information(
             DataStreamView &stream,
-            Package &definition,
-            std::string const & resource_directory
+            Information &information_structure
         ) -> void
         {
             assert_conditional(stream.readUint32() == k_magic_identifier, fmt::format("{}", Language::get("marmalade.dzip.invalid_dzip_header")), "process_package");
-            auto information_structure = Information{};
             exchange_archive_setting(stream, information_structure.archive_setting);
             information_structure.resource_file.resize(static_cast<size_t>(information_structure.archive_setting.resource_file_count));
             assert_conditional(information_structure.archive_setting.version == k_version, fmt::format("{}", Language::get("marmalade.dzip.invalid_dzip_version")), "process_package");
@@ -45,91 +95,171 @@ namespace Sen::Kernel::Support::Marmalade::DZip
             for (auto &element : information_structure.archive_resource_information) {
                 //exchange_archive_resource_information(stream, element);
             }
+            return;
+        }
+
+        inline static auto exchange_chunk_flag(
+            ChunkInformation const &chunk_information_structure
+        ) -> ChunkFlagEnum
+        {
+            auto chunk_size_compressed = static_cast<size_t>(chunk_information_structure.size_compressed);
+            auto chunk_size_uncompressed = static_cast<size_t>(chunk_information_structure.size_uncompressed);
+            auto chunk_flag = std::bitset<ChunkFlag::k_count>{static_cast<u_long>(chunk_information_structure.flag)};
+            assert_conditional(!chunk_flag.test(ChunkFlag::unused_2), fmt::format("{}", Language::get("marmalade.dzip.invalid_bitset_unused_2")), "process_package");
+            auto chunk_ok = false;
+            auto flag = ChunkFlagEnum{};
+            if (chunk_flag.test(ChunkFlag::combuf)) {
+                assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
+                chunk_ok = true;
+                assert_conditional(false, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_flag")), "process_package");
+            }
+            if (chunk_flag.test(ChunkFlag::dzip)) {
+                assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
+                chunk_ok = true;
+                assert_conditional(false, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_flag")), "process_package");
+            }
+            if (chunk_flag.test(ChunkFlag::zlib)) {
+                assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
+                chunk_ok = true;
+                assert_conditional(chunk_size_compressed == chunk_size_uncompressed, String::format(fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_size")), std::to_string(chunk_size_compressed), std::to_string(chunk_size_uncompressed)), "process_package");
+                flag = ChunkFlagEnum::zlib;
+            }
+            if (chunk_flag.test(ChunkFlag::bzip2)) {
+                assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
+                chunk_ok = true;
+                assert_conditional(chunk_size_compressed == chunk_size_uncompressed, String::format(fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_size")), std::to_string(chunk_size_compressed), std::to_string(chunk_size_uncompressed)), "process_package");
+                flag = ChunkFlagEnum::bzip2;
+            }
+            if (chunk_flag.test(ChunkFlag::mp3)) {
+                assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
+                chunk_ok = true;
+                assert_conditional(false, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_flag")), "process_package");
+            }
+            if (chunk_flag.test(ChunkFlag::jpeg)) {
+                assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
+                chunk_ok = true;
+                assert_conditional(false, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_flag")), "process_package");
+            }
+            if (chunk_flag.test(ChunkFlag::zerod_out)) {
+                assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
+                chunk_ok = true;
+                assert_conditional(chunk_size_compressed == k_none_size, String::format(fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_size")), std::to_string(chunk_size_compressed), std::to_string(chunk_size_uncompressed)), "process_package");
+                flag = ChunkFlagEnum::zerod_out;
+            }
+            if (chunk_flag.test(ChunkFlag::copy_coded)) {
+                assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
+                chunk_ok = true;
+                assert_conditional(chunk_size_compressed == chunk_size_uncompressed, String::format(fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_size")), std::to_string(chunk_size_compressed), std::to_string(chunk_size_uncompressed)), "process_package");
+                flag = ChunkFlagEnum::copy_coded;
+            }
+            if (chunk_flag.test(ChunkFlag::lzma)) {
+                assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
+                chunk_ok = true;
+                assert_conditional(chunk_size_compressed == chunk_size_uncompressed, String::format(fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_size")), std::to_string(chunk_size_compressed), std::to_string(chunk_size_uncompressed)), "process_package");
+                flag = ChunkFlagEnum::lzma;
+            }
+            if (chunk_flag.test(ChunkFlag::random_access)) {
+                assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
+                chunk_ok = true;
+                assert_conditional(false, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_flag")), "process_package");
+            }
+            assert_conditional(chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
+            return flag;
+        }
+
+        // chunk payloads are read straight from the archive view
+        // a compressed chunk stores its uncompressed size in size_compressed, so its payload runs at most to the end of the archive
+        // and a corrupt chunk is caught by the offset check and by the size of what it inflates to
+
+        inline static auto uncompress_chunk(
+            std::span<uint8_t const> archive,
+            ChunkTask const &chunk
+        ) -> std::vector<uint8_t>
+        {
+            auto chunk_size_uncompressed = static_cast<size_t>(chunk.information.size_uncompressed);
+            if (chunk.flag == ChunkFlagEnum::zerod_out) {
+                return std::vector<uint8_t>(chunk_size_uncompressed);
+            }
+            auto chunk_offset = static_cast<size_t>(chunk.information.offset);
+            assert_conditional(chunk_offset <= archive.size(), fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "uncompress_chunk");
+            auto chunk_view = archive.subspan(chunk_offset);
+            auto chunk_data = std::vector<uint8_t>{};
+            switch (chunk.flag) {
+                case ChunkFlagEnum::zlib: {
+                    assert_conditional(chunk_view.size() >= 10_size, fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "uncompress_chunk");
+                    chunk_data = Kernel::Definition::Compression::Zlib::uncompress_deflate(chunk_view.subspan(10_size, std::min(static_cast<size_t>(chunk.information.size_compressed), chunk_view.size()) - 10_size));
+                    break;
+                }
+                case ChunkFlagEnum::bzip2: {
+                    chunk_data = Kernel::Definition::Compression::Bzip2::uncompress(chunk_view.first(std::min(static_cast<size_t>(chunk.information.size_compressed), chunk_view.size())));
+                    break;
+                }
+                case ChunkFlagEnum::copy_coded: {
+                    assert_conditional(chunk_size_uncompressed <= chunk_view.size(), fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "uncompress_chunk");
+                    chunk_data.assign(chunk_view.begin(), chunk_view.begin() + static_cast<std::ptrdiff_t>(chunk_size_uncompressed));
+                    break;
+                }
+                case ChunkFlagEnum::lzma: {
+                    chunk_data = Kernel::Definition::Compression::Lzma::uncompress<false>(chunk_view.first(std::min(static_cast<size_t>(chunk.information.size_compressed), chunk_view.size())));
+                    break;
+                }
+                default: {
+                    assert_conditional(false, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_flag")), "uncompress_chunk");
+                }
+            }
+            assert_conditional(chunk_data.size() == chunk_size_uncompressed, String::format(fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_size")), std::to_string(chunk_data.size()), std::to_string(chunk_size_uncompressed)), "uncompress_chunk");
+            return chunk_data;
+        }
+
+        inline static auto process_package(
+            std::span<uint8_t const> archive,
+            Package &definition,
+            std::string const & resource_directory
+        ) -> void
+        {
+            auto information_structure = Information{};
+            {
+                auto stream = DataStreamView{std::vector<uint8_t>{archive.begin(), archive.begin() + information_size(archive)}};
+                exchange_information(stream, information_structure);
+            }
             definition.resource.resize(information_structure.resource_information.size());
-          //  auto package_data_end_position = stream.read_pos;
+            auto resource_task_list = std::vector<ResourceTask>{information_structure.resource_information.size()};
+            auto destination_directory = std::set<std::string>{};
             for (auto resource_index : Range(information_structure.resource_information.size())) {
                 auto & resource_information_structure = information_structure.resource_information[resource_index];
                 auto & resource_definition = definition.resource[resource_index];
+                auto & resource_task = resource_task_list[resource_index];
                 resource_definition.path = String::to_posix_style(fmt::format("{}/{}", information_structure.resource_directory[static_cast<size_t>(resource_information_structure.directory_index)], information_structure.resource_file[resource_index]));
                 resource_definition.chunk.resize(resource_information_structure.chunk_index.size());
-                auto chunk_data_list = std::vector<std::vector<uint8_t>>{resource_information_structure.chunk_index.size()};
+                resource_task.destination = fmt::format("{}/{}", resource_directory, resource_definition.path);
+                destination_directory.emplace(Path::getParents(resource_task.destination));
                 for (auto chunk_index : Range(resource_information_structure.chunk_index.size())) {
                     auto & chunk_information_structure = information_structure.chunk_information[static_cast<size_t>(resource_information_structure.chunk_index[chunk_index])];
-                    auto & chunk_definition = resource_definition.chunk[chunk_index];
-					auto & chunk_data = chunk_data_list[chunk_index];
-                    stream.read_pos = static_cast<size_t>(chunk_information_structure.offset);
-                    chunk_data.resize(static_cast<size_t>(chunk_information_structure.size_uncompressed));
-                    auto chunk_size_compressed = static_cast<size_t>(chunk_information_structure.size_compressed);
-                    auto chunk_flag = std::bitset<ChunkFlag::k_count>{static_cast<u_long>(chunk_information_structure.flag)};
-                    assert_conditional(!chunk_flag.test(ChunkFlag::unused_2), fmt::format("{}", Language::get("marmalade.dzip.invalid_bitset_unused_2")), "process_package");
-                    auto chunk_ok = false;
-                    if (chunk_flag.test(ChunkFlag::combuf)) {
-                        assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
-                        chunk_ok = true;
-                        assert_conditional(false, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_flag")), "process_package");
-                    }
-                    if (chunk_flag.test(ChunkFlag::dzip)) {
-                        assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
-                        chunk_ok = true;
-                        assert_conditional(false, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_flag")), "process_package");
-                    }
-                    if (chunk_flag.test(ChunkFlag::zlib)) {
-                        assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
-                        chunk_ok = true;
-                        assert_conditional(chunk_size_compressed == chunk_data.size(), String::format(fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_size")), std::to_string(chunk_size_compressed), std::to_string(chunk_data.size())), "process_package");
-                        chunk_definition.flag = ChunkFlagEnum::zlib;
-                        stream.read_pos += 10_size;
-                        chunk_data = Kernel::Definition::Compression::Zlib::uncompress_deflate(stream.readBytes(chunk_size_compressed - 10_size));
-                    }
-                    if (chunk_flag.test(ChunkFlag::bzip2)) {
-                        assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
-                        chunk_ok = true;
-                        assert_conditional(chunk_size_compressed == chunk_data.size(), String::format(fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_size")), std::to_string(chunk_size_compressed), std::to_string(chunk_data.size())), "process_package");
-                        chunk_definition.flag = ChunkFlagEnum::bzip2;
-                        auto chunk_stream = DataStreamView{};
-                        chunk_data = Kernel::Definition::Compression::Bzip2::uncompress(stream.readBytes(chunk_size_compressed));
-                    }
-                    if (chunk_flag.test(ChunkFlag::mp3)) {
-                        assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
-                        chunk_ok = true;
-                        assert_conditional(false, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_flag")), "process_package");
-                    }
-                    if (chunk_flag.test(ChunkFlag::jpeg)) {
-                        assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
-                        chunk_ok = true;
-                        assert_conditional(false, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_flag")), "process_package");
-                    }
-                    if (chunk_flag.test(ChunkFlag::zerod_out)) {
-                        assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
-                        chunk_ok = true;
-                        assert_conditional(chunk_size_compressed == k_none_size, String::format(fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_size")), std::to_string(chunk_size_compressed), std::to_string(chunk_data.size())), "process_package");
-                        chunk_definition.flag = ChunkFlagEnum::zerod_out;
-                    }
-                    if (chunk_flag.test(ChunkFlag::copy_coded)) {
-                        assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
-                        chunk_ok = true;
-                        assert_conditional(chunk_size_compressed == chunk_data.size(), String::format(fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_size")), std::to_string(chunk_size_compressed), std::to_string(chunk_data.size())), "process_package");
-                        chunk_definition.flag = ChunkFlagEnum::copy_coded;
-                        auto chunk_stream = DataStreamView{};
-                        chunk_data = stream.readBytes(chunk_size_compressed);
-                    }
-                    if (chunk_flag.test(ChunkFlag::lzma)) {
-                        assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
-                        chunk_ok = true;
-                        assert_conditional(chunk_size_compressed == chunk_data.size(), String::format(fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_size")), std::to_string(chunk_size_compressed), std::to_string(chunk_data.size())), "process_package");
-                        chunk_definition.flag = ChunkFlagEnum::lzma;
-                        auto chunk_stream = DataStreamView{};
-                        chunk_data = Kernel::Definition::Compression::Lzma::uncompress<false>(stream.readBytes(chunk_size_compressed));
-                    }
-                    if (chunk_flag.test(ChunkFlag::random_access)) {
-                        assert_conditional(!chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
-                        chunk_ok = true;
-                        assert_conditional(false, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_flag")), "process_package");
-                    }
-                    assert_conditional(chunk_ok, fmt::format("{}", Language::get("marmalade.dzip.invalid_chunk_test")), "process_package");
-                   // package_data_end_position = package_data_end_position > stream.read_pos ? package_data_end_position : stream.read_pos;
+                    resource_definition.chunk[chunk_index].flag = exchange_chunk_flag(chunk_information_structure);
+                    resource_task.chunk.emplace_back(ChunkTask{chunk_information_structure, resource_definition.chunk[chunk_index].flag});
                 }
-                write_bytes(fmt::format("{}/{}", resource_directory, resource_definition.path), chunk_data_list.front());
+            }
+            for (auto &element : destination_directory) {
+                FileSystem::create_directory(element);
+            }
+            auto thread_pool = ThreadPool{};
+            auto result = std::vector<std::future<void>>{};
+            result.reserve(resource_task_list.size());
+            for (auto &resource_task : resource_task_list) {
+                result.emplace_back(thread_pool.enqueue([archive, &resource_task]() -> void {
+                    auto resource_data = std::vector<uint8_t>{};
+                    for (auto chunk_index : Range(resource_task.chunk.size())) {
+                        auto chunk_data = uncompress_chunk(archive, resource_task.chunk[chunk_index]);
+                        if (chunk_index == k_begin_index) {
+                            resource_data = std::move(chunk_data);
+                        }
+                    }
+                    FileSystem::write_binary(resource_task.destination, resource_data);
+                    return;
+                }));
+            }
+            for (auto &element : result) {
+                element.get();
             }
             return;
         }
@@ -139,7 +269,16 @@ namespace Sen::Kernel::Support::Marmalade::DZip
             Package &definition,
             std::string_view destination) -> void
         {
-            process_package(stream, definition, fmt::format("{}/resource", destination));
+            process_package(stream.data_view(), definition, fmt::format("{}/resource", destination));
+            return;
+        }
+
+        inline static auto process_whole(
+            std::span<uint8_t const> archive,
+            Package &definition,
+            std::string_view destination) -> void
+        {
+            process_package(archive, definition, fmt::format("{}/resource", destination));
             return;
         }
 
@@ -147,9 +286,9 @@ namespace Sen::Kernel::Support::Marmalade::DZip
             std::string_view source,
             std::string_view destination) -> void
         {
-            auto stream = DataStreamView{source};
+            auto archive = FileSystem::MappedFile{source};
             auto definition = Package{};
-            process_whole(stream, definition, destination);
+            process_whole(archive.view(), definition, destination);
             write_json(fmt::format("{}/data.json", destination), definition);
             return;
         }
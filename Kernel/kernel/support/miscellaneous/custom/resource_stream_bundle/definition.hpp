@@ -18,7 +18,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PackagesSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["rton_count"] = nlohmann_json_t.rton_count;
@@ -29,7 +29,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PackagesSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("rton_count").get_to(nlohmann_json_t.rton_count);
@@ -47,7 +47,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Setting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["texture_format_category"] = nlohmann_json_t.texture_format_category;
@@ -57,7 +57,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Setting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("texture_format_category").get_to(nlohmann_json_t.texture_format_category);
@@ -83,7 +83,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ManifestGroupInfo &nlohmann_json_t) -> void
     {
         //nlohmann_json_j["expand_path"] = nlohmann_json_t.expand_path == String ? "string" : "array";
@@ -101,7 +101,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ManifestGroupInfo &nlohmann_json_t) -> void
     {
        // auto expand_path_string = nlohmann_json_j["expand_path"].get<std::string>();
@@ -124,7 +124,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
     };  
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PackagesInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["compression"] = nlohmann_json_t.compression;
@@ -134,7 +134,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PackagesInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("compression").get_to(nlohmann_json_t.compression);
@@ -153,7 +153,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const InformationStructure &nlohmann_json_t) -> void
     {
         nlohmann_json_j["version"] = nlohmann_json_t.version;
@@ -167,7 +167,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         InformationStructure &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("version").get_to(nlohmann_json_t.version);
@@ -223,7 +223,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
             auto packet_definition = PacketStructure{
                 .version = bundle.version};
             Sen::Kernel::Support::PopCap::ResourceStreamGroup::Common::packet_compression_from_data(manifest_info.compression, packet_definition.compression);
-            auto result = nlohmann::ordered_json{};
+            auto result = ordered_json{};
             if (manifest_info.allow_new_type_resource)
             {
 
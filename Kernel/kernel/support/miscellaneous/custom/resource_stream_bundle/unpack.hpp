@@ -29,7 +29,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
                 if (packet_id.starts_with(manifest_string))
                 {
                     manifest_info.resource_additional_name = packet_id.substr(manifest_string.size(), packet_id.size() - manifest_string.size());
-                    auto convertion = [&](nlohmann::ordered_json const &data, bool newtype) -> void
+                    auto convertion = [&](ordered_json const &data, bool newtype) -> void
                     {
                         // resource_info.expand_path = Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup::Common::get_expand_path(data);
                         auto res_temp = data;
@@ -69,7 +69,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
                             auto stream = DataStreamView{resource_data};
                             auto writer = JsonWriter{};
                             Sen::Kernel::Support::PopCap::ReflectionObjectNotation::Decode::process_whole(stream, writer);
-                            convertion(nlohmann::ordered_json::parse(writer.ToString()), false);
+                            convertion(ordered_json::parse(writer.ToString()), false);
                             break;
                         }
                         else
@@ -195,7 +195,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
                     auto contain = try_find_subgroup_information(group_id, subgroup_id, bundle, subgroup_information);
                     if (!packet_data_section_view_stored.contains(toupper_back(subgroup_id)) || !contain)
                     {
-                        auto unuse_resource = nlohmann::ordered_json{};
+                        auto unuse_resource = ordered_json{};
                         Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup::Common::exchange_subgroup_compression_info(subgroup_value, unuse_resource);
                         write_json(fmt::format("{}/unuse_resource/{}.json", destination, subgroup_id), unuse_resource);
                         continue;
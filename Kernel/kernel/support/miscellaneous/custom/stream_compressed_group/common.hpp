@@ -96,7 +96,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         }
 
         inline static auto get_expand_path(
-            nlohmann::ordered_json const &data) -> ExpandPath
+            ordered_json const &data) -> ExpandPath
         {
             try
             {
@@ -117,7 +117,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 }
                 return ExpandPath::Array;
             }
-            catch (nlohmann::ordered_json::exception &e)
+            catch (ordered_json::exception &e)
             {
                 return ExpandPath::String;
             }
@@ -125,7 +125,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
 
         template <auto use_string_for_style>
         inline static auto convert_general(
-            nlohmann::ordered_json const &data,
+            ordered_json const &data,
             GenenalSubgroupCompressedInfo &value) -> void
         {
             static_assert(sizeof(use_string_for_style) == sizeof(bool));
@@ -148,12 +148,12 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
 
         template <auto use_string_for_style>
         inline static auto convert_texture(
-            nlohmann::ordered_json const &data,
+            ordered_json const &data,
             TextureSubgroupCompressedInfo &value) -> void
         {
             static_assert(sizeof(use_string_for_style) == sizeof(bool));
             static_assert(use_string_for_style == true or use_string_for_style == false);
-            auto atlas = std::vector<nlohmann::ordered_json>{};
+            auto atlas = std::vector<ordered_json>{};
             for (auto &element : data)
             {
                 if (element.find("atlas") != element.end() && element["atlas"].get<bool>())
@@ -174,7 +174,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 }
                 atlas_data.dimension.width = parent["width"].get<int>();
                 atlas_data.dimension.height = parent["height"].get<int>();
-                auto children_in_current_parent = std::vector<nlohmann::ordered_json>{};
+                auto children_in_current_parent = std::vector<ordered_json>{};
                 for (auto &element : data)
                 {
                     if (element.find("parent") != element.end() and element["parent"].get<std::string>() == parent["id"].get<std::string>())
@@ -221,12 +221,12 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
 
         template <auto use_string_for_style>
         inline static auto exchange_custom_resource_info(
-            nlohmann::ordered_json &data,
+            ordered_json &data,
             CustomResourceInformation &value) -> void
         {
             static_assert(sizeof(use_string_for_style) == sizeof(bool));
             static_assert(use_string_for_style == true or use_string_for_style == false);
-            auto get_res = [](nlohmann::ordered_json const &res) -> int
+            auto get_res = [](ordered_json const &res) -> int
             {
                 if (res.is_string())
                 {
@@ -243,7 +243,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 assert_conditional(false, fmt::format("{}", Language::get("popcap.rsb.project.invalid_res_type")), "exchange_custom_resource_info");
             };
             auto first_where = [](
-                                   nlohmann::ordered_json const &data,
+                                   ordered_json const &data,
                                    std::string const &id) -> size_t
             {
                 for (auto index : Range(data.size()))
@@ -310,7 +310,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                                 }
                             }
                         }
-                        catch (nlohmann::ordered_json::exception &e)
+                        catch (ordered_json::exception &e)
                         {
                             assert_conditional(false, fmt::format("{}: {}", subgroup_id, e.what()), "convert_texture");
                         }
@@ -339,7 +339,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                         value.group[id].subgroup[id].general = general_subgroup;
                         data["groups"].erase(index);
                     }
-                    catch (nlohmann::ordered_json::exception &e)
+                    catch (ordered_json::exception &e)
                     {
                         assert_conditional(false, fmt::format("{}: {}", element["id"].get<std::string>(), e.what()), "convert_general");
                     }
@@ -355,13 +355,13 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         template <auto use_string_for_style>
         inline static auto convert_general(
             GenenalSubgroupCompressedInfo const &data,
-            nlohmann::ordered_json &value) -> void
+            ordered_json &value) -> void
         {
             static_assert(sizeof(use_string_for_style) == sizeof(bool));
             static_assert(use_string_for_style == true or use_string_for_style == false);
             for (auto &[data_id, data_value] : data.data)
             {
-                auto resource = nlohmann::ordered_json{
+                auto resource = ordered_json{
                     {"type", exchange_data_type(data_value.type)},
                     {"slot", 0},
                     {"id", data_id}};
@@ -381,13 +381,13 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         template <auto use_string_for_style>
         inline static auto convert_texture(
             TextureSubgroupCompressedInfo const &data,
-            nlohmann::ordered_json &value) -> void
+            ordered_json &value) -> void
         {
             static_assert(sizeof(use_string_for_style) == sizeof(bool));
             static_assert(use_string_for_style == true or use_string_for_style == false);
             for (auto &[packet_id, packet_value] : data.packet)
             {
-                auto resource = nlohmann::ordered_json{
+                auto resource = ordered_json{
                     {"type", exchange_data_type(DataType::Image)},
                     {"slot", 0},
                     {"id", packet_id},
@@ -406,7 +406,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 value["resources"].emplace_back(resource);
                 for (auto &[data_id, data_value] : packet_value.data)
                 {
-                    auto sub_resource = nlohmann::ordered_json{
+                    auto sub_resource = ordered_json{
                         {"type", exchange_data_type(data_value.type)},
                         {"slot", 0},
                         {"id", data_id},
@@ -448,26 +448,26 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         template <auto use_string_for_style>
         inline static auto exchange_custom_resource_info(
             CustomResourceInformation const &data,
-            nlohmann::ordered_json &value) -> void
+            ordered_json &value) -> void
         {
             static_assert(sizeof(use_string_for_style) == sizeof(bool));
             static_assert(use_string_for_style == true or use_string_for_style == false);
-            value = nlohmann::ordered_json{
+            value = ordered_json{
                 {"version", 1},
                 {"content_version", 1},
                 {"slot_count", 0},
-                {"groups", nlohmann::ordered_json::array()}};
+                {"groups", ordered_json::array()}};
             for (auto &[group_id, group_value] : data.group)
             {
                 if (group_value.composite)
                 {
-                    auto composite_result = nlohmann::ordered_json{
+                    auto composite_result = ordered_json{
                         {"type", "composite"},
                         {"id", group_id},
-                        {"subgroups", nlohmann::ordered_json::array()}};
+                        {"subgroups", ordered_json::array()}};
                     for (auto &[subgroup_id, subgroup_value] : group_value.subgroup)
                     {
-                        auto subgroup = nlohmann::ordered_json{{"id", subgroup_id}};
+                        auto subgroup = ordered_json{{"id", subgroup_id}};
                         if (subgroup_value.texture.resolution != static_cast<int>(k_none_size))
                         {
                             subgroup["res"] = std::to_string(subgroup_value.texture.resolution);
@@ -483,18 +483,18 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                     {
                         if (subgroup_value.texture.resolution != static_cast<int>(k_none_size))
                         {
-                            auto result = nlohmann::ordered_json{
+                            auto result = ordered_json{
                                 {"type", "simple"},
                                 {"id", subgroup_id},
                                 {"res", std::to_string(subgroup_value.texture.resolution)},
                                 {"parent", group_id},
-                                {"resources", nlohmann::ordered_json::array()}};
+                                {"resources", ordered_json::array()}};
                             convert_texture<use_string_for_style>(subgroup_value.texture, result);
                             value["groups"].emplace_back(result);
                         }
                         else
                         {
-                            auto result = nlohmann::ordered_json{
+                            auto result = ordered_json{
                                 {"type", "simple"},
                                 {"id", subgroup_id}};
                             if (!subgroup_value.general.locale.empty())
@@ -502,7 +502,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                                 result["loc"] = subgroup_value.general.locale;
                             }
                             result["parent"] = group_id;
-                            result["resources"] = nlohmann::ordered_json::array();
+                            result["resources"] = ordered_json::array();
                             convert_general<use_string_for_style>(subgroup_value.general, result);
                             value["groups"].emplace_back(result);
                         }
@@ -512,14 +512,14 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 {
                     for (auto &[subgroup_id, subgroup_value] : group_value.subgroup)
                     {
-                        auto result = nlohmann::ordered_json{
+                        auto result = ordered_json{
                             {"type", "simple"},
                             {"id", subgroup_id}};
                         if (!subgroup_value.general.locale.empty())
                         {
                             result["loc"] = subgroup_value.general.locale;
                         }
-                        result["resources"] = nlohmann::ordered_json::array();
+                        result["resources"] = ordered_json::array();
                         convert_general<use_string_for_style>(subgroup_value.general, result);
                         value["groups"].emplace_back(result);
                     }
@@ -530,7 +530,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         }
 
         inline static auto exchange_subgroup_compression_info(
-            nlohmann::ordered_json const &data,
+            ordered_json const &data,
             SubgroupCompressedInfo &value) -> void
         {
             if (data["type"] != nullptr)
@@ -605,7 +605,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
 
         inline static auto exchange_subgroup_compression_info(
             SubgroupCompressedInfo const &data,
-            nlohmann::ordered_json &value) -> void
+            ordered_json &value) -> void
         {
             if (data.texture.resolution != static_cast<int>(k_none_size))
             { // don't set resolution if texture unuse.
@@ -613,13 +613,13 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 auto &packet = value["packet"];
                 for (auto &[packet_id, packet_value] : data.texture.packet)
                 {
-                    packet[packet_id] = nlohmann::ordered_json{
+                    packet[packet_id] = ordered_json{
                         {"type", "Image"_sv}, // Always Image
                         {"path", packet_value.path},
                         {"dimension", {{"width", packet_value.dimension.width}, {"height", packet_value.dimension.height}}}};
                     for (auto &[data_id, data_value] : packet_value.data)
                     {
-                        auto &data_info = packet[packet_id]["data"][data_id] = nlohmann::ordered_json{
+                        auto &data_info = packet[packet_id]["data"][data_id] = ordered_json{
                             {"type", exchange_data_type(data_value.type)}, // Always Image
                             {"path", data_value.path},
                             {"default", {{"ax", data_value.texture_info.ax}, {"ay", data_value.texture_info.ay}, {"aw", data_value.texture_info.aw}, {"ah", data_value.texture_info.ah}, {"x", data_value.texture_info.x}, {"y", data_value.texture_info.y}}}};
@@ -641,7 +641,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 packet["type"] = "File"_sv; // Always File
                 for (auto &[data_id, data_value] : data.general.data)
                 {
-                    packet["data"][data_id] = nlohmann::ordered_json{
+                    packet["data"][data_id] = ordered_json{
                         {"type", exchange_data_type(data_value.type)},
                         {"path", data_value.path}};
                 }
@@ -1154,7 +1154,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 auto compressed_data = stream.readString(static_cast<size_t>(resource_content_information.information_compressed_size));
                 auto content_data_string = Sen::Kernel::Definition::Encryption::Base64::decode(compressed_data);
                 assert_conditional(content_data_string.size() == static_cast<size_t>(resource_content_information.information_string_size), String::format(fmt::format("{}", Language::get("pvz2.scg.invalid_resource_content_size")), std::to_string(resource_content_information.version), std::to_string(k_resource_content_information_version)), "exchange_stream_resource_group");
-                packet_subgroup.info = nlohmann::ordered_json::parse(content_data_string);
+                packet_subgroup.info = ordered_json::parse(content_data_string);
             }
             return;
         }
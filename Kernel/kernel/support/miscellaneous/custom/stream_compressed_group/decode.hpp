@@ -81,6 +81,34 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             return;
         }
 
+        using ResourceIndex = std::unordered_map<std::string, std::string>;
+
+        // Map the lower-case posix style of every resource path to its stored key, built once per packet
+
+        inline static auto exchange_resource_index(
+            std::map<std::string, std::vector<uint8_t>> const &resource_data_section_view_stored) -> ResourceIndex
+        {
+            auto index = ResourceIndex{};
+            index.reserve(resource_data_section_view_stored.size());
+            for (auto &[resource_path, resource_data] : resource_data_section_view_stored)
+            {
+                index.emplace(tolower_back(String::to_posix_style(resource_path)), resource_path);
+            }
+            return index;
+        }
+
+        inline static auto find_resource(
+            ResourceIndex const &index,
+            std::map<std::string, std::vector<uint8_t>> &resource_data_section_view_stored,
+            std::string const &path) -> std::map<std::string, std::vector<uint8_t>>::iterator
+        {
+            if (auto it = index.find(tolower_back(path)); it != index.end())
+            {
+                return resource_data_section_view_stored.find(it->second);
+            }
+            return resource_data_section_view_stored.end();
+        }
+
         inline static auto exchange_texture_simple(
             std::map<std::string, PacketInformation> &general_information,
             std::map<std::string, PacketInformation> &packet_information,
@@ -89,7 +117,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         {
             auto highest_resolution = definition.category.resolution.front();
             auto packet_compression = PacketCompression{};
-            auto common_subgroup_id_list = std::vector<std::string>{};
+            auto common_subgroup_id_list = std::set<std::string>{};
             for (auto &[id, packet_value] : packet_information)
             {
                 auto subgroup_id = exchange_subgroup_id(id, packet_value.subgroup_content_information.texture.resolution);
@@ -135,16 +163,13 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                             }
                         }
                     }
-                    auto result = nlohmann::ordered_json{};
+                    auto result = ordered_json{};
                     exchange_subgroup_compression_info(image_information, result);
                     write_json(fmt::format("{}/{}/{}.json", resource_destination, k_atlases_folder_string, subgroup_id), result); // atlases
                     auto &info = definition.subgroup[subgroup_id].resource[subgroup_id];
                     info.type = DataType::ImageData;
                     info.path = fmt::format("{}/{}.json", k_atlases_folder_string, subgroup_id);
-                    if (std::find(common_subgroup_id_list.begin(), common_subgroup_id_list.end(), subgroup_id) == common_subgroup_id_list.end())
-                    {
-                        common_subgroup_id_list.emplace_back(subgroup_id);
-                    }
+                    common_subgroup_id_list.emplace(subgroup_id);
                 }
                 else
                 {
@@ -175,10 +200,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                                     decode_popcap_file<false>(resource_data, resource_information, resource_destination);
                                     packet_info.resource[data_id] = resource_information;
                                     packet_value.resource_data_section_view_stored.erase(resource_path);
-                                    if (std::find(common_subgroup_id_list.begin(), common_subgroup_id_list.end(), subgroup_id) == common_subgroup_id_list.end())
-                                    {
-                                        common_subgroup_id_list.emplace_back(subgroup_id);
-                                    }
+                                    common_subgroup_id_list.emplace(subgroup_id);
                                     break;
                                 }
                             }
@@ -228,7 +250,9 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         inline static auto exchange_image_sprite(
             std::map<string, ImageSpriteInfo> &texture_sprite_view_stored,
             Sen::Kernel::Support::PopCap::Animation::Convert::ExtraInfo &extra,
-            std::string const &destination) -> void
+            std::string const &destination,
+            ThreadPool &pool,
+            std::vector<std::future<void>> &image_task) -> void
         {
             for (auto &[image_name, image_value] : extra.image)
             {
@@ -255,7 +279,8 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                         }
                         Sen::Kernel::Support::PopCap::Animation::Convert::Common::fix_media_image(fmt::format("{}/library/image/{}.xml", destination, image_name), image_path);
                     }
-                    write_image(fmt::format("{}/library/media/{}.png", destination, image_path), image_info.data);
+                    image_task.emplace_back(pool.enqueue([&image_info, image_destination = fmt::format("{}/library/media/{}.png", destination, image_path)]()
+                                                         { write_image(image_destination, image_info.data); }));
                     extra.image[image_name].additional = image_info.additional;
                     extra.image[image_name].use_image_additional = true;
                     image_info.is_use = true;
@@ -283,7 +308,12 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             auto highest_resolution = definition.category.resolution.front();
             auto packet_compression = PacketCompression{};
             auto texture_sprite_view_stored = std::map<string, ImageSpriteInfo>{};
-            auto common_subgroup_id_list = std::vector<std::string>{};
+            auto common_subgroup_id_list = std::set<std::string>{};
+            // the pool is declared after every container its tasks reference, so it is drained first
+            auto pool = ThreadPool{};
+            auto image_task = std::vector<std::future<void>>{};
+            auto texture_task = std::vector<std::future<std::map<string, ImageSpriteInfo>>>{};
+            auto texture_resource = std::vector<std::pair<std::map<std::string, std::vector<uint8_t>> *, std::string>>{};
             for (auto &[id, packet_value] : packet_information)
             {
                 if (packet_value.is_image)
@@ -294,22 +324,42 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                     {
                         continue;
                     }
+                    auto &resource_data_section_view_stored = packet_value.resource_data_section_view_stored;
+                    auto resource_index = exchange_resource_index(resource_data_section_view_stored);
                     for (auto &[packet_id, packet_info] : packet_value.subgroup_content_information.texture.packet)
                     {
                         definition.category.format = packet_info.additional.format;
-                        for (auto &[resource_path, resource_data] : packet_value.resource_data_section_view_stored)
+                        auto texture_path = tolower_back(fmt::format("{}.ptx", packet_info.path));
+                        auto resource = find_resource(resource_index, resource_data_section_view_stored, texture_path);
+                        if (resource == resource_data_section_view_stored.end())
                         {
-                            if (compare_string(String::to_posix_style(resource_path), fmt::format("{}.ptx", packet_info.path)))
-                            {
-                                auto image = Sen::Kernel::Support::Texture::InvokeMethod::decode_whole(resource_data, packet_info.dimension.width, packet_info.dimension.height, exchange_image_format(definition.texture_format_category, packet_info.additional.format));
-                                exchange_image_split(texture_sprite_view_stored, image, subgroup_id, packet_info);
-                                packet_value.resource_data_section_view_stored.erase(resource_path);
-                                break;
-                            }
+                            continue;
                         }
+                        auto format = exchange_image_format(definition.texture_format_category, packet_info.additional.format);
+                        texture_task.emplace_back(pool.enqueue([&resource_data = resource->second, &packet_info, subgroup_id, format]()
+                                                               {
+                            auto image = Sen::Kernel::Support::Texture::InvokeMethod::decode_whole(resource_data, packet_info.dimension.width, packet_info.dimension.height, format);
+                            auto sprite = std::map<string, ImageSpriteInfo>{};
+                            exchange_image_split(sprite, image, subgroup_id, packet_info);
+                            return sprite; }));
+                        texture_resource.emplace_back(&resource_data_section_view_stored, resource->first);
+                        resource_index.erase(texture_path);
                     }
                 }
             }
+            // merged in submission order, a later atlas still overrides a sprite id as the serial loop did
+            for (auto &task : texture_task)
+            {
+                for (auto &[data_id, data_value] : task.get())
+                {
+                    texture_sprite_view_stored.erase(data_id);
+                    texture_sprite_view_stored.emplace(data_id, std::move(data_value));
+                }
+            }
+            for (auto &[resource_data_section_view_stored, resource_path] : texture_resource)
+            {
+                resource_data_section_view_stored->erase(resource_path);
+            }
             for (auto &[id, packet_value] : packet_information)
             {
                 if (!packet_value.is_image)
@@ -322,6 +372,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                     }
                     exchange_compression(packet_value.packet_structure.compression, packet_compression);
                     auto &packet_info = definition.subgroup[subgroup_id];
+                    auto resource_index = exchange_resource_index(packet_value.resource_data_section_view_stored);
                     for (auto &[data_id, data_value] : packet_value.subgroup_content_information.general.data)
                     {
                         auto resource_information = ResourceInformation{
@@ -332,40 +383,33 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                             packet_info.resource[data_id] = resource_information;
                             continue;
                         }
-                        else
+                        auto resource = find_resource(resource_index, packet_value.resource_data_section_view_stored, data_value.path);
+                        if (resource == packet_value.resource_data_section_view_stored.end())
                         {
-                            for (auto &[resource_path, resource_data] : packet_value.resource_data_section_view_stored)
-                            {
-                                if (compare_string(String::to_posix_style(resource_path), data_value.path))
-                                {
-                                    switch (data_value.type)
-                                    {
-                                    case DataType::PopAnim:
-                                    {
-                                        auto extra = Sen::Kernel::Support::PopCap::Animation::Convert::ExtraInfo{
-                                            .resolution = highest_resolution};
-                                        exchange_animation(resource_data, extra, resource_information, resource_destination, animation_split_label);
-                                        auto animation_destination = fmt::format("{}/{}", resource_destination, resource_information.path);
-                                        exchange_image_sprite(texture_sprite_view_stored, extra, animation_destination);
-                                        write_json(fmt::format("{}/data.json", animation_destination), extra);
-                                        break;
-                                    }
-                                    default:
-                                    {
-                                        decode_popcap_file<false>(resource_data, resource_information, resource_destination);
-                                        break;
-                                    }
-                                    }
-                                    if (std::find(common_subgroup_id_list.begin(), common_subgroup_id_list.end(), subgroup_id) == common_subgroup_id_list.end())
-                                    {
-                                        common_subgroup_id_list.emplace_back(subgroup_id);
-                                    }
-                                    packet_info.resource[data_id] = resource_information;
-                                    packet_value.resource_data_section_view_stored.erase(resource_path);
-                                    break;
-                                }
-                            }
+                            continue;
+                        }
+                        auto &resource_data = resource->second;
+                        switch (data_value.type)
+                        {
+                        case DataType::PopAnim:
+                        {
+                            auto extra = Sen::Kernel::Support::PopCap::Animation::Convert::ExtraInfo{
+                                .resolution = highest_resolution};
+                            exchange_animation(resource_data, extra, resource_information, resource_destination, animation_split_label);
+                            auto animation_destination = fmt::format("{}/{}", resource_destination, resource_information.path);
+                            exchange_image_sprite(texture_sprite_view_stored, extra, animation_destination, pool, image_task);
+                            write_json(fmt::format("{}/data.json", animation_destination), extra);
+                            break;
+                        }
+                        default:
+                        {
+                            decode_popcap_file<false>(resource_data, resource_information, resource_destination);
+                            break;
+                        }
                         }
+                        common_subgroup_id_list.emplace(subgroup_id);
+                        packet_info.resource[data_id] = resource_information;
+                        packet_value.resource_data_section_view_stored.erase(resource);
                     }
                 }
             }
@@ -373,18 +417,17 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             {
                 if (!image_value.is_use)
                 {
-                    write_image(fmt::format("{}/{}.png", resource_destination, image_value.path), image_value.data);
+                    image_task.emplace_back(pool.enqueue([&image_value, image_destination = fmt::format("{}/{}.png", resource_destination, image_value.path)]()
+                                                         { write_image(image_destination, image_value.data); }));
                     definition.subgroup[image_value.subgroup_id].resource[image_id] = ResourceInformation{
                         .type = DataType::Image, // always image
                         .path = fmt::format("{}.png", image_value.path),
                         .use_image_additional = true,
                         .additional = image_value.additional};
-                    if (std::find(common_subgroup_id_list.begin(), common_subgroup_id_list.end(), image_value.subgroup_id) == common_subgroup_id_list.end())
-                    {
-                        common_subgroup_id_list.emplace_back(image_value.subgroup_id);
-                    }
+                    common_subgroup_id_list.emplace(image_value.subgroup_id);
                 }
             }
+            ThreadPool::wait_all(image_task);
             for (auto &subgroup_id : common_subgroup_id_list)
             {
                 auto &subgroup_value = definition.subgroup[subgroup_id];
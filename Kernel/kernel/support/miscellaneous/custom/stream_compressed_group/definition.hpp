@@ -8,6 +8,8 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
 
     using namespace Sen::Kernel::Support::Miscellaneous::Shared;
 
+    using Sen::Kernel::Definition::OnDemand;
+
     enum DecodeMethod
     {
         Simple = 0,
@@ -15,6 +17,14 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         Debug
     };
 
+    // how sprites are scaled down to the lower resolutions: nearest neighbour or avir
+
+    enum ResizeMethod
+    {
+        Nearest = 0,
+        Avir
+    };
+
     enum TextureFormatCategory
     {
         Android,
@@ -26,23 +36,26 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     {
         DecodeMethod decode_method;
         bool animation_split_label;
+        ResizeMethod resize_method;
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Setting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["decode_method"] = nlohmann_json_t.decode_method;
         nlohmann_json_j["animation_split_label"] = nlohmann_json_t.animation_split_label;
+        nlohmann_json_j["resize_method"] = nlohmann_json_t.resize_method;
         return;
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Setting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("decode_method").get_to(nlohmann_json_t.decode_method);
         nlohmann_json_j.at("animation_split_label").get_to(nlohmann_json_t.animation_split_label);
+        nlohmann_json_t.resize_method = nlohmann_json_j.value("resize_method", ResizeMethod::Nearest);
         return;
     }
 
@@ -74,7 +87,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const TextureDefault &nlohmann_json_t) -> void
     {
         nlohmann_json_j["ax"] = nlohmann_json_t.ax;
@@ -89,7 +102,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         TextureDefault &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("ax").get_to(nlohmann_json_t.ax);
@@ -111,7 +124,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const DataCompressedInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["type"] = nlohmann_json_t.type;
@@ -121,7 +134,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         DataCompressedInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("type").get_to(nlohmann_json_t.type);
@@ -137,7 +150,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ImageDimension &nlohmann_json_t) -> void
     {
         nlohmann_json_j["width"] = nlohmann_json_t.width;
@@ -146,7 +159,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ImageDimension &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("width").get_to(nlohmann_json_t.width);
@@ -164,7 +177,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const TextureResourceAdditional &nlohmann_json_t) -> void
     {
         nlohmann_json_j["index"] = nlohmann_json_t.index;
@@ -176,7 +189,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         TextureResourceAdditional &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("index").get_to(nlohmann_json_t.index);
@@ -196,7 +209,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const TexturePacketCompressedInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["path"] = nlohmann_json_t.path;
@@ -207,7 +220,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         TexturePacketCompressedInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("path").get_to(nlohmann_json_t.path);
@@ -225,7 +238,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const TextureSubgroupCompressedInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["resolution"] = nlohmann_json_t.resolution;
@@ -235,7 +248,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         TextureSubgroupCompressedInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("resolution").get_to(nlohmann_json_t.resolution);
@@ -251,7 +264,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const GenenalSubgroupCompressedInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["locale"] = nlohmann_json_t.locale;
@@ -260,7 +273,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         GenenalSubgroupCompressedInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("locale").get_to(nlohmann_json_t.locale);
@@ -275,7 +288,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SubgroupCompressedInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["general"] = nlohmann_json_t.general;
@@ -284,7 +297,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SubgroupCompressedInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("general").get_to(nlohmann_json_t.general);
@@ -299,7 +312,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const GroupCompressedInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["composite"] = nlohmann_json_t.composite;
@@ -308,7 +321,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         GroupCompressedInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("composite").get_to(nlohmann_json_t.composite);
@@ -329,7 +342,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const CustomResourceInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j["expand_path"] = nlohmann_json_t.expand_path;
@@ -338,7 +351,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         CustomResourceInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("expand_path").get_to(nlohmann_json_t.expand_path);
@@ -396,7 +409,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline static auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ResourceInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j["type"] = exchange_data_type(nlohmann_json_t.type);
@@ -409,7 +422,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ResourceInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_t.type = exchange_data_type(nlohmann_json_j["type"].get<std::string>());
@@ -419,12 +432,25 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             nlohmann_json_j.at("additional").get_to(nlohmann_json_t.additional);
             nlohmann_json_t.use_image_additional = true;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         return;
     }
 
+    inline auto from_ondemand(
+        OnDemand::Value &value,
+        ResourceInformation &nlohmann_json_t) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        auto type = std::string{};
+        OnDemand::field(object, "type", type);
+        nlohmann_json_t.type = exchange_data_type(type);
+        OnDemand::field(object, "path", nlohmann_json_t.path);
+        nlohmann_json_t.use_image_additional = OnDemand::optional_field(object, "additional", nlohmann_json_t.additional);
+        return;
+    }
+
     struct SubgroupCategory
     {
         bool common_type;
@@ -433,7 +459,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SubgroupCategory &nlohmann_json_t) -> void
     {
         nlohmann_json_j["common_type"] = nlohmann_json_t.common_type;
@@ -450,7 +476,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SubgroupCategory &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("common_type").get_to(nlohmann_json_t.common_type);
@@ -462,6 +488,17 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         return;
     }
 
+    inline auto from_ondemand(
+        OnDemand::Value &value,
+        SubgroupCategory &nlohmann_json_t) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "common_type", nlohmann_json_t.common_type);
+        OnDemand::nullable_field(object, "locale", nlohmann_json_t.locale);
+        OnDemand::field(object, "compression", nlohmann_json_t.compression);
+        return;
+    }
+
     struct SubgroupDataInformation
     {
         SubgroupCategory category;
@@ -469,7 +506,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SubgroupDataInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j["category"] = nlohmann_json_t.category;
@@ -478,7 +515,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SubgroupDataInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("category").get_to(nlohmann_json_t.category);
@@ -486,6 +523,16 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         return;
     }
 
+    inline auto from_ondemand(
+        OnDemand::Value &value,
+        SubgroupDataInformation &nlohmann_json_t) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "category", nlohmann_json_t.category);
+        OnDemand::field(object, "resource", nlohmann_json_t.resource);
+        return;
+    }
+
     struct GroupCategoryInfo
     {
         std::vector<int> resolution;
@@ -493,7 +540,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const GroupCategoryInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["resolution"] = nlohmann_json_t.resolution;
@@ -502,7 +549,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         GroupCategoryInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("resolution").get_to(nlohmann_json_t.resolution);
@@ -510,6 +557,16 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         return;
     }
 
+    inline auto from_ondemand(
+        OnDemand::Value &value,
+        GroupCategoryInfo &nlohmann_json_t) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "resolution", nlohmann_json_t.resolution);
+        OnDemand::field(object, "format", nlohmann_json_t.format);
+        return;
+    }
+
     struct InformationStructure
     {
         std::string expand_method;
@@ -521,7 +578,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const InformationStructure &nlohmann_json_t) -> void
     {
         if (!nlohmann_json_t.expand_method.empty())
@@ -548,7 +605,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         InformationStructure &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("version").get_to(nlohmann_json_t.version);
@@ -562,6 +619,22 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         return;
     }
 
+    inline auto from_ondemand(
+        OnDemand::Value &value,
+        InformationStructure &nlohmann_json_t) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "version", nlohmann_json_t.version);
+        OnDemand::field(object, "texture_format_category", nlohmann_json_t.texture_format_category);
+        OnDemand::field(object, "composite", nlohmann_json_t.composite);
+        if (nlohmann_json_t.composite)
+        {
+            OnDemand::field(object, "category", nlohmann_json_t.category);
+        }
+        OnDemand::field(object, "subgroup", nlohmann_json_t.subgroup);
+        return;
+    }
+
     //------------------------------------------------------------------------------
 
     struct DebuggerSubgroupInformation
@@ -572,7 +645,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const DebuggerSubgroupInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j["is_image"] = nlohmann_json_t.is_image;
@@ -582,7 +655,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         DebuggerSubgroupInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("is_image").get_to(nlohmann_json_t.is_image);
@@ -591,6 +664,17 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         return;
     }
 
+    inline auto from_ondemand(
+        OnDemand::Value &value,
+        DebuggerSubgroupInformation &nlohmann_json_t) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "is_image", nlohmann_json_t.is_image);
+        OnDemand::field(object, "packet_path", nlohmann_json_t.packet_path);
+        OnDemand::field(object, "info_path", nlohmann_json_t.info_path);
+        return;
+    }
+
     struct DebuggerInformation
     {
         std::string expand_method = "debug";
@@ -601,7 +685,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const DebuggerInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j["#expand_method"] = nlohmann_json_t.expand_method;
@@ -613,7 +697,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         DebuggerInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("version").get_to(nlohmann_json_t.version);
@@ -622,4 +706,16 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
         nlohmann_json_j.at("subgroup").get_to(nlohmann_json_t.subgroup);
         return;
     }
+
+    inline auto from_ondemand(
+        OnDemand::Value &value,
+        DebuggerInformation &nlohmann_json_t) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "version", nlohmann_json_t.version);
+        OnDemand::field(object, "texture_format_category", nlohmann_json_t.texture_format_category);
+        OnDemand::field(object, "composite", nlohmann_json_t.composite);
+        OnDemand::field(object, "subgroup", nlohmann_json_t.subgroup);
+        return;
+    }
 }
\ No newline at end of file
@@ -13,7 +13,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             PacketOriginalInformation &packet_original_information,
             std::string_view source) -> void
         {
-            DebuggerInformation definition = *FileSystem::read_json(fmt::format("{}/data.json", source));
+            auto definition = OnDemand::read_fs<DebuggerInformation>(fmt::format("{}/data.json", source));
             packet_original_information.version = definition.version;
             packet_original_information.composite = definition.composite;
             packet_original_information.texture_format_category = definition.texture_format_category;
@@ -31,28 +31,59 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             std::map<std::string, PacketInformation> &packet_information,
             std::map<std::string, SubgroupRawContent> &subgroup_content_map) -> void
         {
+            // every packet is packed and compressed on its own, the map is filled before the pool runs
             for (auto &[subgroup_id, subgroup_value] : packet_information)
             {
-                auto &subgroup_info = subgroup_content_map[subgroup_id];
+                subgroup_content_map[subgroup_id];
+            }
+            ThreadPool::parallel_for_each(packet_information, [&subgroup_content_map](auto &element) {
+                auto &[subgroup_id, subgroup_value] = element;
+                auto &subgroup_info = subgroup_content_map.at(subgroup_id);
                 subgroup_info.is_image = subgroup_value.is_image;
                 auto packet_stream = DataStreamView{};
                 Sen::Kernel::Support::PopCap::ResourceStreamGroup::Pack::process_whole(packet_stream, subgroup_value.packet_structure, subgroup_value.resource_data_section_view_stored);
                 subgroup_info.info = subgroup_value.subgroup_content_information;
                 subgroup_info.packet_data = std::move(packet_stream.toBytes());
-            }
+            });
             return;
         }
 
         // ----------------------------------------------------------------------------------------------------------------------
 
+        // sprites are always scaled from the decoded source, so no resolution depends on another
+        // both resamplers round the new size with Image::resize_dimension, so a sprite has the same size either way
+
+        inline static auto exchange_image_scale(
+            std::map<string, ImageSpriteInfo> const &texture_sprite_view_stored,
+            float ratio,
+            ResizeMethod const &resize_method) -> std::map<string, Definition::Image<int>>
+        {
+            auto result = std::map<string, Definition::Image<int>>{};
+            for (auto &[data_id, image_info] : texture_sprite_view_stored)
+            {
+                if (resize_method == ResizeMethod::Avir)
+                {
+                    auto new_width = Definition::Image<int>::resize_dimension(image_info.data.width, ratio);
+                    auto new_height = Definition::Image<int>::resize_dimension(image_info.data.height, ratio);
+                    result.emplace(data_id, Definition::Image<int>::scale(image_info.data, new_width, new_height));
+                }
+                else
+                {
+                    result.emplace(data_id, Definition::Image<int>::resize(image_info.data, ratio));
+                }
+            }
+            return result;
+        }
+
         inline static auto exchange_image_merge(
-            std::map<string, ImageSpriteInfo> &texture_sprite_view_stored,
+            std::map<string, ImageSpriteInfo> const &texture_sprite_view_stored,
             PacketInformation &packet_info,
             TextureFormatCategory const &texture_format_category,
             int const &format,
             int const &before_resolution,
             int const &after_resolution,
-            std::string const &subgroup_id) -> void
+            std::string const &subgroup_id,
+            ResizeMethod const &resize_method) -> void
         {
             auto check = [](
                              int const &data,
@@ -76,21 +107,26 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             packet_info.subgroup_content_information.texture.resolution = after_resolution;
             packet_info.is_image = true;
             auto resolution_resize_ratio = static_cast<float>(after_resolution) / static_cast<float>(before_resolution);
+            auto scaled_image = std::map<string, Definition::Image<int>>{};
             if (resolution_resize_ratio != static_cast<float>(1))
             {
-                for (auto &[data_id, image_info] : texture_sprite_view_stored)
+                scaled_image = exchange_image_scale(texture_sprite_view_stored, resolution_resize_ratio, resize_method);
+            }
+            auto get_image = [&](
+                                 std::string const &data_id) -> Definition::Image<int> const &
+            {
+                if (scaled_image.empty())
                 {
-                    auto resized_image = Definition::Image<int>::resize(image_info.data, resolution_resize_ratio);
-                    image_info.data.width = resized_image.width;
-                    image_info.data.height = resized_image.height;
-                    image_info.data.set_data(resized_image.data());
+                    return texture_sprite_view_stored.at(data_id).data;
                 }
-            }
+                return scaled_image.at(data_id);
+            };
             for (auto &[data_id, image_info] : texture_sprite_view_stored)
             {
-                check(image_info.data.width, image_width);
-                check(image_info.data.height, image_height);
-                rectangle_list.emplace_back(MaxRectsAlgorithm::Rectangle(image_info.data.width, image_info.data.height, data_id));
+                auto &image = get_image(data_id);
+                check(image.width, image_width);
+                check(image.height, image_height);
+                rectangle_list.emplace_back(MaxRectsAlgorithm::Rectangle(image.width, image.height, data_id));
             }
             log(image_width);
             log(image_height);
@@ -134,11 +170,12 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                             .y = image_info.additional.y,
                             .cols = image_info.additional.cols,
                             .rows = image_info.additional.rows}};
+                    auto &image = get_image(rect.source);
                     image_list[i].x = rect.x;
                     image_list[i].y = rect.y;
-                    image_list[i].width = image_info.data.width;
-                    image_list[i].height = image_info.data.height;
-                    image_list[i].set_data(image_info.data.data());
+                    image_list[i].width = image.width;
+                    image_list[i].height = image.height;
+                    image_list[i].set_data(image.data());
                 }
                 auto atlas_image = Definition::Image<int>::transparent(Definition::Dimension{max_rects_bin.width, max_rects_bin.height});
                 Definition::Image<int>::join_extend(atlas_image, image_list);
@@ -160,6 +197,27 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             return;
         }
 
+        /**
+         * Build the atlases of every resolution at once, each task scales, packs, composites and encodes its own packet
+         * resize_list: resolution and its packet, the packets are created before the pool runs
+         */
+
+        inline static auto exchange_image_merge_list(
+            std::map<string, ImageSpriteInfo> const &texture_sprite_view_stored,
+            std::vector<std::pair<int, PacketInformation *>> const &resize_list,
+            TextureFormatCategory const &texture_format_category,
+            int const &format,
+            int const &source_resolution,
+            std::string const &subgroup_id,
+            ResizeMethod const &resize_method) -> void
+        {
+            ThreadPool::parallel_for_each(resize_list, [&](auto &element) {
+                auto &[resize_resolution, packet_info_resize] = element;
+                exchange_image_merge(texture_sprite_view_stored, *packet_info_resize, texture_format_category, format, source_resolution, resize_resolution, fmt::format("{}_{}", subgroup_id, resize_resolution), resize_method);
+            });
+            return;
+        }
+
         inline static auto exchange_image_sprite(
             std::map<string, ImageSpriteInfo> &texture_sprite_view_stored,
             Sen::Kernel::Support::PopCap::Animation::Convert::ExtraInfo &extra,
@@ -263,7 +321,8 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             std::map<std::string, SubgroupDataInformation> &general_subgroup,
             std::vector<int> &resolution_list,
             std::string const &resource_source,
-            bool const &animation_split_label) -> void
+            bool const &animation_split_label,
+            ResizeMethod const &resize_method) -> void
         {
             auto highest_resolution = resolution_list.front();
             for (auto &[subgroup_id, packet_value] : definition.subgroup)
@@ -356,20 +415,21 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 if (texture_sprite_view_stored.size() != k_none_size)
                 {
                     auto before_resolution = highest_resolution;
+                    auto resize_list = std::vector<std::pair<int, PacketInformation *>>{};
                     for (auto resize_resolution : resolution_list)
                     {
                         if (before_resolution != highest_resolution)
                         {
                             assert_conditional(before_resolution > resize_resolution, String::format(fmt::format("{}", Language::get("popcap.rsb.project.resize_resolution_must_be_lower")), std::to_string(before_resolution), std::to_string(resize_resolution)), "exchange_texture_advanced");
                         }
-                        auto subgroup_id_with_resize_resolution = fmt::format("{}_{}", subgroup_id, resize_resolution);
-                        auto &packet_info_resize = packet_information[subgroup_id_with_resize_resolution];
+                        auto &packet_info_resize = packet_information[fmt::format("{}_{}", subgroup_id, resize_resolution)];
                         packet_info_resize.packet_structure.version = definition.version;
                         Sen::Kernel::Support::PopCap::ResourceStreamGroup::Common::packet_compression_from_data(packet_value.category.compression, packet_info_resize.packet_structure.compression);
                         packet_info_resize.subgroup_content_information.general.locale = packet_value.category.locale;
-                        exchange_image_merge(texture_sprite_view_stored, packet_info_resize, definition.texture_format_category, definition.category.format, before_resolution, resize_resolution, subgroup_id_with_resize_resolution);
+                        resize_list.emplace_back(resize_resolution, &packet_info_resize);
                         before_resolution = resize_resolution;
                     }
+                    exchange_image_merge_list(texture_sprite_view_stored, resize_list, definition.texture_format_category, definition.category.format, highest_resolution, subgroup_id, resize_method);
                 }
             }
             return;
@@ -380,7 +440,8 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             InformationStructure const &definition,
             std::map<std::string, SubgroupDataInformation> &general_subgroup,
             std::vector<int> &resolution_list,
-            std::string const &resource_source) -> void
+            std::string const &resource_source,
+            ResizeMethod const &resize_method) -> void
         {
             auto highest_resolution = resolution_list.front();
             resolution_list.erase(resolution_list.begin());
@@ -445,16 +506,17 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                             ++image_index;
                         }
                         auto before_resolution = highest_resolution;
+                        auto resize_list = std::vector<std::pair<int, PacketInformation *>>{};
                         for (auto resize_resolution : resolution_list)
                         {
                             assert_conditional(before_resolution > resize_resolution, String::format(fmt::format("{}", Language::get("popcap.rsb.project.resize_resolution_must_be_lower")), std::to_string(before_resolution), std::to_string(resize_resolution)), "exchange_texture_simple");
-                            auto subgroup_id_with_resize_resolution = fmt::format("{}_{}", subgroup_id, resize_resolution);
-                            auto &packet_info_resize = packet_information[subgroup_id_with_resize_resolution];
+                            auto &packet_info_resize = packet_information[fmt::format("{}_{}", subgroup_id, resize_resolution)];
                             packet_info_resize.packet_structure.version = definition.version;
                             packet_info_resize.packet_structure.compression = packet_info.packet_structure.compression;
-                            exchange_image_merge(texture_sprite_view_stored, packet_info_resize, definition.texture_format_category, definition.category.format, before_resolution, resize_resolution, subgroup_id_with_resize_resolution);
+                            resize_list.emplace_back(resize_resolution, &packet_info_resize);
                             before_resolution = resize_resolution;
                         }
+                        exchange_image_merge_list(texture_sprite_view_stored, resize_list, definition.texture_format_category, definition.category.format, highest_resolution, subgroup_id, resize_method);
                         break;
                     }
                     default:
@@ -510,12 +572,12 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             {
             case DecodeMethod::Advanced:
             {
-                exchange_texture_advanced(packet_information, definition, general_subgroup, resolution_list, resource_source, setting.animation_split_label);
+                exchange_texture_advanced(packet_information, definition, general_subgroup, resolution_list, resource_source, setting.animation_split_label, setting.resize_method);
                 break;
             }
             default:
             {
-                exchange_texture_simple(packet_information, definition, general_subgroup, resolution_list, resource_source);
+                exchange_texture_simple(packet_information, definition, general_subgroup, resolution_list, resource_source, setting.resize_method);
                 break;
             }
             }
@@ -561,7 +623,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 case DataType::PopAnim:
                 {
                     assert_conditional(compare_string(extension, ".json"_sv), String::format(fmt::format("{}", Language::get("pvz2.scg.must_be_json_file")), data_information.path), "encode_popcap_file");
-                    auto animation = *FileSystem::read_json(fmt::format("{}/{}", resource_source, data_information.path));
+                    auto animation = OnDemand::read_fs<Sen::Kernel::Support::PopCap::Animation::SexyAnimation>(fmt::format("{}/{}", resource_source, data_information.path));
                     auto stream = DataStreamView{};
                     Sen::Kernel::Support::PopCap::Animation::Encode::process_whole(stream, animation);
                     exchange_path(data_information.path, ".json"_sv, ""_sv);
@@ -679,10 +741,11 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             Setting const &setting) -> void
         {
             auto stream = DataStreamView{};
+            stream.use_write_buffer();
             auto definition = InformationStructure{};
             if (setting.decode_method != DecodeMethod::Debug)
             {
-                definition = *FileSystem::read_json(fmt::format("{}/data.json", source));
+                definition = OnDemand::read_fs<InformationStructure>(fmt::format("{}/data.json", source));
             }
             process_whole(stream, definition, source, setting);
             stream.out_file(destination);
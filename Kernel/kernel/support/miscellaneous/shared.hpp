@@ -49,14 +49,14 @@ namespace Sen::Kernel::Support::Miscellaneous::Shared
 
     inline static auto write_json(
         std::string const &destination,
-        nlohmann::ordered_json const &content) -> void
+        ordered_json const &content) -> void
     {
         FileSystem::create_directory(Path::getParents(destination));
         FileSystem::write_json(destination, content);
     }
 
     inline static auto dump_json(
-        nlohmann::ordered_json const &content) -> std::string
+        ordered_json const &content) -> std::string
     {
         return content.dump();
     }
@@ -214,6 +214,67 @@ namespace Sen::Kernel::Support::Miscellaneous::Shared
         return;
     }
 
+    // default budget of process_in_order_bounded: bytes held by tasks not yet consumed
+
+    inline static constexpr auto k_in_flight_size = 0x10000000_size;
+
+    /**
+     * Run count tasks on a fixed pool and consume the results in index order
+     * A task is launched only while the bytes held by unconsumed tasks fit in budget,
+     * the oldest task is always let through so an oversized one still runs
+     * weight: (index) -> bytes held by the task
+     * launch: (index) -> result, run on a worker
+     * consume: (index, result) on the calling thread, (index) when launch returns void
+     */
+
+    template <typename Weight, typename Launch, typename Consume>
+    inline auto process_in_order_bounded(
+        size_t count,
+        Weight &&weight,
+        Launch &&launch,
+        Consume &&consume,
+        size_t budget = k_in_flight_size) -> void
+    {
+        using Result = std::invoke_result_t<Launch &, size_t>;
+        auto pending_list = std::deque<std::pair<std::future<Result>, size_t>>{};
+        auto in_flight_size = k_none_size;
+        auto consume_index = k_begin_index;
+        auto thread_pool = ThreadPool{std::clamp(count, size_t{1}, ThreadPool::default_thread_count())};
+        auto consume_front = [&]() -> void
+        {
+            auto [result, size] = std::move(pending_list.front());
+            pending_list.pop_front();
+            in_flight_size -= size;
+            if constexpr (std::is_void<Result>::value)
+            {
+                result.get();
+                consume(consume_index++);
+            }
+            else
+            {
+                consume(consume_index++, result.get());
+            }
+            return;
+        };
+        for (auto index : Range(count))
+        {
+            auto size = weight(index);
+            while (!pending_list.empty() && in_flight_size + size > budget)
+            {
+                consume_front();
+            }
+            in_flight_size += size;
+            pending_list.emplace_back(thread_pool.enqueue([&launch, index]()
+                                                          { return launch(index); }),
+                                      size);
+        }
+        while (!pending_list.empty())
+        {
+            consume_front();
+        }
+        return;
+    }
+
     inline auto compute_utf8_character_extra_size(
         char const &character) -> size_t
     {
@@ -422,10 +483,11 @@ namespace Sen::Kernel::Support::Miscellaneous::Shared
                         stream.write_pos = current_postion;
                         work_option[index] = WorkOption{};
                     }
+                    auto cursor = stream.write_cursor((element_key.size() - character_index) * k_block_size);
                     while (character_index < element_key.size())
                     {
-                        stream.writeUint8(static_cast<uint8_t>(element_key[character_index]));
-                        stream.write_pos += 3;
+                        cursor.writeUint8(static_cast<uint8_t>(element_key[character_index]));
+                        cursor.writeUint24(0_ui);
                         ++character_index;
                     }
                     stream.writeNull(k_block_size);
@@ -449,20 +511,25 @@ namespace Sen::Kernel::Support::Miscellaneous::Shared
             auto before_pos = stream.read_pos;
             stream.read_pos = resource_information_section_offset;
             auto offset_limit = resource_information_section_offset + resource_information_section_size;
-            auto parent_string = std::map<size_t, std::string>{};
+            auto parent_string = std::unordered_map<size_t, std::string>{};
+            auto source = stream.data_view();
             while (stream.read_pos < offset_limit)
             {
                 auto key = std::string{};
                 auto position = static_cast<size_t>((stream.read_pos - resource_information_section_offset) / k_block_size);
-                if (parent_string.find(position) != parent_string.end())
+                if (auto parent = parent_string.find(position); parent != parent_string.end())
                 {
-                    key += parent_string[position];
-                    parent_string.erase(position);
+                    key = std::move(parent->second);
+                    parent_string.erase(parent);
                 }
+                // each block is a character followed by a 24-bit child offset, read straight from the buffer
                 while (true)
                 {
-                    auto current_character = stream.readUint8();
-                    auto child_string_offset = stream.readUint24();
+                    assert_conditional(stream.read_pos + k_block_size <= source.size(), fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "decode");
+                    auto block = source.data() + stream.read_pos;
+                    stream.read_pos += k_block_size;
+                    auto current_character = block[0];
+                    auto child_string_offset = static_cast<uint32_t>(block[1]) | (static_cast<uint32_t>(block[2]) << 8) | (static_cast<uint32_t>(block[3]) << 16);
                     if (child_string_offset != uint32_t{0})
                     {
                         parent_string[static_cast<size_t>(child_string_offset)] = key;
@@ -480,7 +547,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Shared
                 //
                 auto resource_information = ResourceType{};
                 exchanger(stream, resource_information);
-                value.emplace(key, resource_information);
+                value.emplace(std::move(key), std::move(resource_information));
             }
             stream.read_pos = before_pos;
             return;
@@ -10,6 +10,8 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
 
     using XMLElement = tinyxml2::XMLElement;
 
+    using XMLReader = Sen::Kernel::Definition::XMLReader;
+
     using Transform = std::array<double, 6>;
 
     using Color = std::array<double, 4>;
@@ -91,12 +93,12 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
         using FrameNodeList = std::vector<FrameNode>;
 
         inline auto static to_json_2(
-            nlohmann::ordered_json &nlohmann_json_j,
+            ordered_json &nlohmann_json_j,
             const FrameNodeList &nlohmann_json_t) -> void
         {
             for (auto &v : nlohmann_json_t)
             {
-                auto new_json = nlohmann::ordered_json{};
+                auto new_json = ordered_json{};
                 new_json["index"] = v.index;
                 new_json["duration"] = v.duration;
                 new_json["resource"] = v.resource;
@@ -110,7 +112,7 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
         using FrameNodeStructure = std::map<int, FrameNodeList>;
 
         inline auto static to_json(
-            nlohmann::ordered_json &nlohmann_json_j,
+            ordered_json &nlohmann_json_j,
             const FrameNodeStructure &nlohmann_json_t) -> void
         {
             for (auto &[i, v] : nlohmann_json_t)
@@ -410,6 +412,38 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
             return;
         }
 
+        inline static auto exchange_transform(
+            XMLReader const &data,
+            Transform &value) -> void
+        {
+            auto parse = [&](std::string_view name, std::string_view default_value) -> double
+            {
+                return std::stod(std::string{data.attribute(name, default_value)});
+            };
+            value = Transform{parse("a"_sv, "1"_sv), parse("b"_sv, "0"_sv), parse("c"_sv, "0"_sv), parse("d"_sv, "1"_sv), parse("tx"_sv, "0"_sv), parse("ty"_sv, "0"_sv)};
+            return;
+        }
+
+        inline static auto exchange_color(
+            XMLReader const &data,
+            Color &value) -> void
+        {
+            auto color_compute = [&](
+                                     std::string_view mutil,
+                                     std::string_view offset) -> double
+            {
+                auto mutil_value = std::stod(std::string{data.attribute(mutil, "1"_sv)});
+                auto offset_value = std::stod(std::string{data.attribute(offset, "0"_sv)});
+                return static_cast<double>((std::max)(0.0, (std::min)(255.0, mutil_value * 255.0 + offset_value)) / 255.0);
+            };
+            value = Color{
+                color_compute("redMultiplier"_sv, "redOffset"_sv),
+                color_compute("greenMultiplier"_sv, "greenOffset"_sv),
+                color_compute("blueMultiplier"_sv, "blueOffset"_sv),
+                color_compute("alphaMultiplier"_sv, "alphaOffset"_sv)};
+            return;
+        }
+
         inline static auto fix_media_image(
             std::string const&source,
             std::string const&media_name
@@ -13,7 +13,7 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Position &nlohmann_json_t) -> void
     {
         nlohmann_json_j["x"] = nlohmann_json_t.x;
@@ -22,7 +22,7 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Position &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("x").get_to(nlohmann_json_t.x);
@@ -39,7 +39,7 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ImageAdditional &nlohmann_json_t) -> void
     {
 
@@ -63,40 +63,52 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ImageAdditional &nlohmann_json_t) -> void
     {
         try
         {
             nlohmann_json_j.at("x").get_to(nlohmann_json_t.x);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("y").get_to(nlohmann_json_t.y);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("rows").get_to(nlohmann_json_t.rows);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("cols").get_to(nlohmann_json_t.cols);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         return;
     }
 
+    inline auto from_ondemand(
+        OnDemand::Value &value,
+        ImageAdditional &nlohmann_json_t) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::optional_field(object, "x", nlohmann_json_t.x);
+        OnDemand::optional_field(object, "y", nlohmann_json_t.y);
+        OnDemand::optional_field(object, "rows", nlohmann_json_t.rows);
+        OnDemand::optional_field(object, "cols", nlohmann_json_t.cols);
+        return;
+    }
+
     struct ImageDimension
     {
         int width;
@@ -104,7 +116,7 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ImageDimension &nlohmann_json_t) -> void
     {
         nlohmann_json_j["width"] = nlohmann_json_t.width;
@@ -113,7 +125,7 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ImageDimension &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("width").get_to(nlohmann_json_t.width);
@@ -132,7 +144,7 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ImageInfo &nlohmann_json_t) -> void
     {
         /*
@@ -154,14 +166,14 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ImageInfo &nlohmann_json_t) -> void
     {
         try
         {
             nlohmann_json_j.at("path").get_to(nlohmann_json_t.path);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -171,7 +183,7 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
             nlohmann_json_j.at("additional").get_to(nlohmann_json_t.additional);
             nlohmann_json_t.use_image_additional = true;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         return;
@@ -187,7 +199,7 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ExtraInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["version"] = nlohmann_json_t.version;
@@ -199,7 +211,7 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ExtraInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("version").get_to(nlohmann_json_t.version);
@@ -10,15 +10,28 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
 	class FromFlash : public Common
 	{
 	protected:
+		struct SymbolLibrary
+		{
+			std::set<std::string> image;
+			std::set<std::string> sprite;
+			std::set<std::string> label;
+		};
+
+		struct ResourceIndex
+		{
+			std::unordered_map<std::string, int> image;
+			std::unordered_map<std::string, int> sprite;
+		};
+
 		inline static auto load_flash_package(
 			FlashPackage &flash_package,
+			SymbolLibrary &symbol,
 			ExtraInfo const &extra,
 			std::string_view source) -> void
 		{
 			for (auto &[image_name, image_value] : extra.image)
 			{
-				auto &image_document = flash_package.library.image[image_name];
-				FileSystem::read_xml(fmt::format("{}/library/image/{}.xml", source, image_name), &image_document);
+				symbol.image.emplace(image_name);
 			}
 			auto &document = flash_package.document;
 			FileSystem::read_xml(fmt::format("{}/DOMDocument.xml", source), &document);
@@ -30,75 +43,109 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
 				auto element = std::string{child->FirstAttribute()->Value()};
 				if (element.starts_with("sprite"))
 				{
-					auto sprite_name = element.substr(7_size, element.size() - 11_size);
-					auto &sprite_document = flash_package.library.sprite[sprite_name];
-					FileSystem::read_xml(fmt::format("{}/library/sprite/{}.xml", source, sprite_name), &sprite_document);
+					symbol.sprite.emplace(element.substr(7_size, element.size() - 11_size));
 				}
 				if constexpr (split_label)
 				{
 					if (element.starts_with("label"))
 					{
-						auto label_name = element.substr(6_size, element.size() - 10_size);
-						auto &label_document = flash_package.library.label_document[label_name];
-						FileSystem::read_xml(fmt::format("{}/library/label/{}.xml", source, label_name), &label_document);
+						symbol.label.emplace(element.substr(6_size, element.size() - 10_size));
 					}
 				}
 			}
-			if constexpr (!split_label)
+			return;
+		}
+
+		inline static auto exchange_resource_index(
+			SymbolLibrary const &symbol,
+			ResourceIndex &resource_index) -> void
+		{
+			auto image_index = k_begin_index_int;
+			for (auto &image_name : symbol.image)
+			{
+				resource_index.image.emplace(image_name, image_index++);
+			}
+			auto sprite_index = k_begin_index_int;
+			for (auto &sprite_name : symbol.sprite)
 			{
-				auto &main_document = flash_package.library.main_sprite;
-				FileSystem::read_xml(fmt::format("{}/library/main_sprite.xml", source), &main_document);
+				resource_index.sprite.emplace(sprite_name, sprite_index++);
 			}
 			return;
 		}
 
+		// Image document is read with XMLReader, only the first element along the path below is visited:
+		// DOMSymbolItem > timeline > DOMTimeline > layers > DOMLayer > frames > DOMFrame > elements > DOMBitmapInstance > matrix > Matrix
+
 		inline static auto exchange_image_document(
 			AnimationImage &image,
 			std::string const &image_name,
-			XMLDocument &value) -> void
+			std::string_view document) -> void
 		{
-			auto dom_symbol_item = value.FirstChildElement("DOMSymbolItem");
-			assert_conditional(dom_symbol_item != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_DOMSymbolItem")), image_name), "exchange_image_document");
-			auto image_child = dom_symbol_item->FindAttribute("name");
-			assert_conditional((image_child != nullptr && fmt::format("image/{}", image_name) == std::string{image_child->Value()}), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_image_name")), image_name), "exchange_image_document");
-			auto timeline = dom_symbol_item->FirstChildElement("timeline");
-			assert_conditional(timeline != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_timeline")), image_name), "exchange_image_document");
-			auto dom_timeline = timeline->FirstChildElement("DOMTimeline");
-			assert_conditional(dom_timeline != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_DOMtimeline")), image_name), "exchange_image_document");
-			auto document_name = dom_timeline->FindAttribute("name");
-			assert_conditional((document_name != nullptr && image_name == std::string{document_name->Value()}), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_image_name")), image_name), "exchange_image_document");
-			auto layers = dom_timeline->FirstChildElement("layers");
-			assert_conditional(layers != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_layers")), image_name), "exchange_image_document");
-			auto dom_layer = layers->FirstChildElement("DOMLayer");
-			assert_conditional(dom_layer != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_DOMLayer")), image_name), "exchange_image_document");
-			auto frames = dom_layer->FirstChildElement("frames");
-			assert_conditional(frames != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_frames")), image_name), "exchange_image_document");
-			auto dom_frame = frames->FirstChildElement("DOMFrame");
-			assert_conditional(dom_frame != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_DOMframe")), image_name), "exchange_image_document");
-			auto elements = dom_frame->FirstChildElement("elements");
-			assert_conditional(elements != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_elements")), image_name), "exchange_image_document");
-			auto dom_bitmap_instance = elements->FirstChildElement("DOMBitmapInstance");
-			assert_conditional(dom_bitmap_instance != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_DOMBitmapInstance")), image_name), "exchange_image_document");
-			auto media_name = std::string{dom_bitmap_instance->FindAttribute("libraryItemName")->Value()}.substr(6_size);
+			static constexpr auto k_image_path = std::array<std::string_view, 11_size>{
+				"DOMSymbolItem"_sv, "timeline"_sv, "DOMTimeline"_sv, "layers"_sv, "DOMLayer"_sv, "frames"_sv,
+				"DOMFrame"_sv, "elements"_sv, "DOMBitmapInstance"_sv, "matrix"_sv, "Matrix"_sv};
+			auto found = std::array<bool, k_image_path.size()>{};
+			auto library_item_name = std::string{};
+			auto image_transform_matrix = k_initial_transform;
+			auto reader = XMLReader{document};
+			while (reader.read() != XMLReader::Token::end_document)
+			{
+				if (reader.token() != XMLReader::Token::start_element)
+				{
+					continue;
+				}
+				auto level = reader.depth() - 1_size;
+				if (level >= k_image_path.size() || found[level] || reader.name() != k_image_path[level])
+				{
+					reader.skip();
+					continue;
+				}
+				found[level] = true;
+				switch (level)
+				{
+				case 0_size:
+				{
+					auto image_child = reader.attribute("name"_sv);
+					assert_conditional((image_child.has_value() && fmt::format("image/{}", image_name) == XMLReader::unescape(*image_child)), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_image_name")), image_name), "exchange_image_document");
+					break;
+				}
+				case 2_size:
+				{
+					auto document_name = reader.attribute("name"_sv);
+					assert_conditional((document_name.has_value() && image_name == XMLReader::unescape(*document_name)), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_image_name")), image_name), "exchange_image_document");
+					break;
+				}
+				case 8_size:
+				{
+					library_item_name = XMLReader::unescape(reader.attribute("libraryItemName"_sv, ""_sv));
+					break;
+				}
+				case 10_size:
+				{
+					exchange_transform(reader, image_transform_matrix);
+					image_transform_matrix[0] /= k_media_scale_ratio;
+					image_transform_matrix[3] /= k_media_scale_ratio;
+					break;
+				}
+				default:
+					break;
+				}
+			}
+			assert_conditional(found[0], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_DOMSymbolItem")), image_name), "exchange_image_document");
+			assert_conditional(found[1], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_timeline")), image_name), "exchange_image_document");
+			assert_conditional(found[2], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_DOMtimeline")), image_name), "exchange_image_document");
+			assert_conditional(found[3], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_layers")), image_name), "exchange_image_document");
+			assert_conditional(found[4], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_DOMLayer")), image_name), "exchange_image_document");
+			assert_conditional(found[5], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_frames")), image_name), "exchange_image_document");
+			assert_conditional(found[6], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_DOMframe")), image_name), "exchange_image_document");
+			assert_conditional(found[7], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_elements")), image_name), "exchange_image_document");
+			assert_conditional(found[8], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_DOMBitmapInstance")), image_name), "exchange_image_document");
+			auto media_name = library_item_name.substr(6_size);
 			if (compare_string(Path::getExtension(media_name), ".png"_sv)) {
 				media_name = media_name.substr(k_begin_index, media_name.size() - ".png"_sv.size());
 			}
 			assert_conditional(media_name == image.path, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_image_path")), image_name), "exchange_image_document");
-			auto matrix = dom_bitmap_instance->FirstChildElement("matrix");
-			auto image_transform_matrix = Transform{};
-			if (matrix == nullptr)
-			{
-				image_transform_matrix = k_initial_transform;
-			}
-			else
-			{
-				assert_conditional(matrix != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.image_has_no_matrix")), image_name), "exchange_image_document");
-				auto transform_matrix = matrix->FirstChildElement("Matrix");
-				assert_conditional(transform_matrix != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_image_matrix")), image_name), "exchange_image_document");
-				exchange_transform(transform_matrix, image_transform_matrix);
-				image_transform_matrix[0] /= k_media_scale_ratio;
-				image_transform_matrix[3] /= k_media_scale_ratio;
-			}
+			assert_conditional(!found[9] || found[10], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_image_matrix")), image_name), "exchange_image_document");
 			k_version < 2 ? exchange_transform_from_standard_to_rotate(image_transform_matrix, image.transform) : exchange_tranform_by_copy(image_transform_matrix, image.transform);
 			return;
 		}
@@ -114,119 +161,157 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
 			return;
 		}
 
+		// Sprite document is read with XMLReader, every DOMLayer and DOMFrame is visited, other levels only take the first element:
+		// DOMSymbolItem > timeline > DOMTimeline > layers > DOMLayer > frames > DOMFrame > elements > DOMSymbolInstance > (matrix > Matrix | color > Color)
+
 		template <auto sprite_type>
 		inline static auto exchange_sprite_document(
 			std::string const &sprite_name,
-			PackageLibrary &package_library,
+			ResourceIndex const &resource_index,
 			FrameNodeStructure &frame_node_structure,
-			XMLDocument &document) -> void
+			std::string_view document) -> void
 		{
 			static_assert(sizeof(sprite_type) == sizeof(SpriteType));
-			auto dom_symbol_item = document.FirstChildElement("DOMSymbolItem");
-			assert_conditional(dom_symbol_item != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.sprite_has_no_DOMSymbolItem")), sprite_name), "exchange_sprite_document");
-			if constexpr (sprite_type == SpriteType::sprite)
+			static constexpr auto k_sprite_path = std::array<std::string_view, 9_size>{
+				"DOMSymbolItem"_sv, "timeline"_sv, "DOMTimeline"_sv, "layers"_sv, "DOMLayer"_sv, "frames"_sv,
+				"DOMFrame"_sv, "elements"_sv, "DOMSymbolInstance"_sv};
+			static constexpr auto k_layer_level = 4_size;
+			static constexpr auto k_frame_level = 6_size;
+			static constexpr auto k_instance_level = 8_size;
+			static constexpr auto k_property_level = 9_size;
+			enum class Property : uint8_t
 			{
-				auto name = fmt::format("sprite/{}", sprite_name);
-				auto name_child = dom_symbol_item->FindAttribute("name");
-				assert_conditional((name_child != nullptr || name == std::string{name_child->Value()}), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_sprite_name")), sprite_name), "exchange_sprite_document");
-			}
-			if constexpr (sprite_type == SpriteType::label)
-			{
-				auto name = fmt::format("label/{}", sprite_name);
-				auto name_child = dom_symbol_item->FindAttribute("name");
-				assert_conditional((name_child != nullptr || name == std::string{name_child->Value()}), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_sprite_name")), sprite_name), "exchange_sprite_document");
-			}
-			if constexpr (sprite_type == SpriteType::main_sprite)
-			{
-				auto name_child = dom_symbol_item->FindAttribute("name");
-				assert_conditional((name_child != nullptr || name_child->Value() == "main_sprite"), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_sprite_name")), sprite_name), "exchange_sprite_document");
-			}
-			auto timeline = dom_symbol_item->FirstChildElement("timeline");
-			assert_conditional(timeline != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.sprite_has_no_timeline")), sprite_name), "exchange_sprite_document");
-			auto dom_timeline = timeline->FirstChildElement("DOMTimeline");
-			assert_conditional(dom_timeline != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.sprite_has_no_DOMtimeline")), sprite_name), "exchange_sprite_document");
-			auto dom_name = dom_timeline->FindAttribute("name");
-			assert_conditional((dom_name != nullptr || sprite_name == std::string{dom_name->Value()}), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_sprite_name")), sprite_name), "exchange_sprite_document");
-			auto layers = dom_timeline->FirstChildElement("layers");
-			assert_conditional(layers != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.sprite_has_no_layers")), sprite_name), "exchange_sprite_document");
-			auto dom_layer_index = k_begin_index;
-			auto last_empty_frame = k_begin_index_int;
-			auto last_node_frame = k_begin_index_int;
-			for (auto dom_layer = layers->LastChildElement("DOMLayer"); dom_layer != nullptr; dom_layer = dom_layer->PreviousSiblingElement("DOMLayer"))
+				none,
+				matrix,
+				color
+			};
+			auto found = std::array<bool, k_sprite_path.size()>{};
+			auto layer_list = std::vector<FrameNodeList>{};
+			auto frame_node = FrameNode{};
+			auto current_property = Property::none;
+			auto has_matrix = false;
+			auto has_transform = false;
+			auto has_color = false;
+			auto has_color_value = false;
+			auto reader = XMLReader{document};
+			while (reader.read() != XMLReader::Token::end_document)
 			{
-				assert_conditional(dom_layer != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.sprite_has_no_DOMLayer")), sprite_name), "exchange_sprite_document");
-				auto frames = dom_layer->FirstChildElement("frames");
-				assert_conditional(frames != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.sprite_has_no_frames")), sprite_name), "exchange_sprite_document");
-				auto &frame_node_list = frame_node_structure[dom_layer_index];
-				++dom_layer_index;
-				for (auto dom_frame = frames->FirstChildElement("DOMFrame"); dom_frame != nullptr; dom_frame = dom_frame->NextSiblingElement("DOMFrame"))
+				if (reader.token() == XMLReader::Token::end_element)
 				{
-					assert_conditional(dom_frame != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.sprite_has_no_DOMFrame")), sprite_name), "exchange_sprite_document");
-					auto frame_index = static_cast<int>(std::stoi(dom_frame->FindAttribute("index")->Value()));
-					auto m_duration = dom_frame->FindAttribute("duration");
-					auto frame_duration = static_cast<int>(std::stoi((m_duration ? m_duration->Value() : "1")));
-					auto elements = dom_frame->FirstChildElement("elements");
-					auto dom_symbol_instance = elements->FirstChildElement("DOMSymbolInstance");
-					if (dom_symbol_instance == nullptr)
+					if (reader.depth() == k_layer_level)
 					{
-						continue;
+						assert_conditional(found[k_layer_level + 1_size], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.sprite_has_no_frames")), sprite_name), "exchange_sprite_document");
 					}
-					auto library_item_name = std::string{dom_symbol_instance->FindAttribute("libraryItemName")->Value()};
-					auto name_match = std::regex("(image|sprite)");
-					auto match_result = std::smatch{};
-					auto regex_result = std::regex_search(library_item_name, match_result, name_match);
-					assert_conditional(regex_result, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_name_match")), sprite_name), "exchange_sprite_document");
-					assert_conditional(match_result[0] == match_result[1], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.mismatch_name_match")), sprite_name), "exchange_sprite_document");
-					auto is_sprite = match_result[0].str() == "sprite";
-					auto resource_name = library_item_name.substr(match_result[0].str().size() + 1_size);
-					auto resource = k_native_index;
-					auto resource_index = k_begin_index;
-					for (auto &[l_name, e] : (is_sprite ? package_library.sprite : package_library.image))
+					if (reader.depth() == k_frame_level && found[k_instance_level])
 					{
-						if (resource_name == l_name)
-						{
-							resource = static_cast<int>(resource_index);
-							break;
-						}
-						++resource_index;
+						assert_conditional(!has_matrix || has_transform, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_sprite_matrix")), sprite_name), "exchange_sprite_document");
+						assert_conditional(!has_color || has_color_value, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_sprite_color")), sprite_name), "exchange_sprite_document");
+						layer_list.back().emplace_back(frame_node);
 					}
-					assert_conditional(resource != k_native_index, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.cannot_find_resource_name")), resource_name), "exchange_sprite_document");
-					auto frame_node = FrameNode{
-						.index = frame_index,
-						.duration = frame_duration,
-						.resource = resource,
-						.sprite = is_sprite};
-					auto matrix = dom_symbol_instance->FirstChildElement("matrix");
-					if (matrix != nullptr)
+					continue;
+				}
+				auto level = reader.depth() - 1_size;
+				if (level == k_property_level)
+				{
+					current_property = Property::none;
+					if (reader.name() == "matrix"_sv && !has_matrix)
 					{
-						auto x_matrix = matrix->FirstChildElement("Matrix");
-						assert_conditional(x_matrix != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_sprite_matrix")), sprite_name), "exchange_sprite_document");
-						exchange_transform(x_matrix, frame_node.transform);
+						has_matrix = true;
+						current_property = Property::matrix;
+						continue;
 					}
-					else
+					if (reader.name() == "color"_sv && !has_color)
 					{
-						frame_node.transform = k_initial_transform;
+						has_color = true;
+						current_property = Property::color;
+						continue;
 					}
-					auto color_child = dom_symbol_instance->FirstChildElement("color");
-					if (color_child != nullptr)
+					reader.skip();
+					continue;
+				}
+				if (level == k_property_level + 1_size)
+				{
+					if (current_property == Property::matrix && reader.name() == "Matrix"_sv && !has_transform)
 					{
-						auto x_color = color_child->FirstChildElement("Color");
-						assert_conditional(x_color != nullptr, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_sprite_color")), sprite_name), "exchange_sprite_document");
-						exchange_color(x_color, frame_node.color);
+						has_transform = true;
+						exchange_transform(reader, frame_node.transform);
 					}
-					else
+					if (current_property == Property::color && reader.name() == "Color"_sv && !has_color_value)
 					{
-						frame_node.color = k_initial_color;
+						has_color_value = true;
+						exchange_color(reader, frame_node.color);
 					}
-					frame_node_list.emplace_back(frame_node);
+					reader.skip();
+					continue;
+				}
+				if (level >= k_sprite_path.size() || reader.name() != k_sprite_path[level] || (found[level] && level != k_layer_level && level != k_frame_level))
+				{
+					reader.skip();
+					continue;
+				}
+				found[level] = true;
+				std::fill(found.begin() + level + 1_size, found.end(), false);
+				switch (level)
+				{
+				case 0_size:
+				case 2_size:
+				{
+					assert_conditional(reader.attribute("name"_sv).has_value(), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_sprite_name")), sprite_name), "exchange_sprite_document");
+					break;
+				}
+				case k_layer_level:
+				{
+					layer_list.emplace_back();
+					break;
+				}
+				case k_frame_level:
+				{
+					frame_node = FrameNode{
+						.index = static_cast<int>(std::stoi(std::string{reader.attribute("index"_sv, ""_sv)})),
+						.duration = static_cast<int>(std::stoi(std::string{reader.attribute("duration"_sv, "1"_sv)})),
+						.resource = k_native_index,
+						.sprite = false,
+						.first_frame = 0,
+						.transform = k_initial_transform,
+						.color = k_initial_color};
+					break;
+				}
+				case k_instance_level:
+				{
+					auto library_item_name = XMLReader::unescape(reader.attribute("libraryItemName"_sv, ""_sv));
+					auto image_position = library_item_name.find("image");
+					auto sprite_position = library_item_name.find("sprite");
+					assert_conditional(image_position != std::string::npos || sprite_position != std::string::npos, String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_name_match")), sprite_name), "exchange_sprite_document");
+					auto is_sprite = sprite_position < image_position;
+					auto resource_name = library_item_name.substr((is_sprite ? "sprite"_sv : "image"_sv).size() + 1_size);
+					auto &resource_map = is_sprite ? resource_index.sprite : resource_index.image;
+					auto resource = resource_map.find(resource_name);
+					assert_conditional(resource != resource_map.end(), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.cannot_find_resource_name")), resource_name), "exchange_sprite_document");
+					frame_node.resource = resource->second;
+					frame_node.sprite = is_sprite;
+					frame_node.transform = k_initial_transform;
+					frame_node.color = k_initial_color;
+					current_property = Property::none;
+					has_matrix = false;
+					has_transform = false;
+					has_color = false;
+					has_color_value = false;
+					break;
+				}
+				default:
+					break;
 				}
 			}
-			for (auto &element : frame_node_structure)
+			assert_conditional(found[0], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.sprite_has_no_DOMSymbolItem")), sprite_name), "exchange_sprite_document");
+			assert_conditional(found[1], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.sprite_has_no_timeline")), sprite_name), "exchange_sprite_document");
+			assert_conditional(found[2], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.sprite_has_no_DOMtimeline")), sprite_name), "exchange_sprite_document");
+			assert_conditional(found[3], String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.sprite_has_no_layers")), sprite_name), "exchange_sprite_document");
+			auto dom_layer_index = k_begin_index_int;
+			for (auto layer = layer_list.rbegin(); layer != layer_list.rend(); ++layer, ++dom_layer_index)
 			{
-				auto layer_index = element.first;
-				if (frame_node_structure[layer_index].size() == k_none_size)
+				if (layer->size() != k_none_size)
 				{
-					frame_node_structure.erase(layer_index);
+					frame_node_structure[dom_layer_index] = std::move(*layer);
 				}
 			}
 			return;
@@ -536,58 +621,94 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
 		inline static auto exchange_definition(
 			SexyAnimation &definition,
 			ExtraInfo const &extra,
-			FlashPackage &flash_package) -> void
+			FlashPackage &flash_package,
+			SymbolLibrary const &symbol,
+			std::string_view source) -> void
 		{
 			auto &package_library = flash_package.library;
 			// debug("exchange_simple_definition");
 			exchange_simple_definition(definition, extra);
 			exchange_default_extra(extra);
-			for (auto &[image_name, _v] : package_library.image)
+			auto resource_index = ResourceIndex{};
+			exchange_resource_index(symbol, resource_index);
+			// debug("exchange_label_info");
+			exchange_label_info(package_library.label, flash_package.document);
+			auto last_label_frame = package_library.label.size() == k_none_size ? k_begin_index_int : package_library.label.back().second.start + package_library.label.back().second.duration;
+			// every document is independent once the resource index is known, parse them on the pool and collect in order
+			auto thread_pool = ThreadPool{};
+			auto image_process = std::vector<std::future<AnimationImage>>{};
+			for (auto &image_name : symbol.image)
 			{
-				// debug(image_name);
-				assert_conditional(extra.image.contains(image_name), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.cannot_find_image_in_data")), image_name), "exchange_definition");
-				auto &image_value = extra.image.at(image_name);
-				assert_conditional(image_value.dimension.width >= static_cast<int>(k_none_size), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_image_width")), image_name), "exchange_definition");
-				assert_conditional(image_value.dimension.height >= static_cast<int>(k_none_size), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_image_height")), image_name), "exchange_definition");
-				auto image = AnimationImage{
-					.path = !image_value.path.empty() ? image_value.path : image_name,
-					.id = image_value.id,
-					.dimension = AnimationDimension{
-						static_cast<uint16_t>(image_value.dimension.width),
-						static_cast<uint16_t>(image_value.dimension.height)}};
-				exchange_image_document(image, image_name, package_library.image[image_name]);
-				definition.image.emplace_back(image);
+				image_process.emplace_back(thread_pool.enqueue([&, image_name]() -> AnimationImage {
+					auto &image_value = extra.image.at(image_name);
+					assert_conditional(image_value.dimension.width >= static_cast<int>(k_none_size), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_image_width")), image_name), "exchange_definition");
+					assert_conditional(image_value.dimension.height >= static_cast<int>(k_none_size), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.invalid_image_height")), image_name), "exchange_definition");
+					auto image = AnimationImage{
+						.path = !image_value.path.empty() ? image_value.path : image_name,
+						.id = image_value.id,
+						.dimension = AnimationDimension{
+							static_cast<uint16_t>(image_value.dimension.width),
+							static_cast<uint16_t>(image_value.dimension.height)}};
+					exchange_image_document(image, image_name, FileSystem::read_file(fmt::format("{}/library/image/{}.xml", source, image_name)));
+					return image;
+				}));
 			}
-			for (auto &element : package_library.sprite)
+			auto sprite_process = std::vector<std::future<AnimationSprite>>{};
+			for (auto &sprite_name : symbol.sprite)
 			{
-				
-				auto &sprite_name = element.first;
-				// debug(sprite_name);
-				exchange_sprite_document<SpriteType::sprite>(sprite_name, package_library, package_library.frame_node, package_library.sprite[sprite_name]);
-				auto sprite = AnimationSprite(sprite_name);
-				exchange_frame_node(sprite.frame, package_library.frame_node);
-				exchange_sprite_duration(sprite);
-				definition.sprite.emplace_back(sprite);
+				sprite_process.emplace_back(thread_pool.enqueue([&, sprite_name]() -> AnimationSprite {
+					auto frame_node_structure = FrameNodeStructure{};
+					exchange_sprite_document<SpriteType::sprite>(sprite_name, resource_index, frame_node_structure, FileSystem::read_file(fmt::format("{}/library/sprite/{}.xml", source, sprite_name)));
+					auto sprite = AnimationSprite(sprite_name);
+					exchange_frame_node(sprite.frame, frame_node_structure);
+					exchange_sprite_duration(sprite);
+					return sprite;
+				}));
 			}
-			// debug("exchange_label_info");
-			exchange_label_info(package_library.label, flash_package.document);
-			auto last_label_frame = package_library.label.size() == k_none_size ? k_begin_index_int : package_library.label.back().second.start + package_library.label.back().second.duration;
+			auto label_process = std::vector<std::future<FrameNodeStructure>>{};
 			if constexpr (split_label)
 			{
-				auto label_frame_node = tsl::ordered_map<std::string, FrameNodeStructure>{};
 				for (auto &element : package_library.label)
 				{
 					auto &label_name = element.first;
-					// debug(label_name);
-					assert_conditional(package_library.label_document.find(label_name) != package_library.label_document.end(),  String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.missing_label_xml")), label_name), "exchange_definition");
-					exchange_sprite_document<SpriteType::label>(label_name, package_library, label_frame_node[label_name], package_library.label_document.at(label_name));
+					assert_conditional(symbol.label.contains(label_name), String::format(fmt::format("{}", Language::get("popcap.animation.from_flash.missing_label_xml")), label_name), "exchange_definition");
+					label_process.emplace_back(thread_pool.enqueue([&, label_name]() -> FrameNodeStructure {
+						auto frame_node_structure = FrameNodeStructure{};
+						exchange_sprite_document<SpriteType::label>(label_name, resource_index, frame_node_structure, FileSystem::read_file(fmt::format("{}/library/label/{}.xml", source, label_name)));
+						return frame_node_structure;
+					}));
+				}
+			}
+			else
+			{
+				label_process.emplace_back(thread_pool.enqueue([&]() -> FrameNodeStructure {
+					auto frame_node_structure = FrameNodeStructure{};
+					exchange_sprite_document<SpriteType::main_sprite>(std::string{"main_sprite"}, resource_index, frame_node_structure, FileSystem::read_file(fmt::format("{}/library/main_sprite.xml", source)));
+					return frame_node_structure;
+				}));
+			}
+			for (auto &process : image_process)
+			{
+				definition.image.emplace_back(process.get());
+			}
+			for (auto &process : sprite_process)
+			{
+				definition.sprite.emplace_back(process.get());
+			}
+			if constexpr (split_label)
+			{
+				auto label_frame_node = tsl::ordered_map<std::string, FrameNodeStructure>{};
+				auto label_index = k_begin_index;
+				for (auto &element : package_library.label)
+				{
+					label_frame_node[element.first] = label_process[label_index++].get();
 				}
 				// debug("exchange_label");
 				exchange_label(label_frame_node, package_library.label, package_library.frame_node);
 			}
 			else
 			{
-				exchange_sprite_document<SpriteType::main_sprite>(std::string{"main_sprite"}, package_library, package_library.frame_node, package_library.main_sprite);
+				package_library.frame_node = label_process.front().get();
 			}
 			// debug("exchange_frame_node");
 			exchange_frame_node(definition.main_sprite.frame, package_library.frame_node);
@@ -626,10 +747,11 @@ namespace Sen::Kernel::Support::PopCap::Animation::Convert
 		{
 			static_assert(split_label == true || split_label == false, "split_label must be true or false");
 			auto flash_package = FlashPackage{};
+			auto symbol = SymbolLibrary{};
 			// debug("load_flash_package");
-			load_flash_package(flash_package, extra, source);
+			load_flash_package(flash_package, symbol, extra, source);
 			// debug("exchange_definition");
-			exchange_definition(definition, extra, flash_package);
+			exchange_definition(definition, extra, flash_package, symbol, source);
 			// debug("exchange_dom_document");
 			exchange_dom_document(definition, flash_package.library.label, flash_package.document);
 			// debug("exchange_sprite_duplicate");
@@ -4,6 +4,7 @@
 
 namespace Sen::Kernel::Support::PopCap::Animation
 {
+    using Sen::Kernel::Definition::OnDemand;
 
 
 #pragma region AnimationDimension
@@ -28,17 +29,17 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto to_json(
-        nlohmann::ordered_json &json,
+        ordered_json &json,
         const AnimationDimension &anim) -> void
     {
-        json = nlohmann::ordered_json{
+        json = ordered_json{
             {"width", anim.width},
             {"height", anim.height}};
         return;
     };
 
     inline static auto from_json(
-        const nlohmann::ordered_json &json,
+        const ordered_json &json,
         AnimationDimension &anim) -> void
     {
         json.at("width").get_to(anim.width);
@@ -46,6 +47,16 @@ namespace Sen::Kernel::Support::PopCap::Animation
         return;
     }
 
+    inline static auto from_ondemand(
+        OnDemand::Value &value,
+        AnimationDimension &anim) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "width", anim.width);
+        OnDemand::field(object, "height", anim.height);
+        return;
+    }
+
 #pragma endregion
 
 #pragma region AnimationSize
@@ -70,17 +81,17 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto to_json(
-        nlohmann::ordered_json &json,
+        ordered_json &json,
         const AnimationSize &anim) -> void
     {
-        json = nlohmann::ordered_json{
+        json = ordered_json{
             {"width", anim.width},
             {"height", anim.height}};
         return;
     };
 
     inline static auto from_json(
-        const nlohmann::ordered_json &json,
+        const ordered_json &json,
         AnimationSize &anim) -> void
     {
         json.at("width").get_to(anim.width);
@@ -88,6 +99,16 @@ namespace Sen::Kernel::Support::PopCap::Animation
         return;
     }
 
+    inline static auto from_ondemand(
+        OnDemand::Value &value,
+        AnimationSize &anim) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "width", anim.width);
+        OnDemand::field(object, "height", anim.height);
+        return;
+    }
+
 #pragma endregion
 
 #pragma region AnimationPosition
@@ -112,17 +133,17 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto to_json(
-        nlohmann::ordered_json &json,
+        ordered_json &json,
         const AnimationPosition &anim) -> void
     {
-        json = nlohmann::ordered_json{
+        json = ordered_json{
             {"x", anim.x},
             {"y", anim.y}};
         return;
     };
 
     inline static auto from_json(
-        const nlohmann::ordered_json &json,
+        const ordered_json &json,
         AnimationPosition &anim) -> void
     {
         json.at("x").get_to(anim.x);
@@ -130,6 +151,16 @@ namespace Sen::Kernel::Support::PopCap::Animation
         return;
     }
 
+    inline static auto from_ondemand(
+        OnDemand::Value &value,
+        AnimationPosition &anim) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "x", anim.x);
+        OnDemand::field(object, "y", anim.y);
+        return;
+    }
+
 #pragma endregion
 
 #pragma region using
@@ -150,10 +181,10 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto to_json(
-        nlohmann::ordered_json &json,
+        ordered_json &json,
         const AnimationImage &anim) -> void
     {
-        json = nlohmann::ordered_json{
+        json = ordered_json{
             {"path", anim.path},
             {"id", anim.id},
             {"dimension", anim.dimension},
@@ -162,7 +193,7 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto from_json(
-        const nlohmann::ordered_json &json,
+        const ordered_json &json,
         AnimationImage &anim) -> void
     {
         json.at("path").get_to(anim.path);
@@ -172,6 +203,18 @@ namespace Sen::Kernel::Support::PopCap::Animation
         return;
     }
 
+    inline static auto from_ondemand(
+        OnDemand::Value &value,
+        AnimationImage &anim) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "path", anim.path);
+        OnDemand::field(object, "id", anim.id);
+        OnDemand::field(object, "dimension", anim.dimension);
+        OnDemand::field(object, "transform", anim.transform);
+        return;
+    }
+
 #pragma endregion
 
 #pragma region AnimationWorkArea
@@ -197,17 +240,17 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto to_json(
-        nlohmann::ordered_json &json,
+        ordered_json &json,
         const AnimationWorkArea &anim) -> void
     {
-        json = nlohmann::ordered_json{
+        json = ordered_json{
             {"start", anim.start},
             {"duration", anim.duration}};
         return;
     };
 
     inline static auto from_json(
-        const nlohmann::ordered_json &json,
+        const ordered_json &json,
         AnimationWorkArea &anim) -> void
     {
         json.at("start").get_to(anim.start);
@@ -215,6 +258,16 @@ namespace Sen::Kernel::Support::PopCap::Animation
         return;
     }
 
+    inline static auto from_ondemand(
+        OnDemand::Value &value,
+        AnimationWorkArea &anim) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "start", anim.start);
+        OnDemand::field(object, "duration", anim.duration);
+        return;
+    }
+
 #pragma endregion
 
 #pragma region AnimationCommand
@@ -240,17 +293,17 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto to_json(
-        nlohmann::ordered_json &json,
+        ordered_json &json,
         const AnimationCommand &anim) -> void
     {
-        json = nlohmann::ordered_json{
+        json = ordered_json{
             {"command", anim.command},
             {"argument", anim.argument}};
         return;
     };
 
     inline static auto from_json(
-        const nlohmann::ordered_json &json,
+        const ordered_json &json,
         AnimationCommand &anim) -> void
     {
         json.at("command").get_to(anim.command);
@@ -258,6 +311,16 @@ namespace Sen::Kernel::Support::PopCap::Animation
         return;
     }
 
+    inline static auto from_ondemand(
+        OnDemand::Value &value,
+        AnimationCommand &anim) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "command", anim.command);
+        OnDemand::field(object, "argument", anim.argument);
+        return;
+    }
+
 #pragma endregion
 
 #pragma region AnimationAppend
@@ -275,10 +338,10 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto to_json(
-        nlohmann::ordered_json &json,
+        ordered_json &json,
         const AnimationAppend &anim) -> void
     {
-        json = nlohmann::ordered_json{
+        json = ordered_json{
             {"index", anim.index},
             {"name", anim.name},
             {"resource", anim.resource},
@@ -290,7 +353,7 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto from_json(
-        const nlohmann::ordered_json &json,
+        const ordered_json &json,
         AnimationAppend &anim) -> void
     {
         json.at("name").get_to(anim.name);
@@ -303,6 +366,21 @@ namespace Sen::Kernel::Support::PopCap::Animation
         return;
     }
 
+    inline static auto from_ondemand(
+        OnDemand::Value &value,
+        AnimationAppend &anim) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "index", anim.index);
+        OnDemand::field(object, "name", anim.name);
+        OnDemand::field(object, "resource", anim.resource);
+        OnDemand::field(object, "sprite", anim.sprite);
+        OnDemand::field(object, "additive", anim.additive);
+        OnDemand::field(object, "preload_frame", anim.preload_frame);
+        OnDemand::field(object, "time_scale", anim.time_scale);
+        return;
+    }
+
 #pragma endregion
 
 #pragma region AnimationChange
@@ -318,20 +396,20 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto to_json(
-        nlohmann::ordered_json &json,
+        ordered_json &json,
         const AnimationChange &anim) -> void
     {
-        nlohmann::ordered_json color = nullptr;
+        ordered_json color = nullptr;
         if (!(anim.color.at(0) == 0.0 && anim.color.at(1) == 0.0 && anim.color.at(2) == 0.0 && anim.color.at(3) == 0.0))
         {
             color = anim.color;
         }
-        nlohmann::ordered_json source_rectangle = nullptr;
+        ordered_json source_rectangle = nullptr;
         if (!(anim.source_rectangle.at(0) == 0.0 && anim.source_rectangle.at(1) == 0.0 && anim.source_rectangle.at(2) == 0.0 && anim.source_rectangle.at(3) == 0.0))
         {
             source_rectangle = anim.source_rectangle;
         }
-        json = nlohmann::ordered_json{
+        json = ordered_json{
             {"index", anim.index},
             {"transform", anim.transform},
             {"color", color},
@@ -342,7 +420,7 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto from_json(
-        const nlohmann::ordered_json &json,
+        const ordered_json &json,
         AnimationChange &anim) -> void
     {
         json.at("index").get_to(anim.index);
@@ -359,6 +437,19 @@ namespace Sen::Kernel::Support::PopCap::Animation
         return;
     }
 
+    inline static auto from_ondemand(
+        OnDemand::Value &value,
+        AnimationChange &anim) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "index", anim.index);
+        OnDemand::field(object, "transform", anim.transform);
+        OnDemand::nullable_field(object, "color", anim.color);
+        OnDemand::field(object, "sprite_frame_number", anim.sprite_frame_number);
+        OnDemand::nullable_field(object, "source_rectangle", anim.source_rectangle);
+        return;
+    }
+
 #pragma endregion
 
 #pragma region AnimationFrame
@@ -375,10 +466,10 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto to_json(
-        nlohmann::ordered_json &json,
+        ordered_json &json,
         const AnimationFrame &anim) -> void
     {
-        json = nlohmann::ordered_json{
+        json = ordered_json{
             {"label", anim.label},
             {"stop", anim.stop},
             {"command", anim.command},
@@ -389,7 +480,7 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto from_json(
-        const nlohmann::ordered_json &json,
+        const ordered_json &json,
         AnimationFrame &anim) -> void
     {
         json.at("label").get_to(anim.label);
@@ -401,6 +492,20 @@ namespace Sen::Kernel::Support::PopCap::Animation
         return;
     }
 
+    inline static auto from_ondemand(
+        OnDemand::Value &value,
+        AnimationFrame &anim) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "label", anim.label);
+        OnDemand::field(object, "stop", anim.stop);
+        OnDemand::field(object, "command", anim.command);
+        OnDemand::field(object, "remove", anim.remove);
+        OnDemand::field(object, "append", anim.append);
+        OnDemand::field(object, "change", anim.change);
+        return;
+    }
+
 #pragma endregion
 
 #pragma region AnimationSprite
@@ -427,10 +532,10 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto to_json(
-        nlohmann::ordered_json &json,
+        ordered_json &json,
         const AnimationSprite &anim) -> void
     {
-        json = nlohmann::ordered_json{
+        json = ordered_json{
             {"name", anim.name},
             {"work_area", anim.work_area},
             {"frame", anim.frame}};
@@ -438,7 +543,7 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto from_json(
-        const nlohmann::ordered_json &json,
+        const ordered_json &json,
         AnimationSprite &anim) -> void
     {
         json.at("name").get_to(anim.name);
@@ -447,6 +552,17 @@ namespace Sen::Kernel::Support::PopCap::Animation
         return;
     }
 
+    inline static auto from_ondemand(
+        OnDemand::Value &value,
+        AnimationSprite &anim) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "name", anim.name);
+        OnDemand::field(object, "work_area", anim.work_area);
+        OnDemand::field(object, "frame", anim.frame);
+        return;
+    }
+
 #pragma endregion
 
 #pragma region SexyAnimation
@@ -470,10 +586,10 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto to_json(
-        nlohmann::ordered_json &json,
+        ordered_json &json,
         const SexyAnimation &anim) -> void
     {
-        json = nlohmann::ordered_json{
+        json = ordered_json{
             {"version", anim.version},
             {"frame_rate", anim.frame_rate},
             {"position", anim.position},
@@ -485,7 +601,7 @@ namespace Sen::Kernel::Support::PopCap::Animation
     };
 
     inline static auto from_json(
-        const nlohmann::ordered_json &json,
+        const ordered_json &json,
         SexyAnimation &anim) -> void
     {
         json.at("version").get_to(anim.version);
@@ -498,5 +614,20 @@ namespace Sen::Kernel::Support::PopCap::Animation
         return;
     }
 
+    inline static auto from_ondemand(
+        OnDemand::Value &value,
+        SexyAnimation &anim) -> void
+    {
+        auto object = OnDemand::as_object(value);
+        OnDemand::field(object, "version", anim.version);
+        OnDemand::field(object, "frame_rate", anim.frame_rate);
+        OnDemand::field(object, "position", anim.position);
+        OnDemand::field(object, "size", anim.size);
+        OnDemand::field(object, "image", anim.image);
+        OnDemand::field(object, "sprite", anim.sprite);
+        OnDemand::field(object, "main_sprite", anim.main_sprite);
+        return;
+    }
+
 #pragma endregion
 }
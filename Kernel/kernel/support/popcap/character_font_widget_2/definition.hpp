@@ -59,7 +59,7 @@ namespace Sen::Kernel::Support::PopCap::CharacterFontWidget2
 	*/
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json,
+		const ordered_json & json,
 		FontCharacter & font
 	) -> void
 	{
@@ -82,11 +82,11 @@ namespace Sen::Kernel::Support::PopCap::CharacterFontWidget2
 	*/
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const FontCharacter & font
 	) -> void
 	{
-		json = nlohmann::ordered_json{
+		json = ordered_json{
 			{"index", font.index},
 			{"image_rect_x", font.image_rect_x},
 			{"image_rect_y", font.image_rect_y},
@@ -134,7 +134,7 @@ namespace Sen::Kernel::Support::PopCap::CharacterFontWidget2
 	*/
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json,
+		const ordered_json & json,
 		CharacterItem & font
 	) -> void
 	{
@@ -148,11 +148,11 @@ namespace Sen::Kernel::Support::PopCap::CharacterFontWidget2
 	*/
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const CharacterItem & font
 	) -> void
 	{
-		json = nlohmann::ordered_json{
+		json = ordered_json{
 			{"index", font.index},
 			{"value", font.value}
 		};
@@ -190,7 +190,7 @@ namespace Sen::Kernel::Support::PopCap::CharacterFontWidget2
 	*/
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json,
+		const ordered_json & json,
 		FontKerning & font
 	) -> void
 	{
@@ -204,11 +204,11 @@ namespace Sen::Kernel::Support::PopCap::CharacterFontWidget2
 	*/
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const FontKerning & font
 	) -> void
 	{
-		json = nlohmann::ordered_json{
+		json = ordered_json{
 			{"index", font.index},
 			{"offset", font.offset}
 		};
@@ -298,7 +298,7 @@ namespace Sen::Kernel::Support::PopCap::CharacterFontWidget2
 	*/
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json,
+		const ordered_json & json,
 		FontLayer & font
 	) -> void
 	{
@@ -338,11 +338,11 @@ namespace Sen::Kernel::Support::PopCap::CharacterFontWidget2
 	*/
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const FontLayer & font
 	) -> void
 	{
-		json = nlohmann::ordered_json{};
+		json = ordered_json{};
 		json["name"] = font.name;
 		json["tag_require"] = font.tag_require;
 		json["tag_exclude"] = font.tag_exclude;
@@ -412,7 +412,7 @@ namespace Sen::Kernel::Support::PopCap::CharacterFontWidget2
 	*/
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json,
+		const ordered_json & json,
 		CharacterFontWidget2 & font
 	) -> void
 	{
@@ -440,11 +440,11 @@ namespace Sen::Kernel::Support::PopCap::CharacterFontWidget2
 	*/
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const CharacterFontWidget2 & font
 	) -> void
 	{
-		json = nlohmann::ordered_json{
+		json = ordered_json{
 			{"unknown", font.unknown},
 			{"ascent", font.ascent},
 			{"ascent_padding", font.ascent_padding},
@@ -32,6 +32,16 @@ namespace Sen::Kernel::Support::PopCap::CompiledText
 	{
 
 	private:
+		inline static constexpr auto k_prefix_size = std::size_t{2};
+
+		inline static constexpr auto k_header_size = std::size_t{8};
+
+		inline static constexpr auto k_variant_header_size = std::size_t{16};
+
+		// base64 characters decoded per step, a multiple of 4
+
+		inline static constexpr auto k_chunk_size = std::size_t{0x40000};
+
 		/**
 		 * Buffer handling
 		 */
@@ -110,14 +120,60 @@ namespace Sen::Kernel::Support::PopCap::CompiledText
 
 		) -> void
 		{
-			auto decoded_base64 = DataStreamView{};
-			decoded_base64.fromString(Base64::decode(thiz.sen->toString()));
-			if (thiz.use_64_bit_variant) {
-				destination->append<unsigned char>(Zlib<true>{}.uncompress(Rijndael::decrypt<std::uint64_t, Rijndael::Mode::CBC>(reinterpret_cast<char *>(decoded_base64.getBytes(0x02, decoded_base64.size()).data()), thiz.key, thiz.iv, decoded_base64.size() - 0x02)));
-			}
-			else {
-				destination->append<unsigned char>(Zlib<false>{}.uncompress(Rijndael::decrypt<std::uint64_t, Rijndael::Mode::CBC>(reinterpret_cast<char *>(decoded_base64.getBytes(0x02, decoded_base64.size()).data()), thiz.key, thiz.iv, decoded_base64.size() - 0x02)));
+			// base64 chunks are decoded, decrypted in place and inflated straight into destination,
+			// which is sized from the popcap zlib header, so the whole cipher is never held at once
+			auto source = std::string_view{reinterpret_cast<char const *>(thiz.sen->data_view().data()), thiz.sen->size()};
+			auto block_size = thiz.iv.size();
+			auto header_size = thiz.use_64_bit_variant ? k_variant_header_size : k_header_size;
+			auto chain = std::string{thiz.iv};
+			auto staging = std::vector<std::uint8_t>(k_chunk_size / 4 * 3 + block_size);
+			auto header = std::array<std::uint8_t, k_variant_header_size>{};
+			auto header_position = std::size_t{0};
+			auto pending = std::size_t{0};
+			auto prefix = k_prefix_size;
+			auto inflater = std::optional<Compression::Zlib::Inflate>{};
+			auto read_uint32 = [&](std::size_t offset) {
+				auto value = std::uint32_t{0};
+				for (auto index : Range<std::size_t>(4)) {
+					value |= static_cast<std::uint32_t>(header[offset + index]) << (8 * index);
+				}
+				return value;
+			};
+			for (auto offset = std::size_t{0}; offset < source.size(); offset += k_chunk_size) {
+				auto size = Base64::decode(source.substr(offset, k_chunk_size), std::span<std::uint8_t>{staging}.subspan(pending));
+				auto skip = std::min(prefix, size);
+				std::memmove(staging.data() + pending, staging.data() + pending + skip, size - skip);
+				prefix -= skip;
+				pending += size - skip;
+				auto ready = pending / block_size * block_size;
+				if (ready == 0) {
+					continue;
+				}
+				auto plain = std::span<std::uint8_t>{staging.data(), ready};
+				auto next_chain = std::string{reinterpret_cast<char const *>(plain.data() + ready - block_size), block_size};
+				Rijndael::decrypt<Rijndael::Mode::CBC>(plain, plain, thiz.key, chain);
+				chain = std::move(next_chain);
+				if (header_position < header_size) {
+					auto count = std::min(header_size - header_position, plain.size());
+					std::memcpy(header.data() + header_position, plain.data(), count);
+					header_position += count;
+					plain = plain.subspan(count);
+					if (header_position == header_size) {
+						assert_conditional(read_uint32(0) == static_cast<std::uint32_t>(PopCap::Zlib::Common::magic), fmt::format("{}: 0x{:X}", Language::get("popcap.zlib.uncompress.mismatch_zlib_magic"), PopCap::Zlib::Common::magic), "process");
+						auto uncompressed_size = static_cast<std::size_t>(read_uint32(thiz.use_64_bit_variant ? 8 : 4));
+						auto destination_offset = thiz.destination->write_pos;
+						thiz.destination->write_cursor(uncompressed_size);
+						inflater.emplace(thiz.destination->mutable_view().subspan(destination_offset, uncompressed_size));
+					}
+				}
+				if (inflater.has_value()) {
+					inflater->update(plain);
+				}
+				std::memmove(staging.data(), staging.data() + ready, pending - ready);
+				pending -= ready;
 			}
+			assert_conditional(pending == 0 && prefix == 0, fmt::format("{}", Language::get("rijndael.decrypt.cipher_size_is_invalid_to_decrypt")), "process");
+			assert_conditional(inflater.has_value() && inflater->is_finished() && inflater->size() == read_uint32(thiz.use_64_bit_variant ? 8 : 4), fmt::format("{}", Language::get("zlib.uncompress.failed")), "process");
 			return;
 		}
 
@@ -25,6 +25,12 @@ namespace Sen::Kernel::Support::PopCap::CompiledText {
 
 		private:
 
+			inline static constexpr auto k_prefix_size = std::size_t{2};
+
+			inline static constexpr auto k_header_size = std::size_t{8};
+
+			inline static constexpr auto k_variant_header_size = std::size_t{16};
+
 			/**
 			 * Key for compiled text
 			*/
@@ -108,16 +114,32 @@ namespace Sen::Kernel::Support::PopCap::CompiledText {
 
 			) -> void
 			{
-				auto buffer = DataStreamView{};
-				buffer.writeBytes(PopCap::Zlib::Compress<false>{}.compress(thiz.sen->getBytes(0, thiz.sen->size())));
-				fill_rijndael_block(buffer, thiz.iv);
-				auto decoded_base64 = DataStreamView{};
-				decoded_base64.writeUint8(0x10);
-				decoded_base64.writeUint8(0x00);
-				decoded_base64.writeBytes(Rijndael::encrypt<std::uint64_t, Sen::Kernel::Definition::Encryption::Rijndael::Mode::CBC>(reinterpret_cast<char *>(buffer.getBytes(0, buffer.size()).data()), key, iv, buffer.size()));
-				auto encoded_base64 = DataStreamView{};
-				encoded_base64.fromString(Base64::encode(decoded_base64.getBytes(0, decoded_base64.size()).data(), decoded_base64.size()));
-				result->writeBytes(encoded_base64.getBytes(0, encoded_base64.size()));
+				// [0x10 0x00] [popcap zlib header] [zlib stream] [padding], encrypted in place then base64 encoded into result
+				auto source = thiz.sen->data_view();
+				auto header_size = thiz.use_64_bit_variant ? k_variant_header_size : k_header_size;
+				auto compressed_bound = static_cast<std::size_t>(compressBound(static_cast<uLong>(source.size())));
+				auto buffer = std::vector<std::uint8_t>(k_prefix_size + header_size + compressed_bound + thiz.iv.size());
+				buffer[0] = 0x10;
+				buffer[1] = 0x00;
+				auto write_uint32 = [&](std::size_t offset, std::uint32_t value) {
+					for (auto index : Range<std::size_t>(4)) {
+						buffer[offset + index] = static_cast<std::uint8_t>(value >> (8 * index));
+					}
+				};
+				write_uint32(k_prefix_size, static_cast<std::uint32_t>(PopCap::Zlib::Common::magic));
+				write_uint32(k_prefix_size + (thiz.use_64_bit_variant ? 8 : 4), static_cast<std::uint32_t>(source.size()));
+				auto compressed_size = static_cast<uLongf>(compressed_bound);
+				auto ret = compress2(buffer.data() + k_prefix_size + header_size, &compressed_size, source.data(), static_cast<uLong>(source.size()), static_cast<int>(PopCap::Zlib::Common::level));
+				assert_conditional(ret == Z_OK, fmt::format("{}", Kernel::Language::get("zlib.compress.failed")), "process");
+				auto plain_size = header_size + static_cast<std::size_t>(compressed_size);
+				plain_size += thiz.iv.size() - ((plain_size + thiz.iv.size() - 1) % thiz.iv.size() + 1);
+				auto plain = std::span<std::uint8_t>{buffer}.subspan(k_prefix_size, plain_size);
+				Rijndael::encrypt<Rijndael::Mode::CBC>(plain, plain, thiz.key, thiz.iv);
+				auto encoded_size = Base64::encoded_size(k_prefix_size + plain_size);
+				auto offset = thiz.result->write_pos;
+				thiz.result->write_cursor(encoded_size);
+				auto destination = thiz.result->mutable_view().subspan(offset, encoded_size);
+				Base64::encode(std::span<std::uint8_t const>{buffer.data(), k_prefix_size + plain_size}, std::span<char>{reinterpret_cast<char *>(destination.data()), destination.size()});
 				return;
 			}
 
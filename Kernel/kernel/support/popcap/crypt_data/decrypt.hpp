@@ -48,21 +48,15 @@ namespace Sen::Kernel::Support::PopCap::CryptData
 				std::string_view key
 			) -> std::vector<std::uint8_t>
 			{
-				auto result = DataStreamView{};
-				auto code = std::vector<uint8_t>{key.begin(), key.end()};
 				assert_conditional((view.readString(BasicDefinition::magic.size()) == std::string{BasicDefinition::magic.begin(), BasicDefinition::magic.end()}), fmt::format("{}", Kernel::Language::get("popcap.crypt_data.decrypt.mismatch_magic")), "process");
             	auto size = view.readUint64();
+				auto data = view.data_view().subspan(view.get_read_pos());
+				auto result = std::vector<std::uint8_t>{data.begin(), data.end()};
 				if (view.size() > 0x112){
-					auto index = 0;
-					auto arysize = key.size();
-					for (auto i : Range<int>(0x100))
-					{
-						result.writeUint8((view.readUint8() ^ code[index++]));
-						index %= arysize;
-					}
+					auto code = std::span<std::uint8_t const>{reinterpret_cast<std::uint8_t const*>(key.data()), key.size()};
+					Sen::Kernel::Definition::Encryption::XOR::xor_inplace(std::span<std::uint8_t>{result}.first(0x100), code, 0_size);
 				}
-				result.append(view.get(view.get_read_pos(), view.size()));
-				return result.toBytes();
+				return result;
 			}
 
 			
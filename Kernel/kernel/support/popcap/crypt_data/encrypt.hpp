@@ -45,22 +45,20 @@ namespace Sen::Kernel::Support::PopCap::CryptData
 			) -> std::vector<std::uint8_t>
 			{
             	auto size = view.size();
-				auto result = DataStreamView{};
-				result.append<uint8_t, BasicDefinition::magic.size()>(BasicDefinition::magic);
-				result.writeUint64(size);
-				auto code = std::vector<uint8_t>{key.begin(), key.end()};
+				auto header_size = BasicDefinition::magic.size() + sizeof(std::uint64_t);
+				auto data = view.data_view();
+				auto result = std::vector<std::uint8_t>(header_size + data.size());
+				std::copy(BasicDefinition::magic.begin(), BasicDefinition::magic.end(), result.begin());
+				for (auto index : Range(sizeof(std::uint64_t))) {
+					result[BasicDefinition::magic.size() + index] = static_cast<std::uint8_t>(static_cast<std::uint64_t>(size) >> (index * 8));
+				}
+				std::copy(data.begin(), data.end(), result.begin() + header_size);
 				if (size >= 0x100)
 				{
-					auto index = 0;
-					auto arysize = key.size();
-					for (auto i : Range<int>(0x100))
-					{
-						result.writeUint8((view.readUint8() ^ code[index++]));
-						index %= arysize;
-					}
+					auto code = std::span<std::uint8_t const>{reinterpret_cast<std::uint8_t const*>(key.data()), key.size()};
+					Sen::Kernel::Definition::Encryption::XOR::xor_inplace(std::span<std::uint8_t>{result}.subspan(header_size, 0x100), code, 0_size);
 				}
-				result.append(view.get(view.get_write_pos(), view.size()));
-				return result.toBytes();
+				return result;
 			}
 
 			/**
@@ -0,0 +1,337 @@
+#pragma once
+
+#include "kernel/definition/utility.hpp"
+#include "kernel/support/miscellaneous/shared.hpp"
+
+namespace Sen::Kernel::Support::PopCap::LawnStrings
+{
+    using namespace Definition;
+
+    using namespace Sen::Kernel::Support::Miscellaneous::Shared;
+
+    /**
+     * LawnStrings conversion between the bracketed text and the LawnStringsData json
+     * text: utf-16le text, cn-text: utf-8 text,
+     * map: LocStringValues as an object (6.8.1 to 8.9.1), array: LocStringValues as key, value pairs (8.9.1 onward)
+     */
+
+    struct Convert
+    {
+    public:
+        enum class Type : uint8_t
+        {
+            text,
+            cn_text,
+            array,
+            map,
+        };
+
+        // key, value, key, value...
+
+        using List = std::vector<std::string>;
+
+    protected:
+        inline static constexpr auto k_object_class = "LawnStringsData"_sv;
+
+        inline static constexpr auto k_version = 1;
+
+        inline static auto is_header(
+            std::string_view line) -> bool
+        {
+            while (!line.empty() && std::isspace(static_cast<unsigned char>(line.back())))
+            {
+                line.remove_suffix(1_size);
+            }
+            return line.size() >= 2_size && line.front() == '[' && line.back() == ']';
+        }
+
+        inline static auto exchange_key(
+            std::string_view line) -> std::string
+        {
+            while (std::isspace(static_cast<unsigned char>(line.back())))
+            {
+                line.remove_suffix(1_size);
+            }
+            return std::string{line.substr(1_size, line.size() - 2_size)};
+        }
+
+        // a blank line becomes a line break of its own, the line before the next header is the separator
+
+        inline static auto exchange_value(
+            std::vector<std::string_view> const &line,
+            size_t begin,
+            size_t end) -> std::string
+        {
+            auto size = k_none_size;
+            for (auto index = begin; index < end; ++index)
+            {
+                size += line[index].size() + 2_size;
+            }
+            auto result = std::string{};
+            result.reserve(size);
+            for (auto index = begin; index < end; ++index)
+            {
+                if (line[index].empty())
+                {
+                    result += "\r\n"_sv;
+                    continue;
+                }
+                if (!result.empty())
+                {
+                    result += "\r\n"_sv;
+                }
+                result += line[index];
+            }
+            return result;
+        }
+
+        inline static auto exchange_text_line(
+            std::string &destination,
+            std::string_view key,
+            std::string_view value) -> void
+        {
+            destination += '[';
+            destination += key;
+            destination += "]\n"_sv;
+            for (auto c : value)
+            {
+                if (c != '\r')
+                {
+                    destination += c;
+                }
+            }
+            destination += "\n\n"_sv;
+            return;
+        }
+
+        inline static auto exchange_list(
+            ordered_json const &source,
+            Type type) -> List
+        {
+            auto &value = source.at("objects").at(0).at("objdata").at("LocStringValues");
+            auto result = List{};
+            if (type == Type::map)
+            {
+                result.reserve(value.size() * 2_size);
+                for (auto &[key, element] : value.items())
+                {
+                    result.emplace_back(key);
+                    result.emplace_back(element.get<std::string>());
+                }
+            }
+            else
+            {
+                result = value.get<List>();
+            }
+            return result;
+        }
+
+    public:
+        inline static auto exchange_type(
+            std::string_view type) -> Type
+        {
+            if (type == "text"_sv)
+            {
+                return Type::text;
+            }
+            if (type == "cn-text"_sv)
+            {
+                return Type::cn_text;
+            }
+            if (type == "array"_sv)
+            {
+                return Type::array;
+            }
+            if (type == "map"_sv)
+            {
+                return Type::map;
+            }
+            throw Exception(String::format(fmt::format("{}", Language::get("popcap.pvz2.lawnstrings.convert.unsupported_type")), std::string{type}), std::source_location::current(), "exchange_type");
+        }
+
+        /**
+         * One pass over the lines, each value is built once
+         * text: utf-8 text
+         * return: key, value pairs in file order
+         */
+
+        inline static auto make_list(
+            std::string_view text) -> List
+        {
+            auto line = std::vector<std::string_view>{};
+            for (auto begin = k_begin_index; begin <= text.size();)
+            {
+                auto end = text.find('\n', begin);
+                if (end == std::string_view::npos)
+                {
+                    end = text.size();
+                }
+                line.emplace_back(text.substr(begin, end - begin));
+                begin = end + 1_size;
+            }
+            auto header = std::vector<size_t>{};
+            for (auto index : Range(line.size()))
+            {
+                if (is_header(line[index]))
+                {
+                    header.emplace_back(index);
+                }
+            }
+            auto result = List{};
+            result.reserve(header.size() * 2_size);
+            for (auto index : Range(header.size()))
+            {
+                auto begin = header[index] + 1_size;
+                auto end = begin;
+                if (index + 1_size < header.size())
+                {
+                    end = header[index + 1_size];
+                }
+                else
+                {
+                    // the last value runs up to the last blank line of the file
+                    for (auto last = line.size(); last > begin; --last)
+                    {
+                        if (line[last - 1_size].empty())
+                        {
+                            end = last - 1_size;
+                            break;
+                        }
+                    }
+                }
+                result.emplace_back(exchange_key(line[header[index]]));
+                result.emplace_back(exchange_value(line, begin, std::max(begin, end - 1_size)));
+            }
+            return result;
+        }
+
+        inline static auto to_text(
+            List const &source) -> std::string
+        {
+            auto size = k_none_size;
+            for (auto &e : source)
+            {
+                size += e.size() + 4_size;
+            }
+            auto result = std::string{};
+            result.reserve(size);
+            for (auto index = k_begin_index; index + 1_size < source.size(); index += 2_size)
+            {
+                exchange_text_line(result, source[index], source[index + 1_size]);
+            }
+            return result;
+        }
+
+        inline static auto to_json(
+            List const &source,
+            Type type,
+            JsonWriter &writer) -> void
+        {
+            writer.WriteStartObject();
+            writer.WritePropertyName("objects");
+            writer.WriteStartArray();
+            writer.WriteStartObject();
+            writer.WritePropertyName("aliases");
+            writer.WriteStartArray();
+            writer.WriteValue(std::string{k_object_class});
+            writer.WriteEndArray();
+            writer.WritePropertyName("objclass");
+            writer.WriteValue(std::string{k_object_class});
+            writer.WritePropertyName("objdata");
+            writer.WriteStartObject();
+            writer.WritePropertyName("LocStringValues");
+            if (type == Type::map)
+            {
+                // a repeated key keeps its first position and its last value
+                auto position = std::unordered_map<std::string_view, size_t>{};
+                auto order = std::vector<size_t>{};
+                for (auto index = k_begin_index; index + 1_size < source.size(); index += 2_size)
+                {
+                    if (auto [it, inserted] = position.try_emplace(source[index], order.size()); inserted)
+                    {
+                        order.emplace_back(index);
+                    }
+                    else
+                    {
+                        order[it->second] = index;
+                    }
+                }
+                writer.WriteStartObject();
+                for (auto index : order)
+                {
+                    writer.WritePropertyName(source[index]);
+                    writer.WriteValue(source[index + 1_size]);
+                }
+                writer.WriteEndObject();
+            }
+            else
+            {
+                writer.WriteStartArray();
+                for (auto &e : source)
+                {
+                    writer.WriteValue(e);
+                }
+                writer.WriteEndArray();
+            }
+            writer.WriteEndObject();
+            writer.WriteEndObject();
+            writer.WriteEndArray();
+            writer.WritePropertyName("version");
+            writer.WriteValue(k_version);
+            writer.WriteEndObject();
+            return;
+        }
+
+        inline static auto process_fs(
+            std::string_view source,
+            std::string_view destination,
+            Type source_type,
+            Type destination_type) -> void
+        {
+            assert_conditional(source_type != destination_type, fmt::format("{}", Language::get("popcap.pvz2.lawnstrings.convert.invalid_conversion_type")), "process_fs");
+            auto list = List{};
+            switch (source_type)
+            {
+            case Type::text:
+            {
+                list = make_list(String::utf16_to_utf8(FileSystem::read_file_by_utf16(source)));
+                break;
+            }
+            case Type::cn_text:
+            {
+                list = make_list(FileSystem::read_file(source));
+                break;
+            }
+            case Type::array:
+            case Type::map:
+            {
+                list = exchange_list(*FileSystem::read_json(source), source_type);
+                break;
+            }
+            }
+            switch (destination_type)
+            {
+            case Type::text:
+            {
+                FileSystem::write_file_by_utf16le(destination, String::utf8_to_utf16(to_text(list)));
+                break;
+            }
+            case Type::cn_text:
+            {
+                FileSystem::write_file(destination, to_text(list));
+                break;
+            }
+            case Type::array:
+            case Type::map:
+            {
+                auto writer = JsonWriter{};
+                writer.WriteIndent = true;
+                to_json(list, destination_type, writer);
+                FileSystem::write_file(destination, writer.ToString());
+                break;
+            }
+            }
+            return;
+        }
+    };
+}
@@ -28,17 +28,17 @@ namespace Sen::Kernel::Support::PopCap::NewTypeObjectNotation {
 
 			inline auto process(
 
-			) -> nlohmann::ordered_json
+			) -> ordered_json
 			{
-				auto result = nlohmann::ordered_json{
+				auto result = ordered_json{
 					{"version", 1},
 					{"content_version", 1},
 					{"slot_count", sen->readUint32()}
 				};
-				auto groups = nlohmann::ordered_json::array_t{};
+				auto groups = ordered_json::array_t{};
 				auto group_size = sen->readUint32();
 				for(auto i : Range(group_size)){
-					auto group = nlohmann::ordered_json{};
+					auto group = ordered_json{};
 					auto group_type = sen->readUint8();
 					switch (static_cast<int>(group_type)){
 						case 0x01:{
@@ -68,9 +68,9 @@ namespace Sen::Kernel::Support::PopCap::NewTypeObjectNotation {
 					}
 					if (group_type == 0x01) {
 						assert_conditional(resources_count == 0x00, fmt::format("{}, id: {}", Kernel::Language::get("popcap.newton.decode.resource_must_be_null_with_composite"), group["id"].get<std::string>()), "process");
-						auto subgroups = nlohmann::ordered_json::array_t{};
+						auto subgroups = ordered_json::array_t{};
 						for (auto subgroups_index : Range<int>(subgroups_count)) {
-							auto subgroup = nlohmann::ordered_json{};
+							auto subgroup = ordered_json{};
 							auto sub_res = sen->readUint32();
 							if (sub_res != 0x00) {
 								subgroup["res"] = fmt::format("{}", sub_res);
@@ -83,9 +83,9 @@ namespace Sen::Kernel::Support::PopCap::NewTypeObjectNotation {
 					}
 					if(group_type == 0x02){
 						assert_conditional(subgroups_count == 0x00, fmt::format("{}, id: {}", Kernel::Language::get("popcap.newton.decode.subgroup_must_be_null_with_simple"), group["id"].get<std::string>()), "process");
-						auto resources = nlohmann::ordered_json::array_t{};
+						auto resources = ordered_json::array_t{};
 						for (auto resources_index : Range<int>(resources_count)){
-          					auto sub_resources = nlohmann::ordered_json{};
+          					auto sub_resources = ordered_json{};
 							auto resource_type = sen->readUint8();
 							switch(static_cast<int>(resource_type)){
 								case 0x01:{
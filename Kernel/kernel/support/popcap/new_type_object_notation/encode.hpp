@@ -36,7 +36,7 @@ namespace Sen::Kernel::Support::PopCap::NewTypeObjectNotation {
 			 * Newton JSON
 			*/
 
-			nlohmann::ordered_json resource;
+			ordered_json resource;
 
 		public :
 
@@ -66,7 +66,7 @@ namespace Sen::Kernel::Support::PopCap::NewTypeObjectNotation {
 			}
 
 			explicit Encode(
-				const nlohmann::ordered_json & source
+				const ordered_json & source
 			) : resource(source), sen(std::make_unique<DataStreamView>())
 			{
 			}
@@ -24,6 +24,8 @@ namespace Sen::Kernel::Support::PopCap::Package
 
         inline static constexpr auto xor_point = static_cast<int32_t>(0xF7);
 
+        inline static constexpr auto xor_key = std::array<std::uint8_t, 1>{static_cast<std::uint8_t>(xor_point)};
+
         inline static constexpr auto k_time = 129146222018596744_ul;
 
         inline static auto constexpr zip_stream_deleter = [](auto zip)
@@ -31,7 +31,7 @@ namespace Sen::Kernel::Support::PopCap::Package
 
     
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Resource &nlohmann_json_t) -> void
     {
         nlohmann_json_j["path"] = nlohmann_json_t.path;
@@ -40,7 +40,7 @@ namespace Sen::Kernel::Support::PopCap::Package
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Resource &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("path").get_to(nlohmann_json_t.path);
@@ -57,7 +57,7 @@ namespace Sen::Kernel::Support::PopCap::Package
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PackageInfomartion &nlohmann_json_t) -> void
     {
         nlohmann_json_j["package_platform"] = nlohmann_json_t.package_platform;
@@ -93,7 +93,7 @@ namespace Sen::Kernel::Support::PopCap::Package
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PackageInfomartion &nlohmann_json_t) -> void
     {
         auto package_platform_string = nlohmann_json_j["package_platform"].get<std::string>();
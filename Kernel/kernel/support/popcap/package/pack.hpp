@@ -59,15 +59,8 @@ namespace Sen::Kernel::Support::PopCap::Package
                 stream.writeNull(padding_size);
                 stream.writeBytes(resource_data);
             }
-            stream.write_pos = Common::k_none_size;
             if (definition.package_platform == PackagePlatformEnumeration::Type::pc_package_platform_version) {
-                while (true)
-                {
-                    if (stream.write_pos >= stream.size()) {
-                        break;
-                    }
-                    stream.writeUint8(static_cast<uint8_t>(stream.readUint8() ^ Common::xor_point));
-                }
+                Sen::Kernel::Definition::Encryption::XOR::xor_inplace(stream.mutable_view(), Common::xor_key, 0_size);
             }
             return;
         }
@@ -89,6 +82,7 @@ namespace Sen::Kernel::Support::PopCap::Package
             std::string_view destination) -> void
         {
             auto stream = DataStreamView{};
+            stream.use_write_buffer();
             auto definition = *FileSystem::read_json(fmt::format("{}/data.json", source));
             process_whole(stream, definition, source, destination);
             stream.out_file(destination);
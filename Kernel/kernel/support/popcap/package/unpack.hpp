@@ -31,16 +31,8 @@ namespace Sen::Kernel::Support::PopCap::Package
             case k_magic_package_pc_version_identifier:
             {
                 definition.package_platform = PackagePlatformEnumeration::Type::pc_package_platform_version;
-                stream.write_pos = k_begin_index;
-                while (true)
-                {
-                    if (stream.read_pos >= stream.size())
-                    {
-                        stream.read_pos = k_none_size;
-                        break;
-                    }
-                    stream.writeUint8(static_cast<uint8_t>(stream.readUint8() ^ xor_point));
-                }
+                Sen::Kernel::Definition::Encryption::XOR::xor_inplace(stream.mutable_view(), xor_key, 0_size);
+                stream.write_pos = stream.size();
                 break;
             }
             case k_magic_package_tv_version_identifier:
@@ -4,6 +4,7 @@
 
 namespace Sen::Kernel::Support::PopCap::Particles
 {
+	using Sen::Kernel::Definition::OnDemand;
 
 	enum class ParticlesPlatform : uint8_t
 	{
@@ -29,7 +30,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
 	};
 
 	inline auto to_json(
-		nlohmann::ordered_json &nlohmann_json_j,
+		ordered_json &nlohmann_json_j,
 		const ParticlesTrackNode &nlohmann_json_t) -> void
 	{
 		nlohmann_json_j["time"] = nlohmann_json_t.time;
@@ -53,7 +54,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
 	}
 
 	inline auto from_json(
-		const nlohmann::ordered_json &nlohmann_json_j,
+		const ordered_json &nlohmann_json_j,
 		ParticlesTrackNode &nlohmann_json_t) -> void
 	{
 		nlohmann_json_j.at("time").get_to(nlohmann_json_t.time);
@@ -62,7 +63,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("low_value").get_to(nlohmann_json_t.low_value);
 			nlohmann_json_t.low_value_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -70,7 +71,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("high_value").get_to(nlohmann_json_t.high_value);
 			nlohmann_json_t.high_value_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -78,7 +79,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("curve_type").get_to(nlohmann_json_t.curve_type);
 			nlohmann_json_t.curve_type_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -86,12 +87,25 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("distribution").get_to(nlohmann_json_t.distribution);
 			nlohmann_json_t.distribution_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		return;
 	}
 
+	inline auto from_ondemand(
+		OnDemand::Value &value,
+		ParticlesTrackNode &nlohmann_json_t) -> void
+	{
+		auto object = OnDemand::as_object(value);
+		OnDemand::field(object, "time", nlohmann_json_t.time);
+		nlohmann_json_t.low_value_is_null = !OnDemand::optional_field(object, "low_value", nlohmann_json_t.low_value);
+		nlohmann_json_t.high_value_is_null = !OnDemand::optional_field(object, "high_value", nlohmann_json_t.high_value);
+		nlohmann_json_t.curve_type_is_null = !OnDemand::optional_field(object, "curve_type", nlohmann_json_t.curve_type);
+		nlohmann_json_t.distribution_is_null = !OnDemand::optional_field(object, "distribution", nlohmann_json_t.distribution);
+		return;
+	}
+
 	struct ParticlesField
 	{
 		int field_type;
@@ -111,7 +125,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
 	};
 
 	inline auto to_json(
-		nlohmann::ordered_json &nlohmann_json_j,
+		ordered_json &nlohmann_json_j,
 		const ParticlesField &nlohmann_json_t) -> void
 	{
 		if (!nlohmann_json_t.field_type_is_null)
@@ -130,7 +144,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
 	}
 
 	inline auto from_json(
-		const nlohmann::ordered_json &nlohmann_json_j,
+		const ordered_json &nlohmann_json_j,
 		ParticlesField &nlohmann_json_t) -> void
 	{
 		try
@@ -138,7 +152,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("field_type").get_to(nlohmann_json_t.field_type);
 			nlohmann_json_t.field_type_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -146,7 +160,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("x").get_to(nlohmann_json_t.x);
 			nlohmann_json_t.x_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -154,12 +168,23 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("y").get_to(nlohmann_json_t.y);
 			nlohmann_json_t.y_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		return;
 	}
 
+	inline auto from_ondemand(
+		OnDemand::Value &value,
+		ParticlesField &nlohmann_json_t) -> void
+	{
+		auto object = OnDemand::as_object(value);
+		nlohmann_json_t.field_type_is_null = !OnDemand::optional_field(object, "field_type", nlohmann_json_t.field_type);
+		nlohmann_json_t.x_is_null = !OnDemand::optional_field(object, "x", nlohmann_json_t.x);
+		nlohmann_json_t.y_is_null = !OnDemand::optional_field(object, "y", nlohmann_json_t.y);
+		return;
+	}
+
 	struct ParticlesEmitter
 	{
 		std::string name;
@@ -272,7 +297,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
 	};
 
 	inline auto to_json(
-		nlohmann::ordered_json &nlohmann_json_j,
+		ordered_json &nlohmann_json_j,
 		const ParticlesEmitter &nlohmann_json_t) -> void
 	{
 		if (!nlohmann_json_t.name_is_null)
@@ -476,7 +501,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
 	}
 
 	inline auto from_json(
-		const nlohmann::ordered_json &nlohmann_json_j,
+		const ordered_json &nlohmann_json_j,
 		ParticlesEmitter &nlohmann_json_t) -> void
 	{
 		try
@@ -484,7 +509,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("name").get_to(nlohmann_json_t.name);
 			nlohmann_json_t.name_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -492,7 +517,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("image").get_to(nlohmann_json_t.image);
 			nlohmann_json_t.image_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -500,7 +525,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("image_path").get_to(nlohmann_json_t.image_path);
 			nlohmann_json_t.image_path_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -508,7 +533,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("image_cols").get_to(nlohmann_json_t.image_cols);
 			nlohmann_json_t.image_cols_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -516,7 +541,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("image_rows").get_to(nlohmann_json_t.image_rows);
 			nlohmann_json_t.image_rows_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -524,7 +549,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("image_frames").get_to(nlohmann_json_t.image_frames);
 			nlohmann_json_t.image_frames_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -532,7 +557,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("animated").get_to(nlohmann_json_t.animated);
 			nlohmann_json_t.animated_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		nlohmann_json_j.at("particles_flag").get_to(nlohmann_json_t.particles_flag);
@@ -541,7 +566,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("emitter_type").get_to(nlohmann_json_t.emitter_type);
 			nlohmann_json_t.emitter_type_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -549,7 +574,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("on_duration").get_to(nlohmann_json_t.on_duration);
 			nlohmann_json_t.on_duration_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -557,7 +582,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("system_duration").get_to(nlohmann_json_t.system_duration);
 			nlohmann_json_t.system_duration_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -565,7 +590,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("cross_fade_duration").get_to(nlohmann_json_t.cross_fade_duration);
 			nlohmann_json_t.cross_fade_duration_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -573,7 +598,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("spawn_rate").get_to(nlohmann_json_t.spawn_rate);
 			nlohmann_json_t.spawn_rate_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -581,7 +606,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("spawn_min_active").get_to(nlohmann_json_t.spawn_min_active);
 			nlohmann_json_t.spawn_min_active_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -589,7 +614,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("spawn_max_active").get_to(nlohmann_json_t.spawn_max_active);
 			nlohmann_json_t.spawn_max_active_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -597,7 +622,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("spawn_max_launched").get_to(nlohmann_json_t.spawn_max_launched);
 			nlohmann_json_t.spawn_max_launched_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -605,7 +630,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("emitter_radius").get_to(nlohmann_json_t.emitter_radius);
 			nlohmann_json_t.emitter_radius_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -613,7 +638,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("emitter_offset_x").get_to(nlohmann_json_t.emitter_offset_x);
 			nlohmann_json_t.emitter_offset_x_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -621,7 +646,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("emitter_offset_y").get_to(nlohmann_json_t.emitter_offset_y);
 			nlohmann_json_t.emitter_offset_y_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -629,7 +654,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("emitter_box_x").get_to(nlohmann_json_t.emitter_box_x);
 			nlohmann_json_t.emitter_box_x_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -637,7 +662,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("emitter_box_y").get_to(nlohmann_json_t.emitter_box_y);
 			nlohmann_json_t.emitter_box_y_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -645,7 +670,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("emitter_path").get_to(nlohmann_json_t.emitter_path);
 			nlohmann_json_t.emitter_path_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -653,7 +678,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("emitter_skew_x").get_to(nlohmann_json_t.emitter_skew_x);
 			nlohmann_json_t.emitter_skew_x_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -661,7 +686,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("emitter_skew_y").get_to(nlohmann_json_t.emitter_skew_y);
 			nlohmann_json_t.emitter_skew_y_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -669,7 +694,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("particle_duration").get_to(nlohmann_json_t.particle_duration);
 			nlohmann_json_t.particle_duration_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -677,7 +702,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("system_red").get_to(nlohmann_json_t.system_red);
 			nlohmann_json_t.system_red_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -685,7 +710,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("system_green").get_to(nlohmann_json_t.system_green);
 			nlohmann_json_t.system_green_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -693,7 +718,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("system_blue").get_to(nlohmann_json_t.system_blue);
 			nlohmann_json_t.system_blue_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -701,7 +726,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("system_alpha").get_to(nlohmann_json_t.system_alpha);
 			nlohmann_json_t.system_alpha_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -709,7 +734,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("system_brightness").get_to(nlohmann_json_t.system_brightness);
 			nlohmann_json_t.system_brightness_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -717,7 +742,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("launch_speed").get_to(nlohmann_json_t.launch_speed);
 			nlohmann_json_t.launch_speed_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -725,7 +750,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("launch_angle").get_to(nlohmann_json_t.launch_angle);
 			nlohmann_json_t.launch_angle_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -733,7 +758,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("field").get_to(nlohmann_json_t.field);
 			nlohmann_json_t.field_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -741,7 +766,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("system_field").get_to(nlohmann_json_t.system_field);
 			nlohmann_json_t.system_field_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -749,7 +774,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("particle_red").get_to(nlohmann_json_t.particle_red);
 			nlohmann_json_t.particle_red_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -757,7 +782,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("particle_green").get_to(nlohmann_json_t.particle_green);
 			nlohmann_json_t.particle_green_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -765,7 +790,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("particle_blue").get_to(nlohmann_json_t.particle_blue);
 			nlohmann_json_t.particle_blue_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -773,7 +798,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("particle_alpha").get_to(nlohmann_json_t.particle_alpha);
 			nlohmann_json_t.particle_alpha_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -781,7 +806,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("particle_brightness").get_to(nlohmann_json_t.particle_brightness);
 			nlohmann_json_t.particle_brightness_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -789,7 +814,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("particle_spin_angle").get_to(nlohmann_json_t.particle_spin_angle);
 			nlohmann_json_t.particle_spin_angle_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -797,7 +822,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("particle_spin_speed").get_to(nlohmann_json_t.particle_spin_speed);
 			nlohmann_json_t.particle_spin_speed_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -805,7 +830,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("particle_scale").get_to(nlohmann_json_t.particle_scale);
 			nlohmann_json_t.particle_scale_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -813,7 +838,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("particle_stretch").get_to(nlohmann_json_t.particle_stretch);
 			nlohmann_json_t.particle_stretch_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -821,7 +846,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("collision_reflect").get_to(nlohmann_json_t.collision_reflect);
 			nlohmann_json_t.collision_reflect_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -829,7 +854,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("collision_spin").get_to(nlohmann_json_t.collision_spin);
 			nlohmann_json_t.collision_spin_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -837,7 +862,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("clip_top").get_to(nlohmann_json_t.clip_top);
 			nlohmann_json_t.clip_top_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -845,7 +870,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("clip_bottom").get_to(nlohmann_json_t.clip_bottom);
 			nlohmann_json_t.clip_bottom_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -853,7 +878,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("clip_left").get_to(nlohmann_json_t.clip_left);
 			nlohmann_json_t.clip_left_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -861,7 +886,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("clip_right").get_to(nlohmann_json_t.clip_right);
 			nlohmann_json_t.clip_right_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		try
@@ -869,12 +894,70 @@ namespace Sen::Kernel::Support::PopCap::Particles
             nlohmann_json_j.at("animation_rate").get_to(nlohmann_json_t.animation_rate);
 			nlohmann_json_t.animation_rate_is_null = false;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
 		return;
 	}
 
+	inline auto from_ondemand(
+		OnDemand::Value &value,
+		ParticlesEmitter &nlohmann_json_t) -> void
+	{
+		auto object = OnDemand::as_object(value);
+		nlohmann_json_t.name_is_null = !OnDemand::optional_field(object, "name", nlohmann_json_t.name);
+		nlohmann_json_t.image_is_null = !OnDemand::optional_field(object, "image", nlohmann_json_t.image);
+		nlohmann_json_t.image_path_is_null = !OnDemand::optional_field(object, "image_path", nlohmann_json_t.image_path);
+		nlohmann_json_t.image_cols_is_null = !OnDemand::optional_field(object, "image_cols", nlohmann_json_t.image_cols);
+		nlohmann_json_t.image_rows_is_null = !OnDemand::optional_field(object, "image_rows", nlohmann_json_t.image_rows);
+		nlohmann_json_t.image_frames_is_null = !OnDemand::optional_field(object, "image_frames", nlohmann_json_t.image_frames);
+		nlohmann_json_t.animated_is_null = !OnDemand::optional_field(object, "animated", nlohmann_json_t.animated);
+		OnDemand::field(object, "particles_flag", nlohmann_json_t.particles_flag);
+		nlohmann_json_t.emitter_type_is_null = !OnDemand::optional_field(object, "emitter_type", nlohmann_json_t.emitter_type);
+		nlohmann_json_t.on_duration_is_null = !OnDemand::optional_field(object, "on_duration", nlohmann_json_t.on_duration);
+		nlohmann_json_t.system_duration_is_null = !OnDemand::optional_field(object, "system_duration", nlohmann_json_t.system_duration);
+		nlohmann_json_t.cross_fade_duration_is_null = !OnDemand::optional_field(object, "cross_fade_duration", nlohmann_json_t.cross_fade_duration);
+		nlohmann_json_t.spawn_rate_is_null = !OnDemand::optional_field(object, "spawn_rate", nlohmann_json_t.spawn_rate);
+		nlohmann_json_t.spawn_min_active_is_null = !OnDemand::optional_field(object, "spawn_min_active", nlohmann_json_t.spawn_min_active);
+		nlohmann_json_t.spawn_max_active_is_null = !OnDemand::optional_field(object, "spawn_max_active", nlohmann_json_t.spawn_max_active);
+		nlohmann_json_t.spawn_max_launched_is_null = !OnDemand::optional_field(object, "spawn_max_launched", nlohmann_json_t.spawn_max_launched);
+		nlohmann_json_t.emitter_radius_is_null = !OnDemand::optional_field(object, "emitter_radius", nlohmann_json_t.emitter_radius);
+		nlohmann_json_t.emitter_offset_x_is_null = !OnDemand::optional_field(object, "emitter_offset_x", nlohmann_json_t.emitter_offset_x);
+		nlohmann_json_t.emitter_offset_y_is_null = !OnDemand::optional_field(object, "emitter_offset_y", nlohmann_json_t.emitter_offset_y);
+		nlohmann_json_t.emitter_box_x_is_null = !OnDemand::optional_field(object, "emitter_box_x", nlohmann_json_t.emitter_box_x);
+		nlohmann_json_t.emitter_box_y_is_null = !OnDemand::optional_field(object, "emitter_box_y", nlohmann_json_t.emitter_box_y);
+		nlohmann_json_t.emitter_path_is_null = !OnDemand::optional_field(object, "emitter_path", nlohmann_json_t.emitter_path);
+		nlohmann_json_t.emitter_skew_x_is_null = !OnDemand::optional_field(object, "emitter_skew_x", nlohmann_json_t.emitter_skew_x);
+		nlohmann_json_t.emitter_skew_y_is_null = !OnDemand::optional_field(object, "emitter_skew_y", nlohmann_json_t.emitter_skew_y);
+		nlohmann_json_t.particle_duration_is_null = !OnDemand::optional_field(object, "particle_duration", nlohmann_json_t.particle_duration);
+		nlohmann_json_t.system_red_is_null = !OnDemand::optional_field(object, "system_red", nlohmann_json_t.system_red);
+		nlohmann_json_t.system_green_is_null = !OnDemand::optional_field(object, "system_green", nlohmann_json_t.system_green);
+		nlohmann_json_t.system_blue_is_null = !OnDemand::optional_field(object, "system_blue", nlohmann_json_t.system_blue);
+		nlohmann_json_t.system_alpha_is_null = !OnDemand::optional_field(object, "system_alpha", nlohmann_json_t.system_alpha);
+		nlohmann_json_t.system_brightness_is_null = !OnDemand::optional_field(object, "system_brightness", nlohmann_json_t.system_brightness);
+		nlohmann_json_t.launch_speed_is_null = !OnDemand::optional_field(object, "launch_speed", nlohmann_json_t.launch_speed);
+		nlohmann_json_t.launch_angle_is_null = !OnDemand::optional_field(object, "launch_angle", nlohmann_json_t.launch_angle);
+		nlohmann_json_t.field_is_null = !OnDemand::optional_field(object, "field", nlohmann_json_t.field);
+		nlohmann_json_t.system_field_is_null = !OnDemand::optional_field(object, "system_field", nlohmann_json_t.system_field);
+		nlohmann_json_t.particle_red_is_null = !OnDemand::optional_field(object, "particle_red", nlohmann_json_t.particle_red);
+		nlohmann_json_t.particle_green_is_null = !OnDemand::optional_field(object, "particle_green", nlohmann_json_t.particle_green);
+		nlohmann_json_t.particle_blue_is_null = !OnDemand::optional_field(object, "particle_blue", nlohmann_json_t.particle_blue);
+		nlohmann_json_t.particle_alpha_is_null = !OnDemand::optional_field(object, "particle_alpha", nlohmann_json_t.particle_alpha);
+		nlohmann_json_t.particle_brightness_is_null = !OnDemand::optional_field(object, "particle_brightness", nlohmann_json_t.particle_brightness);
+		nlohmann_json_t.particle_spin_angle_is_null = !OnDemand::optional_field(object, "particle_spin_angle", nlohmann_json_t.particle_spin_angle);
+		nlohmann_json_t.particle_spin_speed_is_null = !OnDemand::optional_field(object, "particle_spin_speed", nlohmann_json_t.particle_spin_speed);
+		nlohmann_json_t.particle_scale_is_null = !OnDemand::optional_field(object, "particle_scale", nlohmann_json_t.particle_scale);
+		nlohmann_json_t.particle_stretch_is_null = !OnDemand::optional_field(object, "particle_stretch", nlohmann_json_t.particle_stretch);
+		nlohmann_json_t.collision_reflect_is_null = !OnDemand::optional_field(object, "collision_reflect", nlohmann_json_t.collision_reflect);
+		nlohmann_json_t.collision_spin_is_null = !OnDemand::optional_field(object, "collision_spin", nlohmann_json_t.collision_spin);
+		nlohmann_json_t.clip_top_is_null = !OnDemand::optional_field(object, "clip_top", nlohmann_json_t.clip_top);
+		nlohmann_json_t.clip_bottom_is_null = !OnDemand::optional_field(object, "clip_bottom", nlohmann_json_t.clip_bottom);
+		nlohmann_json_t.clip_left_is_null = !OnDemand::optional_field(object, "clip_left", nlohmann_json_t.clip_left);
+		nlohmann_json_t.clip_right_is_null = !OnDemand::optional_field(object, "clip_right", nlohmann_json_t.clip_right);
+		nlohmann_json_t.animation_rate_is_null = !OnDemand::optional_field(object, "animation_rate", nlohmann_json_t.animation_rate);
+		return;
+	}
+
 	struct Particles
 	{
 		std::vector<ParticlesEmitter> emitters;
@@ -882,7 +965,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
 	};
 
 	inline auto to_json(
-		nlohmann::ordered_json &nlohmann_json_j,
+		ordered_json &nlohmann_json_j,
 		const Particles &nlohmann_json_t) -> void
 	{
 		if (nlohmann_json_t.emitters_is_null)
@@ -897,7 +980,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
 	}
 
 	inline auto from_json(
-		const nlohmann::ordered_json &nlohmann_json_j,
+		const ordered_json &nlohmann_json_j,
 		Particles &nlohmann_json_t) -> void
 	{
 		if (nlohmann_json_j.at("emitters").is_null())
@@ -910,4 +993,13 @@ namespace Sen::Kernel::Support::PopCap::Particles
 		}
 		return;
 	}
+
+	inline auto from_ondemand(
+		OnDemand::Value &value,
+		Particles &nlohmann_json_t) -> void
+	{
+		auto object = OnDemand::as_object(value);
+		nlohmann_json_t.emitters_is_null = !OnDemand::nullable_field(object, "emitters", nlohmann_json_t.emitters);
+		return;
+	}
 }
\ No newline at end of file
@@ -611,7 +611,7 @@ namespace Sen::Kernel::Support::PopCap::Particles
 			ParticlesPlatform platform) -> void
 		{
 			auto encode = Encode{};
-			auto definition = *FileSystem::read_json(source);
+			auto definition = OnDemand::read_fs<Particles>(source);
 			encode.process(definition, platform);
 			encode.stream.out_file(destination);
 			return;
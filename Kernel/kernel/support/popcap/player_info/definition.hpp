@@ -361,7 +361,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MiniGameRecord &nlohmann_json_t) -> void
     {
         nlohmann_json_j["zombotany"] = nlohmann_json_t.zombotany;
@@ -415,7 +415,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MiniGameRecord &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("zombotany").get_to(nlohmann_json_t.zombotany);
@@ -472,7 +472,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const LastStandRecord &nlohmann_json_t) -> void
     {
         nlohmann_json_j["day_flag"] = nlohmann_json_t.day_flag;
@@ -485,7 +485,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         LastStandRecord &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("day_flag").get_to(nlohmann_json_t.day_flag);
@@ -523,7 +523,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const LimboRecord &nlohmann_json_t) -> void
     {
         nlohmann_json_j["art_challenge_wallnut"] = nlohmann_json_t.art_challenge_wallnut;
@@ -554,7 +554,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         LimboRecord &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("art_challenge_wallnut").get_to(nlohmann_json_t.art_challenge_wallnut);
@@ -607,7 +607,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PuzzleRecord &nlohmann_json_t) -> void
     {
         nlohmann_json_j["vasebreaker_1"] = nlohmann_json_t.vasebreaker_1;
@@ -634,7 +634,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PuzzleRecord &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("vasebreaker_1").get_to(nlohmann_json_t.vasebreaker_1);
@@ -676,7 +676,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SurvivalRecord &nlohmann_json_t) -> void
     {
         nlohmann_json_j["day_normal_flag"] = nlohmann_json_t.day_normal_flag;
@@ -694,7 +694,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SurvivalRecord &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("day_normal_flag").get_to(nlohmann_json_t.day_normal_flag);
@@ -721,7 +721,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ChallengeRecord &nlohmann_json_t) -> void
     {
         nlohmann_json_j["minigame"] = nlohmann_json_t.minigame;
@@ -739,7 +739,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ChallengeRecord &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("minigame").get_to(nlohmann_json_t.minigame);
@@ -768,7 +768,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Unlocked &nlohmann_json_t) -> void
     {
         nlohmann_json_j["minigame"] = nlohmann_json_t.minigame;
@@ -781,7 +781,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Unlocked &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("minigame").get_to(nlohmann_json_t.minigame);
@@ -806,7 +806,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const General &nlohmann_json_t) -> void
     {
         nlohmann_json_j["adventure_level"] = nlohmann_json_t.adventure_level;
@@ -822,7 +822,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         General &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("adventure_level").get_to(nlohmann_json_t.adventure_level);
@@ -845,7 +845,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const StinkyInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["sleeping"] = nlohmann_json_t.sleeping;
@@ -856,7 +856,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         StinkyInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("sleeping").get_to(nlohmann_json_t.sleeping);
@@ -872,7 +872,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Position &nlohmann_json_t) -> void
     {
         nlohmann_json_j["x"] = nlohmann_json_t.x;
@@ -881,7 +881,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Position &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("x").get_to(nlohmann_json_t.x);
@@ -897,7 +897,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const StinkyTheSnail &nlohmann_json_t) -> void
     {
         nlohmann_json_j["purchased"] = nlohmann_json_t.purchased;
@@ -907,7 +907,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         StinkyTheSnail &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("purchased").get_to(nlohmann_json_t.purchased);
@@ -925,7 +925,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PottedPlantTime &nlohmann_json_t) -> void
     {
         nlohmann_json_j["last_watered_time"] = nlohmann_json_t.last_watered_time;
@@ -936,7 +936,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PottedPlantTime &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("last_watered_time").get_to(nlohmann_json_t.last_watered_time);
@@ -960,7 +960,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PottedPlantInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["orientation"] = magic_enum::enum_name(nlohmann_json_t.orientation);
@@ -976,7 +976,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PottedPlantInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_t.orientation = magic_enum_cast<FacingDirection>(nlohmann_json_j.at("orientation").get<std::string>());
@@ -998,7 +998,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PottedPlant &nlohmann_json_t) -> void
     {
         nlohmann_json_j["seed_type"] = magic_enum::enum_name(nlohmann_json_t.seed_type);
@@ -1009,7 +1009,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PottedPlant &nlohmann_json_t) -> void
     {
         nlohmann_json_t.seed_type = magic_enum_cast<SeedType>(nlohmann_json_j.at("seed_type").get<std::string>());
@@ -1043,7 +1043,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ZenGardenPurchased &nlohmann_json_t) -> void
     {
         if (k_version >= 30)
@@ -1072,7 +1072,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ZenGardenPurchased &nlohmann_json_t) -> void
     {
         if (k_version >= 30)
@@ -1105,7 +1105,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const TreeOfWisdom &nlohmann_json_t) -> void
     {
         nlohmann_json_j["purchased"] = nlohmann_json_t.purchased;
@@ -1115,7 +1115,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         TreeOfWisdom &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("purchased").get_to(nlohmann_json_t.purchased);
@@ -1133,7 +1133,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ZenGarden &nlohmann_json_t) -> void
     {
         nlohmann_json_j["stinky"] = nlohmann_json_t.stinky;
@@ -1151,7 +1151,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ZenGarden &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("stinky").get_to(nlohmann_json_t.stinky);
@@ -1193,7 +1193,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const StorePurchased &nlohmann_json_t) -> void
     {
         nlohmann_json_j["pool_cleaner"] = nlohmann_json_t.pool_cleaner;
@@ -1229,7 +1229,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         StorePurchased &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("pool_cleaner").get_to(nlohmann_json_t.pool_cleaner);
@@ -1273,7 +1273,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Store &nlohmann_json_t) -> void
     {
         nlohmann_json_j["extra_packet_slots"] = nlohmann_json_t.extra_packet_slots;
@@ -1287,7 +1287,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Store &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("extra_packet_slots").get_to(nlohmann_json_t.extra_packet_slots);
@@ -1307,7 +1307,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AchievementInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["earned"] = nlohmann_json_t.earned;
@@ -1316,7 +1316,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AchievementInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("earned").get_to(nlohmann_json_t.earned);
@@ -1381,7 +1381,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Achievement &nlohmann_json_t) -> void
     {
         if (k_version >= 12)
@@ -1495,7 +1495,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Achievement &nlohmann_json_t) -> void
     {
         if (k_version >= 12)
@@ -1544,7 +1544,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
                     nlohmann_json_j.at("last_mown_stading").get_to(nlohmann_json_t.last_mown_stading);
                     ++nlohmann_json_t.num_of_achievement;
                 }
-                catch (nlohmann::ordered_json::exception &e)
+                catch (ordered_json::exception &e)
                 {
                 }
                 try
@@ -1552,7 +1552,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
                     nlohmann_json_j.at("below_zero").get_to(nlohmann_json_t.below_zero);
                     ++nlohmann_json_t.num_of_achievement;
                 }
-                catch (nlohmann::ordered_json::exception &e)
+                catch (ordered_json::exception &e)
                 {
                 }
                 try
@@ -1560,7 +1560,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
                     nlohmann_json_j.at("flower_power").get_to(nlohmann_json_t.flower_power);
                     ++nlohmann_json_t.num_of_achievement;
                 }
-                catch (nlohmann::ordered_json::exception &e)
+                catch (ordered_json::exception &e)
                 {
                 }
                 try
@@ -1568,7 +1568,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
                     nlohmann_json_j.at("pyromaniac").get_to(nlohmann_json_t.pyromaniac);
                     ++nlohmann_json_t.num_of_achievement;
                 }
-                catch (nlohmann::ordered_json::exception &e)
+                catch (ordered_json::exception &e)
                 {
                 }
                 try
@@ -1576,7 +1576,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
                     nlohmann_json_j.at("lawn_mowner_man").get_to(nlohmann_json_t.lawn_mowner_man);
                     ++nlohmann_json_t.num_of_achievement;
                 }
-                catch (nlohmann::ordered_json::exception &e)
+                catch (ordered_json::exception &e)
                 {
                 }
                 try
@@ -1584,7 +1584,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
                     nlohmann_json_j.at("chill_out").get_to(nlohmann_json_t.chill_out);
                     ++nlohmann_json_t.num_of_achievement;
                 }
-                catch (nlohmann::ordered_json::exception &e)
+                catch (ordered_json::exception &e)
                 {
                 }
                 try
@@ -1592,7 +1592,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
                     nlohmann_json_j.at("defcorn_five").get_to(nlohmann_json_t.defcorn_five);
                     ++nlohmann_json_t.num_of_achievement;
                 }
-                catch (nlohmann::ordered_json::exception &e)
+                catch (ordered_json::exception &e)
                 {
                 }
                 try
@@ -1600,7 +1600,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
                     nlohmann_json_j.at("monster_mash").get_to(nlohmann_json_t.monster_mash);
                     ++nlohmann_json_t.num_of_achievement;
                 }
-                catch (nlohmann::ordered_json::exception &e)
+                catch (ordered_json::exception &e)
                 {
                 }
                 try
@@ -1608,7 +1608,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
                     nlohmann_json_j.at("blind_faith").get_to(nlohmann_json_t.blind_faith);
                     ++nlohmann_json_t.num_of_achievement;
                 }
-                catch (nlohmann::ordered_json::exception &e)
+                catch (ordered_json::exception &e)
                 {
                 }
                 try
@@ -1616,7 +1616,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
                     nlohmann_json_j.at("pool_closed").get_to(nlohmann_json_t.pool_closed);
                     ++nlohmann_json_t.num_of_achievement;
                 }
-                catch (nlohmann::ordered_json::exception &e)
+                catch (ordered_json::exception &e)
                 {
                 }
                 try
@@ -1624,7 +1624,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
                     nlohmann_json_j.at("melony_lane").get_to(nlohmann_json_t.melony_lane);
                     ++nlohmann_json_t.num_of_achievement;
                 }
-                catch (nlohmann::ordered_json::exception &e)
+                catch (ordered_json::exception &e)
                 {
                 }
                 try
@@ -1632,7 +1632,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
                     nlohmann_json_j.at("second_life").get_to(nlohmann_json_t.second_life);
                     ++nlohmann_json_t.num_of_achievement;
                 }
-                catch (nlohmann::ordered_json::exception &e)
+                catch (ordered_json::exception &e)
                 {
                 }
                 if (nlohmann_json_t.num_of_achievement > 13)
@@ -1700,7 +1700,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ZombatarArgument &nlohmann_json_t) -> void
     {
         nlohmann_json_j["type"] = nlohmann_json_t.type;
@@ -1709,7 +1709,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ZombatarArgument &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("type").get_to(nlohmann_json_t.type);
@@ -1731,7 +1731,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ZombatarValue &nlohmann_json_t) -> void
     {
         nlohmann_json_j["skin_color"] = nlohmann_json_t.skin_color;
@@ -1745,7 +1745,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ZombatarValue &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("skin_color").get_to(nlohmann_json_t.skin_color);
@@ -1766,7 +1766,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Zombatar &nlohmann_json_t) -> void
     {
         nlohmann_json_j["accepted_zombatar_license"] = nlohmann_json_t.accepted_zombatar_license;
@@ -1776,7 +1776,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Zombatar &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("accepted_zombatar_license").get_to(nlohmann_json_t.accepted_zombatar_license);
@@ -1804,7 +1804,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const DetailInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["version"] = nlohmann_json_t.version;
@@ -1862,7 +1862,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         DetailInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("version").get_to(nlohmann_json_t.version);
@@ -1908,7 +1908,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const UserDetail &nlohmann_json_t) -> void
     {
         nlohmann_json_j["name"] = nlohmann_json_t.name;
@@ -1918,7 +1918,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         UserDetail &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("name").get_to(nlohmann_json_t.name);
@@ -1934,7 +1934,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SummaryInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["version"] = nlohmann_json_t.version;
@@ -1943,7 +1943,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SummaryInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("version").get_to(nlohmann_json_t.version);
@@ -1956,7 +1956,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const VersionInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["version"] = nlohmann_json_t.version;
@@ -1965,7 +1965,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         VersionInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("version").get_to(nlohmann_json_t.version);
@@ -22,10 +22,85 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             stream.read_pos = 0_size;
             if (magic == zlib_magic || magic == zlib_magic_big)
             {
-                auto uncompress = Sen::Kernel::Support::PopCap::Zlib::Uncompress<UseVariant>{};
-                auto data = stream.toBytes();
-                stream.close();
-                stream.writeBytes(uncompress.uncompress(data));
+                assert_conditional(magic == zlib_magic, fmt::format("{}: 0x{:X}", Language::get("popcap.zlib.uncompress.mismatch_zlib_magic"), Zlib::Common::magic), "decode_zlib");
+                // the header carries the uncompressed size, inflate from the stream into a buffer of that size
+                auto header_size = UseVariant ? 16_size : 8_size;
+                assert_conditional(stream.size() >= header_size, fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "decode_zlib");
+                stream.read_pos = UseVariant ? 8_size : 4_size;
+                auto size = static_cast<std::size_t>(stream.readUint32());
+                auto source = stream.data_view().subspan(header_size);
+                auto data = std::vector<std::uint8_t, DefaultInitializeAllocator<std::uint8_t>>(size);
+                auto is_finished = false;
+                // deflate expands at most 1032 times, a larger size cannot be right
+                if (size != 0_size && size <= source.size() * 1032_size)
+                {
+                    auto inflate = Compression::Zlib::Inflate{std::span<unsigned char>{data.data(), data.size()}};
+                    inflate.update(source);
+                    is_finished = inflate.is_finished();
+                    data.resize(inflate.size());
+                }
+                if (!is_finished)
+                {
+                    // the size was wrong, inflate again without trusting it
+                    auto result = Compression::Zlib::uncompress(std::vector<unsigned char>{source.begin(), source.end()});
+                    data.assign(result.begin(), result.end());
+                }
+                stream.adopt(std::move(data));
+            }
+            return;
+        }
+
+        // each record is 8 floats and padding, a missing value is stored as transform_tfloat_end which is also the default
+
+        template <auto use_big_endian>
+        inline static auto read_transform_list(
+            SenBuffer<use_big_endian> const &stream,
+            std::vector<ReanimTransform> &transform_list,
+            std::size_t padding) -> void
+        {
+            auto value = std::array<float, 8>{};
+            auto record_size = sizeof(value) + padding;
+            auto source = stream.read_view(record_size * transform_list.size());
+            auto position = source.data();
+            for (auto &transform : transform_list)
+            {
+                std::memcpy(value.data(), position, sizeof(value));
+                position += record_size;
+                if constexpr (use_big_endian)
+                {
+                    for (auto &e : value)
+                    {
+                        e = SenBuffer<use_big_endian>::reverse_endian(e);
+                    }
+                }
+                transform.x = value[0];
+                transform.y = value[1];
+                transform.kx = value[2];
+                transform.ky = value[3];
+                transform.sx = value[4];
+                transform.sy = value[5];
+                transform.f = value[6];
+                transform.a = value[7];
+            }
+            return;
+        }
+
+        // phone reanims keep an image index, frames repeat a few of them so each is formatted once
+
+        inline static auto read_image_index(
+            DataStreamView const &stream,
+            std::unordered_map<std::int32_t, std::string> &image_index,
+            std::string &destination) -> void
+        {
+            auto index = stream.readInt32();
+            if (index != -1)
+            {
+                auto &image = image_index[index];
+                if (image.empty())
+                {
+                    image = fmt::format("{}", index);
+                }
+                destination = image;
             }
             return;
         }
@@ -44,76 +119,19 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             for (auto i : Range<int>(track_size))
             {
                 stream.read_pos += 8;
-                auto track = ReanimTrack{};
-                track.transforms.resize(stream.readUint32());
-                reanim.tracks.emplace_back(track);
+                reanim.tracks.emplace_back().transforms.resize(stream.readUint32());
             }
             for (auto &track : reanim.tracks)
             {
-                track.name = stream.readStringByUint32();
+                track.name = stream.readStringViewByUint32();
                 auto c_track = stream.readUint32();
                 assert_conditional(c_track == 0x2C, String::format(fmt::format("{}", Language::get("popcap.reanim.decode.invalid_pc_reanim_track")), String::decimal_to_hexadecimal(c_track)), "decode_pc");
+                read_transform_list(stream, track.transforms, 12_size);
                 for (auto &transform : track.transforms)
                 {
-                    auto tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.x = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.y = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.kx = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.ky = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.sx = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.sy = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.f = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.a = tfloat;
-                    }
-                    stream.read_pos += 12;
-                }
-                for (auto &transform : track.transforms)
-                {
-                    auto tstring = stream.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.i = tstring;
-                    }
-                    tstring = stream.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.font = tstring;
-                    }
-                    tstring = stream.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.text = tstring;
-                    }
+                    transform.i = stream.readStringViewByUint32();
+                    transform.font = stream.readStringViewByUint32();
+                    transform.text = stream.readStringViewByUint32();
                 }
             }
             return;
@@ -133,92 +151,23 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             for (auto i : Range<int>(track_size))
             {
                 stream.read_pos += 12;
-                auto track = ReanimTrack{};
-                track.transforms.resize(stream.readUint32());
-                reanim.tracks.emplace_back(track);
+                reanim.tracks.emplace_back().transforms.resize(stream.readUint32());
                 stream.read_pos += 4;
             }
             for (auto &track : reanim.tracks)
             {
-                track.name = stream.readStringByUint32();
+                track.name = stream.readStringViewByUint32();
                 auto c_track = stream.readUint32();
                 assert_conditional(c_track == 0x30, String::format(fmt::format("{}", Language::get("popcap.reanim.decode.invalid_tv_reanim_track")), String::decimal_to_hexadecimal(c_track)), "decode_tv");
+                read_transform_list(stream, track.transforms, 16_size);
                 for (auto &transform : track.transforms)
                 {
-                    auto tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.x = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.y = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.kx = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.ky = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.sx = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.sy = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.f = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.a = tfloat;
-                    }
-                    stream.read_pos += 16;
-                }
-                for (auto &transform : track.transforms)
-                {
-                    auto tstring = stream.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.i = tstring;
-                    }
-                    tstring = stream.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.resource = tstring;
-                    }
-                    tstring = stream.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.i2 = tstring;
-                    }
-                    tstring = stream.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.resource2 = tstring;
-                    }
-                    tstring = stream.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.font = tstring;
-                    }
-                    tstring = stream.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.text = tstring;
-                    }
+                    transform.i = stream.readStringViewByUint32();
+                    transform.resource = stream.readStringViewByUint32();
+                    transform.i2 = stream.readStringViewByUint32();
+                    transform.resource2 = stream.readStringViewByUint32();
+                    transform.font = stream.readStringViewByUint32();
+                    transform.text = stream.readStringViewByUint32();
                 }
             }
             return;
@@ -325,76 +274,20 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             for (auto i : Range<int>(track_size))
             {
                 stream.read_pos += 12;
-                auto track = ReanimTrack{};
-                track.transforms.resize(stream.readUint32());
-                reanim.tracks.emplace_back(track);
+                reanim.tracks.emplace_back().transforms.resize(stream.readUint32());
             }
+            auto image_index = std::unordered_map<std::int32_t, std::string>{};
             for (auto &track : reanim.tracks)
             {
-                track.name = stream.readStringByUint32();
+                track.name = stream.readStringViewByUint32();
                 auto c_track = stream.readUint32();
                 assert_conditional(c_track == 0x2C, String::format(fmt::format("{}", Language::get("popcap.reanim.decode.invalid_phone_32_reanim_track")), String::decimal_to_hexadecimal(c_track)), "decode_phone_32");
+                read_transform_list(stream, track.transforms, 12_size);
                 for (auto &transform : track.transforms)
                 {
-                    auto tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.x = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.y = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.kx = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.ky = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.sx = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.sy = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.f = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.a = tfloat;
-                    }
-                    stream.read_pos += 12;
-                }
-                for (auto &transform : track.transforms)
-                {
-                    auto tint = stream.readInt32();
-                    if (tint != -1)
-                    {
-                        transform.i = fmt::format("{}", tint); // string instead of int
-                    }
-                    auto tstring = stream.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.font = tstring;
-                    }
-                    tstring = stream.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.text = tstring;
-                    }
+                    read_image_index(stream, image_index, transform.i); // string instead of int
+                    transform.font = stream.readStringViewByUint32();
+                    transform.text = stream.readStringViewByUint32();
                 }
             }
             return;
@@ -414,77 +307,21 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             for (auto i : Range<int>(track_size))
             {
                 stream.read_pos += 24;
-                auto track = ReanimTrack{};
-                track.transforms.resize(stream.readUint32());
-                reanim.tracks.emplace_back(track);
+                reanim.tracks.emplace_back().transforms.resize(stream.readUint32());
                 stream.read_pos += 4;
             }
+            auto image_index = std::unordered_map<std::int32_t, std::string>{};
             for (auto &track : reanim.tracks)
             {
-                track.name = stream.readStringByUint32();
+                track.name = stream.readStringViewByUint32();
                 auto c_track = stream.readUint32();
                 assert_conditional(c_track == 0x38, String::format(fmt::format("{}", Language::get("popcap.reanim.decode.invalid_phone_64_reanim_track")), String::decimal_to_hexadecimal(c_track)), "decode_phone_64");
+                read_transform_list(stream, track.transforms, 24_size);
                 for (auto &transform : track.transforms)
                 {
-                    auto tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.x = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.y = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.kx = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.ky = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.sx = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.sy = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.f = tfloat;
-                    }
-                    tfloat = stream.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.a = tfloat;
-                    }
-                    stream.read_pos += 24;
-                }
-                for (auto &transform : track.transforms)
-                {
-                    auto tint = stream.readInt32();
-                    if (tint != -1)
-                    {
-                        transform.i = fmt::format("{}", tint); // string instead of int
-                    }
-                    auto tstring = stream.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.font = tstring;
-                    }
-                    tstring = stream.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.text = tstring;
-                    }
+                    read_image_index(stream, image_index, transform.i); // string instead of int
+                    transform.font = stream.readStringViewByUint32();
+                    transform.text = stream.readStringViewByUint32();
                 }
             }
             return;
@@ -496,7 +333,7 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
         {
             decode_zlib<false>();
             auto stream_big = DataStreamViewBigEndian{};
-            stream_big.writeBytes(stream.toBytes());
+            stream_big.adopt(stream.release());
             stream_big.read_pos = 8;
             auto track_size = stream_big.readUint32();
             reanim.fps = stream_big.readFloat();
@@ -506,78 +343,22 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             for (auto i : Range<int>(track_size))
             {
                 stream_big.read_pos += 8;
-                auto track = ReanimTrack{};
-                track.transforms.resize(stream_big.readUint32());
-                reanim.tracks.emplace_back(track);
+                reanim.tracks.emplace_back().transforms.resize(stream_big.readUint32());
             }
             for (auto &track : reanim.tracks)
             {
-                track.name = stream_big.readStringByUint32();
+                track.name = stream_big.readStringViewByUint32();
                 auto c_track = stream_big.readUint32();
                 assert_conditional(c_track == 0x2C, String::format(fmt::format("{}", Language::get("popcap.reanim.decode.invalid_game_console_reanim_track")), String::decimal_to_hexadecimal(c_track)), "decode_game_console");
+                read_transform_list(stream_big, track.transforms, 12_size);
                 for (auto &transform : track.transforms)
                 {
-                    auto tfloat = stream_big.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.x = tfloat;
-                    }
-                    tfloat = stream_big.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.y = tfloat;
-                    }
-                    tfloat = stream_big.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.kx = tfloat;
-                    }
-                    tfloat = stream_big.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.ky = tfloat;
-                    }
-                    tfloat = stream_big.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.sx = tfloat;
-                    }
-                    tfloat = stream_big.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.sy = tfloat;
-                    }
-                    tfloat = stream_big.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.f = tfloat;
-                    }
-                    tfloat = stream_big.readFloat();
-                    if (tfloat != transform_tfloat_end)
-                    {
-                        transform.a = tfloat;
-                    }
-                    stream_big.read_pos += 12;
-                }
-                for (auto &transform : track.transforms)
-                {
-                    auto tstring = stream_big.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.i = tstring;
-                    }
-                    tstring = stream_big.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.font = tstring;
-                    }
-                    tstring = stream_big.readStringByUint32();
-                    if (tstring.empty())
-                    {
-                        transform.text = tstring;
-                    }
+                    transform.i = stream_big.readStringViewByUint32();
+                    transform.font = stream_big.readStringViewByUint32();
+                    transform.text = stream_big.readStringViewByUint32();
                 }
             }
+            stream.adopt(stream_big.release());
             return;
         }
 
@@ -647,6 +428,25 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             FileSystem::write_json(destination, reanim_info);
             return;
         }
+
+        /**
+         * Decode every file on a bounded pool, source[i] is written to destination[i]
+         * thread_count: worker count, clamped to the hardware concurrency
+         */
+
+        inline static auto process_fs(
+            const std::vector<std::string> &source,
+            const std::vector<std::string> &destination,
+            ReanimPlatform platform,
+            std::size_t thread_count
+        ) -> void
+        {
+            assert_conditional(source.size() == destination.size(), String::format(fmt::format("{}", Language::get("popcap.reanim.decode.source_destination_count_mismatch")), std::to_string(source.size()), std::to_string(destination.size())), "process_fs");
+            ThreadPool::parallel_for(source.size(), [&source, &destination, platform](std::size_t index) {
+                process_fs(source[index], destination[index], platform);
+            }, thread_count);
+            return;
+        }
     };
 
 }
\ No newline at end of file
@@ -56,7 +56,7 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ReanimTransform &nlohmann_json_t) -> void
     {
         if (nlohmann_json_t.x != transform_tfloat_end) {
@@ -105,14 +105,14 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ReanimTransform &nlohmann_json_t) -> void
     {
         try
         {
             nlohmann_json_j.at("x").get_to(nlohmann_json_t.x);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         
@@ -120,91 +120,91 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
         {
             nlohmann_json_j.at("y").get_to(nlohmann_json_t.y);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("kx").get_to(nlohmann_json_t.kx);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("ky").get_to(nlohmann_json_t.ky);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("sx").get_to(nlohmann_json_t.sx);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("sy").get_to(nlohmann_json_t.sy);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("f").get_to(nlohmann_json_t.f);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("a").get_to(nlohmann_json_t.a);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("i").get_to(nlohmann_json_t.i);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("resource").get_to(nlohmann_json_t.resource);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("i2").get_to(nlohmann_json_t.i2);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("resource2").get_to(nlohmann_json_t.resource2);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("font").get_to(nlohmann_json_t.font);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("text").get_to(nlohmann_json_t.text);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         return;
@@ -217,7 +217,7 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ReanimTrack &nlohmann_json_t) -> void
     {
         nlohmann_json_j["name"] = nlohmann_json_t.name;
@@ -226,7 +226,7 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ReanimTrack &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("name").get_to(nlohmann_json_t.name);
@@ -242,7 +242,7 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ReanimInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["do_scale"] = nlohmann_json_t.do_scale;
@@ -252,7 +252,7 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ReanimInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("do_scale").get_to(nlohmann_json_t.do_scale);
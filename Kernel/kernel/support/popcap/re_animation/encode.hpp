@@ -23,6 +23,30 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             return compress.compress(data);
 		}
 
+        // each record is 8 floats and padding, the whole block of a track is reserved at once
+
+        template <auto use_big_endian>
+        inline static auto write_transform_list(
+            SenBuffer<use_big_endian> const &stream,
+            const std::vector<ReanimTransform> &transform_list,
+            std::size_t padding) -> void
+        {
+            auto cursor = stream.write_cursor((sizeof(float) * 8_size + padding) * transform_list.size());
+            for (const auto &transform : transform_list)
+            {
+                cursor.writeFloat(transform.x);
+                cursor.writeFloat(transform.y);
+                cursor.writeFloat(transform.kx);
+                cursor.writeFloat(transform.ky);
+                cursor.writeFloat(transform.sx);
+                cursor.writeFloat(transform.sy);
+                cursor.writeFloat(transform.f);
+                cursor.writeFloat(transform.a);
+                cursor.writeNull(padding);
+            }
+            return;
+        }
+
         inline auto encode_pc(
             const ReanimInfo &reanim
         ) -> void
@@ -43,18 +67,7 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             {
                 stream.writeStringByUint32(track.name);
                 stream.writeInt32(0x2C);
-                for (const auto &transform : track.transforms)
-                {
-                    stream.writeFloat(transform.x);
-                    stream.writeFloat(transform.y);
-                    stream.writeFloat(transform.kx);
-                    stream.writeFloat(transform.ky);
-                    stream.writeFloat(transform.sx);
-                    stream.writeFloat(transform.sy);
-                    stream.writeFloat(transform.f);
-                    stream.writeFloat(transform.a);
-                    stream.writeNull(12);
-                }
+                write_transform_list(stream, track.transforms, 12_size);
                 for (const auto &transform : track.transforms)
                 {
                     stream.writeStringByInt32(transform.i);
@@ -88,18 +101,7 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             {
                 stream.writeStringByUint32(track.name);
                 stream.writeInt32(0x30);
-                for (const auto &transform : track.transforms)
-                {
-                    stream.writeFloat(transform.x);
-                    stream.writeFloat(transform.y);
-                    stream.writeFloat(transform.kx);
-                    stream.writeFloat(transform.ky);
-                    stream.writeFloat(transform.sx);
-                    stream.writeFloat(transform.sy);
-                    stream.writeFloat(transform.f);
-                    stream.writeFloat(transform.a);
-                    stream.writeNull(16);
-                }
+                write_transform_list(stream, track.transforms, 16_size);
                 for (const auto &transform : track.transforms)
                 {
                     stream.writeStringByInt32(transform.i);
@@ -136,18 +138,7 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             {
                 stream.writeStringByUint32(track.name);
                 stream.writeInt32(0x2C);
-                for (const auto &transform : track.transforms)
-                {
-                    stream.writeFloat(transform.x);
-                    stream.writeFloat(transform.y);
-                    stream.writeFloat(transform.kx);
-                    stream.writeFloat(transform.ky);
-                    stream.writeFloat(transform.sx);
-                    stream.writeFloat(transform.sy);
-                    stream.writeFloat(transform.f);
-                    stream.writeFloat(transform.a);
-                    stream.writeNull(12);
-                }
+                write_transform_list(stream, track.transforms, 12_size);
                 for (const auto &transform : track.transforms)
                 {
                     stream.writeStringByInt32(transform.i);
@@ -182,18 +173,7 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             {
                 stream.writeStringByUint32(track.name);
                 stream.writeInt32(0x38);
-                for (const auto &transform : track.transforms)
-                {
-                    stream.writeFloat(transform.x);
-                    stream.writeFloat(transform.y);
-                    stream.writeFloat(transform.kx);
-                    stream.writeFloat(transform.ky);
-                    stream.writeFloat(transform.sx);
-                    stream.writeFloat(transform.sy);
-                    stream.writeFloat(transform.f);
-                    stream.writeFloat(transform.a);
-                    stream.writeNull(24);
-                }
+                write_transform_list(stream, track.transforms, 24_size);
                 for (const auto &transform : track.transforms)
                 {
                     stream.writeStringByInt32(transform.i);
@@ -227,18 +207,7 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             {
                 stream_big.writeStringByUint32(track.name);
                 stream_big.writeInt32(0x2C);
-                for (const auto &transform : track.transforms)
-                {
-                    stream_big.writeFloat(transform.x);
-                    stream_big.writeFloat(transform.y);
-                    stream_big.writeFloat(transform.kx);
-                    stream_big.writeFloat(transform.ky);
-                    stream_big.writeFloat(transform.sx);
-                    stream_big.writeFloat(transform.sy);
-                    stream_big.writeFloat(transform.f);
-                    stream_big.writeFloat(transform.a);
-                    stream_big.writeNull(12);
-                }
+                write_transform_list(stream_big, track.transforms, 12_size);
                 for (const auto &transform : track.transforms)
                 {
                     stream_big.writeStringByInt32(transform.i);
@@ -265,6 +234,7 @@ namespace Sen::Kernel::Support::PopCap::ReAnimation
             const ReanimInfo &reanim,
             ReanimPlatform platform) -> void
         {
+            stream.use_write_buffer();
             switch (platform)
             {
             case ReanimPlatform::PC_Compile:
@@ -20,14 +20,10 @@ namespace Sen::Kernel::Support::PopCap::ReflectionObjectNotation
             std::string_view iv
         ) -> void
         {
-            destination.writeBytes(
-                Rijndael::decrypt<std::uint64_t, Rijndael::Mode::CBC>(
-                    reinterpret_cast<char*>(source.getBytes(2, source.size()).data()),
-                    key, 
-                    iv, 
-                    source.size() - 2_size
-                )
-            );
+            auto cipher = source.data_view().subspan(std::min(2_size, source.size()));
+            auto offset = destination.write_pos;
+            destination.write_cursor(cipher.size());
+            Rijndael::decrypt<Rijndael::Mode::CBC>(cipher, destination.mutable_view().subspan(offset, cipher.size()), key, iv);
             return;
         }
 
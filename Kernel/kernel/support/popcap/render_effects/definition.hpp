@@ -4,6 +4,8 @@
 
 namespace Sen::Kernel::Support::PopCap::RenderEffects {
 
+	using Sen::Kernel::Definition::OnDemand;
+
 	#pragma region Block1
 
 	struct Block1 {
@@ -38,11 +40,11 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	};
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const Block1 & block
 	) -> void
 	{
-		json = nlohmann::ordered_json{
+		json = ordered_json{
 			{"unknown_1", block.unknown_1},
 			{"unknown_2", block.unknown_2},
 			{"unknown_3", block.unknown_3},
@@ -54,7 +56,7 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	}
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json, 
+		const ordered_json & json, 
 		Block1 & block
 	) -> void
 	{
@@ -66,6 +68,21 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 		json.at("unknown_6").get_to(block.unknown_6);
 		return;
 	}
+
+	inline static auto from_ondemand(
+		OnDemand::Value & value, 
+		Block1 & block
+	) -> void
+	{
+		auto object = OnDemand::as_object(value);
+		OnDemand::field(object, "unknown_1", block.unknown_1);
+		OnDemand::field(object, "unknown_2", block.unknown_2);
+		OnDemand::field(object, "unknown_3", block.unknown_3);
+		OnDemand::field(object, "unknown_4", block.unknown_4);
+		OnDemand::field(object, "unknown_5", block.unknown_5);
+		OnDemand::field(object, "unknown_6", block.unknown_6);
+		return;
+	}
 		
 
 	#pragma endregion
@@ -95,11 +112,11 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	};
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const Block2 & block
 	) -> void
 	{
-		json = nlohmann::ordered_json{
+		json = ordered_json{
 			{"unknown_1", block.unknown_1},
 			{"unknown_2", block.unknown_2}
 		};
@@ -107,7 +124,7 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	}
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json, 
+		const ordered_json & json, 
 		Block2 & block
 	) -> void
 	{
@@ -116,6 +133,17 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 		return;
 	}
 
+	inline static auto from_ondemand(
+		OnDemand::Value & value, 
+		Block2 & block
+	) -> void
+	{
+		auto object = OnDemand::as_object(value);
+		OnDemand::field(object, "unknown_1", block.unknown_1);
+		OnDemand::field(object, "unknown_2", block.unknown_2);
+		return;
+	}
+
 	#pragma endregion
 
 	#pragma region Block3
@@ -143,11 +171,11 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	};
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const Block3 & block
 	) -> void
 	{
-		json = nlohmann::ordered_json{
+		json = ordered_json{
 			{"unknown_2", block.unknown_2},
 			{"string", block.string}
 		};
@@ -155,7 +183,7 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	}
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json, 
+		const ordered_json & json, 
 		Block3 & block
 	) -> void
 	{
@@ -164,6 +192,17 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 		return;
 	}
 
+	inline static auto from_ondemand(
+		OnDemand::Value & value, 
+		Block3 & block
+	) -> void
+	{
+		auto object = OnDemand::as_object(value);
+		OnDemand::field(object, "unknown_2", block.unknown_2);
+		OnDemand::field(object, "string", block.string);
+		return;
+	}
+
 	#pragma endregion
 
 	#pragma region Block4
@@ -198,11 +237,11 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	};
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const Block4 & block
 	) -> void
 	{
-		json = nlohmann::ordered_json{
+		json = ordered_json{
 			{"unknown_1", block.unknown_1},
 			{"unknown_2", block.unknown_2},
 			{"unknown_3", block.unknown_3},
@@ -213,7 +252,7 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	}
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json, 
+		const ordered_json & json, 
 		Block4 & block
 	) -> void
 	{
@@ -225,6 +264,20 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 		return;
 	}
 
+	inline static auto from_ondemand(
+		OnDemand::Value & value, 
+		Block4 & block
+	) -> void
+	{
+		auto object = OnDemand::as_object(value);
+		OnDemand::field(object, "unknown_1", block.unknown_1);
+		OnDemand::field(object, "unknown_2", block.unknown_2);
+		OnDemand::field(object, "unknown_3", block.unknown_3);
+		OnDemand::field(object, "unknown_4", block.unknown_4);
+		OnDemand::field(object, "unknown_5", block.unknown_5);
+		return;
+	}
+
 	#pragma endregion
 
 	#pragma region Block5
@@ -263,11 +316,11 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	};
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const Block5 & block
 	) -> void
 	{
-		json = nlohmann::ordered_json{
+		json = ordered_json{
 			{"unknown_1", block.unknown_1},
 			{"unknown_2", block.unknown_2},
 			{"unknown_3", block.unknown_3},
@@ -280,7 +333,7 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	}
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json, 
+		const ordered_json & json, 
 		Block5 & block
 	) -> void
 	{
@@ -293,6 +346,22 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 		json.at("unknown_7").get_to(block.unknown_7);
 		return;
 	}
+
+	inline static auto from_ondemand(
+		OnDemand::Value & value, 
+		Block5 & block
+	) -> void
+	{
+		auto object = OnDemand::as_object(value);
+		OnDemand::field(object, "unknown_1", block.unknown_1);
+		OnDemand::field(object, "unknown_2", block.unknown_2);
+		OnDemand::field(object, "unknown_3", block.unknown_3);
+		OnDemand::field(object, "unknown_4", block.unknown_4);
+		OnDemand::field(object, "unknown_5", block.unknown_5);
+		OnDemand::field(object, "unknown_6", block.unknown_6);
+		OnDemand::field(object, "unknown_7", block.unknown_7);
+		return;
+	}
 		
 
 	#pragma endregion
@@ -329,11 +398,11 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	};
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const Block6 & block
 	) -> void
 	{
-		json = nlohmann::ordered_json{
+		json = ordered_json{
 			{"unknown_1", block.unknown_1},
 			{"unknown_2", block.unknown_2},
 			{"unknown_3", block.unknown_3},
@@ -344,7 +413,7 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	}
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json, 
+		const ordered_json & json, 
 		Block6 & block
 	) -> void
 	{
@@ -356,6 +425,20 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 		return;
 	}
 
+	inline static auto from_ondemand(
+		OnDemand::Value & value, 
+		Block6 & block
+	) -> void
+	{
+		auto object = OnDemand::as_object(value);
+		OnDemand::field(object, "unknown_1", block.unknown_1);
+		OnDemand::field(object, "unknown_2", block.unknown_2);
+		OnDemand::field(object, "unknown_3", block.unknown_3);
+		OnDemand::field(object, "unknown_4", block.unknown_4);
+		OnDemand::field(object, "unknown_5", block.unknown_5);
+		return;
+	}
+
 	#pragma endregion
 
 	#pragma region Block7
@@ -383,11 +466,11 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	};
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const Block7 & block
 	) -> void
 	{
-		json = nlohmann::ordered_json{
+		json = ordered_json{
 			{"unknown_1", block.unknown_1},
 			{"unknown_2", block.unknown_2}
 		};
@@ -395,7 +478,7 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	}
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json, 
+		const ordered_json & json, 
 		Block7 & block
 	) -> void
 	{
@@ -404,6 +487,17 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 		return;
 	}
 
+	inline static auto from_ondemand(
+		OnDemand::Value & value, 
+		Block7 & block
+	) -> void
+	{
+		auto object = OnDemand::as_object(value);
+		OnDemand::field(object, "unknown_1", block.unknown_1);
+		OnDemand::field(object, "unknown_2", block.unknown_2);
+		return;
+	}
+
 	#pragma endregion
 
 	#pragma region Block8
@@ -438,11 +532,11 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	};
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const Block8 & block
 	) -> void
 	{
-		json = nlohmann::ordered_json{
+		json = ordered_json{
 			{"unknown_1", block.unknown_1},
 			{"unknown_2", block.unknown_2},
 			{"unknown_3", block.unknown_3},
@@ -453,7 +547,7 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	}
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json, 
+		const ordered_json & json, 
 		Block8 & block
 	) -> void
 	{
@@ -465,6 +559,20 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 		return;
 	}
 
+	inline static auto from_ondemand(
+		OnDemand::Value & value, 
+		Block8 & block
+	) -> void
+	{
+		auto object = OnDemand::as_object(value);
+		OnDemand::field(object, "unknown_1", block.unknown_1);
+		OnDemand::field(object, "unknown_2", block.unknown_2);
+		OnDemand::field(object, "unknown_3", block.unknown_3);
+		OnDemand::field(object, "unknown_4", block.unknown_4);
+		OnDemand::field(object, "unknown_5", block.unknown_5);
+		return;
+	}
+
 	#pragma endregion
 
 	#pragma region RenderEffects 	
@@ -512,11 +620,11 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	};
 
 	inline static auto to_json(
-		nlohmann::ordered_json & json,
+		ordered_json & json,
 		const PopCapRenderEffects & p
 	) -> void
 	{
-		json = nlohmann::ordered_json{
+		json = ordered_json{
 			{"block_1", p.block_1},
 			{"block_2", p.block_2},
 			{"block_3", p.block_3},
@@ -530,7 +638,7 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 	}
 
 	inline static auto from_json(
-		const nlohmann::ordered_json & json,
+		const ordered_json & json,
 		PopCapRenderEffects & p
 	) -> void
 	{
@@ -545,5 +653,22 @@ namespace Sen::Kernel::Support::PopCap::RenderEffects {
 		return;
 	}
 
+	inline static auto from_ondemand(
+		OnDemand::Value & value, 
+		PopCapRenderEffects & p
+	) -> void
+	{
+		auto object = OnDemand::as_object(value);
+		OnDemand::field(object, "block_1", p.block_1);
+		OnDemand::field(object, "block_2", p.block_2);
+		OnDemand::field(object, "block_3", p.block_3);
+		OnDemand::field(object, "block_4", p.block_4);
+		OnDemand::field(object, "block_5", p.block_5);
+		OnDemand::field(object, "block_6", p.block_6);
+		OnDemand::field(object, "block_7", p.block_7);
+		OnDemand::field(object, "block_8", p.block_8);
+		return;
+	}
+
 	#pragma endregion
 }
\ No newline at end of file
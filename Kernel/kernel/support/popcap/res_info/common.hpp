@@ -19,16 +19,16 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 			*/
 
 			virtual auto generate_subgroup(
-				const nlohmann::ordered_json & resource
-			) -> nlohmann::ordered_json = 0;
+				const ordered_json & resource
+			) -> ordered_json = 0;
 
 			/**
 			 * abstract method
 			*/
 
 			virtual auto convert_info(
-				const nlohmann::ordered_json &resource
-			) -> nlohmann::ordered_json = 0;
+				const ordered_json &resource
+			) -> ordered_json = 0;
 
 		public:
 
@@ -77,10 +77,10 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 			*/
 
 			inline auto generate_subgroup(
-				const nlohmann::ordered_json & resource
-			) -> nlohmann::ordered_json override final
+				const ordered_json & resource
+			) -> ordered_json override final
 			{
-				return nlohmann::ordered_json {
+				return ordered_json {
 					{"is_composite", resource["is_composite"]},
 					{"subgroups", Object::keys(resource["subgroup"])}
 				};
@@ -91,15 +91,15 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 			*/
 
 			inline auto convert_info(
-				const nlohmann::ordered_json & resource
-			) -> nlohmann::ordered_json override final
+				const ordered_json & resource
+			) -> ordered_json override final
 			{
-				auto result = nlohmann::ordered_json{
-					{"information", nlohmann::ordered_json {
+				auto result = ordered_json{
+					{"information", ordered_json {
 						{"expand_path", resource["expand_path"]}
 					}}
 				};
-				auto group = nlohmann::ordered_json{};
+				auto group = ordered_json{};
 				auto group_key = Object::keys(resource["groups"]);
 				for(auto i : Range<size_t>(group_key.size())){
 					group[group_key[i]] = thiz.generate_subgroup(resource["groups"][group_key[i]]);
@@ -162,11 +162,11 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 			) -> void override final
 			{
 				auto info = *FileSystem::read_json(Path::normalize(fmt::format("{}/{}", source, "data.json")));
-				auto res_info = nlohmann::ordered_json{
+				auto res_info = ordered_json{
 					{"expand_path", info["information"]["expand_path"]}
 				};
 				for(auto & [group_name, group_value] : info["groups"].items()) {
-					auto subgroups = nlohmann::ordered_json{
+					auto subgroups = ordered_json{
 						{"is_composite", group_value["is_composite"]}
 					};
 					for(auto & subgroup_name : group_value["subgroups"]) {
@@ -84,16 +84,16 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 
 			inline auto generate_composite(
 				std::string_view id,
-    			const nlohmann::ordered_json & composite
-			) -> nlohmann::ordered_json
+    			const ordered_json & composite
+			) -> ordered_json
 			{
-				auto result = nlohmann::ordered_json{
+				auto result = ordered_json{
 					{ "type", Convert::Composite },
 					{ "id", id },
-					{ "subgroups", nlohmann::ordered_json::array() }
+					{ "subgroups", ordered_json::array() }
 				};
 				for(auto & [element, value] : composite["subgroup"].items()) {
-					auto subgroup = nlohmann::ordered_json {
+					auto subgroup = ordered_json {
 						{"id", element}
 					};
 					if(!composite["subgroup"][element]["type"].is_null() and composite["subgroup"][element]["type"].get<std::string_view>() != Convert::emptyType){
@@ -116,24 +116,24 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 			template <auto use_string_for_style>
 			inline auto generate_common(
 				const SubInformation & extra_information,
-				const nlohmann::ordered_json & resource_information
-			) -> nlohmann::ordered_json
+				const ordered_json & resource_information
+			) -> ordered_json
 			{
 				static_assert(use_string_for_style == true or use_string_for_style == false);
 				static_assert(sizeof(use_string_for_style) == sizeof(bool));
-				auto result = nlohmann::ordered_json {
+				auto result = ordered_json {
 					{"type", Simple},
 					{"id", extra_information.id}
 				};
 				if (resource_information.find("loc") != resource_information.end()) {
 					result["loc"] = resource_information["loc"];
 				}
-				result["resources"] = nlohmann::ordered_json::array();
+				result["resources"] = ordered_json::array();
 				if(!extra_information.parent.empty()){
 					result["parent"] = extra_information.parent;
 				}
 				for(auto & [key, value] : resource_information["packet"]["data"].items()){
-					auto resource = nlohmann::ordered_json {
+					auto resource = ordered_json {
 						{"type", value["type"].get<std::string>()},
 						{"slot", 0},
 						{"id", key}
@@ -158,20 +158,20 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 			template <auto use_string_for_style>
 			inline auto generate_image(
 				const SubInformation & extra_information,
-				const nlohmann::ordered_json & resource_information
-			) -> nlohmann::ordered_json
+				const ordered_json & resource_information
+			) -> ordered_json
 			{
 				static_assert(use_string_for_style == true or use_string_for_style == false);
 				static_assert(sizeof(use_string_for_style) == sizeof(bool));
-				auto result = nlohmann::ordered_json {
+				auto result = ordered_json {
 					{"type", Simple},
 					{"id", extra_information.id},
 					{"res", resource_information["type"].get<std::string>()},
 					{"parent", extra_information.parent},
-					{"resources", nlohmann::ordered_json::array()}
+					{"resources", ordered_json::array()}
 				};
 				for(auto & [key, value] : resource_information["packet"].items()){
-					auto resource = nlohmann::ordered_json {
+					auto resource = ordered_json {
 						{"type", value["type"].get<std::string>()},
 						{"slot", 0},
 						{"id", key},
@@ -188,7 +188,7 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 					}
 					result["resources"].emplace_back(resource);
 					for(auto & [sub, sub_value] : value["data"].items()){
-						auto sub_resource = nlohmann::ordered_json {
+						auto sub_resource = ordered_json {
 							{"type", sub_value["type"].get<std::string>()},
 							{"slot", 0},
 							{"id", sub},
@@ -251,8 +251,8 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 			*/
 
 			inline auto process(
-				const nlohmann::ordered_json & res_info,
-				nlohmann::ordered_json &result
+				const ordered_json & res_info,
+				ordered_json &result
 			) -> void
 			{
 				assert_conditional(res_info.find("expand_path") != res_info.end(), fmt::format("{}", Kernel::Language::get("popcap.res_info.convert.expand_path_is_null_in_res_info")), "process");
@@ -337,8 +337,8 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 			*/
 
 			inline static auto convert (
-				const nlohmann::ordered_json & res_info,
-				nlohmann::ordered_json &destination
+				const ordered_json & res_info,
+				ordered_json &destination
 			) -> void
 			{
 				auto converter = Sen::Kernel::Support::PopCap::ResInfo::Convert{};
@@ -358,11 +358,11 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 				std::string_view destination
 			) -> void
 			{
-				auto result = nlohmann::ordered_json {
+				auto result = ordered_json {
 					{"version", 1},
 					{"content_version", 1},
 					{"slot_count", 0},
-					{"groups", nlohmann::ordered_json::array()}
+					{"groups", ordered_json::array()}
 				};
 				Convert::convert(*FileSystem::read_json(source), result);
 				FileSystem::write_json(destination, result);
@@ -14,7 +14,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceGroup {
 		public:
 
 			inline static auto rewrite_slot_count(
-				nlohmann::ordered_json &resource
+				ordered_json &resource
 			) -> void
 			{
 				auto slot_group = std::unordered_map<std::string, size_t>();
@@ -70,7 +70,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceGroup {
 				auto resource = *FileSystem::read_json(source);
 				assert_conditional(!resource["groups"].is_null(), fmt::format("{}", Language::get("popcap.resource_group.split.groups_cannot_be_null")), "split");
 				FileSystem::create_directory(fmt::format("{}/{}", destination, "subgroup"));
-				auto content = nlohmann::ordered_json{};
+				auto content = ordered_json{};
 				for(auto & c : resource["groups"])
 				{
 					if (c.find("resources") != c.end())
@@ -123,21 +123,21 @@ namespace Sen::Kernel::Support::PopCap::ResourceGroup {
 			) -> void
 			{
 				auto content = *FileSystem::read_json(Path::normalize(fmt::format("{}/{}", source, "data.json")));
-				auto resources_json = nlohmann::ordered_json{
+				auto resources_json = ordered_json{
 					{"version", 1},
 					{"content_version", 1},
 					{"slot_count", 0}
 				};
-				auto groups = nlohmann::ordered_json::array_t();
+				auto groups = ordered_json::array_t();
 				for(auto & [parent, parent_value] : content.items()){
 					if(content[parent]["is_composite"]){
-						auto composite_object = nlohmann::ordered_json{
+						auto composite_object = ordered_json{
 							{"id", parent},
 							{"type", "composite"},
-							{"subgroups", nlohmann::ordered_json::array()}
+							{"subgroups", ordered_json::array()}
 						};
 						for(auto & [subgroup, subgroup_value] : content[parent]["subgroups"].items()){
-							auto resource_for_subgroup = nlohmann::ordered_json{{"id", subgroup}};
+							auto resource_for_subgroup = ordered_json{{"id", subgroup}};
 							if(!content[parent]["subgroups"][subgroup]["type"].is_null()){
 								resource_for_subgroup["res"] = content[parent]["subgroups"][subgroup]["type"];
 							}
@@ -91,54 +91,54 @@ namespace Sen::Kernel::Support::PopCap::ResourceGroup {
 			*/
 
 			inline auto convert_atlas(
-				const nlohmann::ordered_json & subgroup
-			) -> nlohmann::ordered_json
+				const ordered_json & subgroup
+			) -> ordered_json
 			{
-				auto result = nlohmann::ordered_json {
+				auto result = ordered_json {
 					{"type", subgroup["res"]}
 				};
-				auto atlas = std::vector<nlohmann::ordered_json>{};
+				auto atlas = std::vector<ordered_json>{};
 				for(auto & element : subgroup["resources"]){
 					if(element.find("atlas") != element.end() && element["atlas"].get<bool>()){
 						atlas.emplace_back(element);
 					}
 				}
 				for(auto & parent : atlas) {
-					auto atlas_data = nlohmann::ordered_json{};
+					auto atlas_data = ordered_json{};
 					if constexpr (use_string_for_style) {
-						atlas_data =  nlohmann::ordered_json{
+						atlas_data =  ordered_json{
 							{"type", parent["type"].get<std::string>()},
 							{"path", String::replaceAll(parent["path"].get<std::string>(), Common::WindowStyle, Common::PosixStyle)},
-							{"dimension", nlohmann::ordered_json {
+							{"dimension", ordered_json {
 								{"width", parent["width"].get<int>() },
 								{"height", parent["height"].get<int>() }
 							}}
 						};
 					}
 					else {
-						atlas_data =  nlohmann::ordered_json{
+						atlas_data =  ordered_json{
 							{"type", parent["type"].get<std::string>()},
 							{"path", String::join(parent["path"].get<std::vector<std::string>>(), Common::PosixStyle)},
-							{"dimension", nlohmann::ordered_json {
+							{"dimension", ordered_json {
 								{"width", parent["width"].get<int>() },
 								{"height", parent["height"].get<int>() }
 							}}
 						};
 					}
-					auto children_in_current_parent = std::vector<nlohmann::ordered_json>{};
+					auto children_in_current_parent = std::vector<ordered_json>{};
 					for(auto & element : subgroup["resources"]) {
 						if(element.find("parent") != element.end() and element["parent"].get<std::string>() == parent["id"].get<std::string>()) {
 							children_in_current_parent.emplace_back(element);
 						}
 					}
 					for(auto & element : children_in_current_parent) {
-						auto children_data = nlohmann::ordered_json{};
+						auto children_data = ordered_json{};
 						if constexpr (use_string_for_style) {
-							children_data = nlohmann::ordered_json {
+							children_data = ordered_json {
 								{"type", element["type"].get<std::string>()},
 								{"path", String::replaceAll(element["path"].get<std::string>(), Common::WindowStyle, Common::PosixStyle)},
 								{
-									"default", nlohmann::ordered_json {
+									"default", ordered_json {
 										{"ax", element["ax"].get<int>()},
 										{"ay", element["ay"].get<int>()},
 										{"aw", element["aw"].get<int>()},
@@ -147,11 +147,11 @@ namespace Sen::Kernel::Support::PopCap::ResourceGroup {
 							};
 						}
 						else {
-							children_data = nlohmann::ordered_json {
+							children_data = ordered_json {
 								{"type", element["type"].get<std::string>()},
 								{"path", String::join(element["path"].get<std::vector<std::string>>(), Common::PosixStyle)},
 								{
-									"default", nlohmann::ordered_json {
+									"default", ordered_json {
 										{"ax", element["ax"].get<int>()},
 										{"ay", element["ay"].get<int>()},
 										{"aw", element["aw"].get<int>()},
@@ -191,28 +191,28 @@ namespace Sen::Kernel::Support::PopCap::ResourceGroup {
 			*/
 
 			inline auto convert_common(
-				const nlohmann::ordered_json & subgroup
-			) -> nlohmann::ordered_json
+				const ordered_json & subgroup
+			) -> ordered_json
 			{
-				auto result = nlohmann::ordered_json {
+				auto result = ordered_json {
 					{"type", nullptr}
 				};
 				if (subgroup.find("loc") != subgroup.end()) {
 					result["loc"] = subgroup["loc"];
 				}
-				result["packet"] = nlohmann::ordered_json{{"type", "File"}};
-				auto data = nlohmann::ordered_json{};
+				result["packet"] = ordered_json{{"type", "File"}};
+				auto data = ordered_json{};
 				for(auto & element : subgroup["resources"]) {
-					auto sub_data = nlohmann::ordered_json{};
+					auto sub_data = ordered_json{};
 					if constexpr (use_string_for_style)
 					{
-						sub_data = nlohmann::ordered_json {
+						sub_data = ordered_json {
 							{"type", element["type"].get<std::string>()},
 							{"path", String::replaceAll(element["path"].get<std::string>(), Common::WindowStyle, Common::PosixStyle) }
 						};
 					}
 					else {
-						sub_data = nlohmann::ordered_json {
+						sub_data = ordered_json {
 							{"type", element["type"].get<std::string>()},
 							{"path", String::join(element["path"].get<std::vector<std::string>>(), Common::PosixStyle) }
 						};
@@ -231,9 +231,9 @@ namespace Sen::Kernel::Support::PopCap::ResourceGroup {
 			*/
 
 			inline static auto first_where(
-				const nlohmann::ordered_json & resource_group,
+				const ordered_json & resource_group,
 				const std::string & id
-			) -> nlohmann::ordered_json
+			) -> ordered_json
 			{
 				for(auto & element : resource_group["groups"]){
 					if(element["id"] == id) {
@@ -253,24 +253,24 @@ namespace Sen::Kernel::Support::PopCap::ResourceGroup {
 			*/
 
 			inline auto convert_whole(
-				const nlohmann::ordered_json & resource_group
-			) -> nlohmann::ordered_json
+				const ordered_json & resource_group
+			) -> ordered_json
 			{
 				assert_conditional(resource_group.find("groups") != resource_group.end(), fmt::format("\"{}\" cannot be null in resource group", "groups"), "convert_whole");
-				auto result = nlohmann::ordered_json{};
+				auto result = ordered_json{};
 				if constexpr (use_string_for_style) {
-					result = nlohmann::ordered_json{
+					result = ordered_json{
 						{"expand_path", Common::String
 					}};
 				}
 				else {
-					result = nlohmann::ordered_json{
+					result = ordered_json{
 						{"expand_path", Common::Array
 					}};
 				}
 				for(auto & element : resource_group["groups"]) {
 					if(element.find("subgroups") != element.end()){
-						auto subgroup = nlohmann::ordered_json {
+						auto subgroup = ordered_json {
 							{"is_composite", true}
 						};
 						for(auto & k : element["subgroups"]) {
@@ -284,7 +284,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceGroup {
 						result["groups"][element["id"].get<std::string>()] = subgroup;
 					}
 					if(element.find("parent") == element.end() && element.find("resources") != element.end()) {
-						auto subgroup = nlohmann::ordered_json {
+						auto subgroup = ordered_json {
 							{"is_composite", false}
 						};
 						subgroup["subgroup"][element["id"].get<std::string>()] = thiz.convert_common(element);
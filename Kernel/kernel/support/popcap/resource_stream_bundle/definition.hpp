@@ -16,7 +16,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SimpleCategoryInformation &nlohmann_json_t) -> void
     {
         if (nlohmann_json_t.is_image)
@@ -37,7 +37,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SimpleCategoryInformation &nlohmann_json_t) -> void
     {
         if (nlohmann_json_j.at("resolution") != nullptr)
@@ -60,7 +60,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SubgroupInformation &nlohmann_json_t) -> void
     {
         if (nlohmann_json_t.category.is_image || !nlohmann_json_t.category.locale.empty()) {
@@ -75,7 +75,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SubgroupInformation &nlohmann_json_t) -> void
     {
         if (nlohmann_json_j.at("category") != nullptr)
@@ -94,7 +94,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const GroupInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j["composite"] = nlohmann_json_t.composite;
@@ -103,7 +103,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         GroupInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("composite").get_to(nlohmann_json_t.composite);
@@ -119,7 +119,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const BundleStructure &nlohmann_json_t) -> void
     {
         nlohmann_json_j["version"] = nlohmann_json_t.version;
@@ -129,7 +129,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         BundleStructure &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("version").get_to(nlohmann_json_t.version);
@@ -142,11 +142,11 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     struct ManifestResource {
         std::string path;
         uint16_t type;
-        nlohmann::ordered_json property;
+        ordered_json property;
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ManifestResource &nlohmann_json_t) -> void
     {
         nlohmann_json_j["path"] = nlohmann_json_t.path;
@@ -156,7 +156,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ManifestResource &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("path").get_to(nlohmann_json_t.path);
@@ -171,7 +171,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ManifestSubgroupInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j["category"] = nlohmann_json_t.category;
@@ -180,7 +180,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ManifestSubgroupInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("category").get_to(nlohmann_json_t.category);
@@ -194,7 +194,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ManifestGroupInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j["composite"] = nlohmann_json_t.composite;
@@ -203,7 +203,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ManifestGroupInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("composite").get_to(nlohmann_json_t.composite);
@@ -217,7 +217,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ManifestStructure &nlohmann_json_t) -> void
     {
         nlohmann_json_j["group"] = nlohmann_json_t.group;
@@ -225,7 +225,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ManifestStructure &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("group").get_to(nlohmann_json_t.group);
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "kernel/definition/utility.hpp"
+#include "kernel/support/texture/invoke.hpp"
+#include "kernel/support/popcap/resource_stream_group/unpack.hpp"
+#include "kernel/support/popcap/resource_stream_group/pack.hpp"
+#include "kernel/support/popcap/resource_stream_bundle/unpack.hpp"
+#include "kernel/support/popcap/resource_stream_bundle/pack.hpp"
+
+namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous
+{
+    using namespace Definition;
+
+    /**
+     * Convert an Android bundle to the iOS texture layout without an unpacked folder
+     * Image subgroups of the other resolution are dropped, the textures of the kept ones are
+     * re-encoded as ARGB 8888 and only their packets are rebuilt, every other packet is passed through
+     */
+
+    struct ConvertAndroidToIOS
+    {
+    protected:
+        using PacketData = std::map<std::string, std::vector<uint8_t>>;
+
+        inline static constexpr auto k_high_resolution = 1536;
+
+        inline static constexpr auto k_low_resolution = 768;
+
+        inline static constexpr auto k_ios_format = 0_ui;
+
+        inline static auto exchange_android_format(
+            uint32_t format) -> Texture::Format
+        {
+            switch (format)
+            {
+            case 0_ui:
+                return Texture::Format::RGBA_8888;
+            case 147_ui:
+                return Texture::Format::RGB_ETC1_A_8;
+            default:
+                assert_conditional(false, String::format(fmt::format("{}", Language::get("popcap.ptx.invalid_image_format")), std::to_string(format)), "exchange_android_format");
+            }
+            return Texture::Format::RGBA_8888;
+        }
+
+        inline static auto convert_packet(
+            std::vector<uint8_t> &packet_data,
+            SubgroupInformation &subgroup_information) -> void
+        {
+            auto packet_stream = DataStreamView{packet_data};
+            auto packet_structure = PacketStructure{};
+            auto resource_data = PacketData{};
+            ResourceStreamGroup::Unpack::process_whole(packet_stream, packet_structure, resource_data);
+            for (auto &resource : subgroup_information.resource)
+            {
+                if (!resource.use_texture_additional_instead)
+                {
+                    continue;
+                }
+                auto &texture_value = resource.texture_additional.value;
+                auto &data = resource_data.at(toupper_back(String::to_windows_style(resource.path)));
+                auto image = Texture::InvokeMethod::decode_whole(data, texture_value.dimension.width, texture_value.dimension.height, exchange_android_format(texture_value.texture_infomation.format));
+                data = Texture::InvokeMethod::encode_whole(image, Texture::Format::ARGB_8888);
+                texture_value.texture_infomation.format = k_ios_format;
+                texture_value.texture_infomation.pitch = static_cast<uint32_t>(texture_value.dimension.width) * 4_ui;
+            }
+            auto result = DataStreamView{};
+            ResourceStreamGroup::Pack::process_whole(result, packet_structure, resource_data);
+            packet_data = result.toBytes();
+            return;
+        }
+
+    public:
+        /**
+         * resolution: high_quality_resolution or low_quality_resolution
+         * return: the resolution kept in the bundle
+         */
+
+        inline static auto exchange_resolution(
+            std::string_view resolution) -> int
+        {
+            if (resolution == "high_quality_resolution"_sv)
+            {
+                return k_high_resolution;
+            }
+            if (resolution == "low_quality_resolution"_sv)
+            {
+                return k_low_resolution;
+            }
+            assert_conditional(false, fmt::format("{}", Language::get("popcap.ptx.invalid_rsb_resolution")), "exchange_resolution");
+            return k_high_resolution;
+        }
+
+        inline static auto process_whole(
+            DataStreamView &source,
+            DataStreamView &destination,
+            int resolution) -> void
+        {
+            auto definition = BundleStructure{};
+            auto manifest = ManifestStructure{};
+            auto packet_data = PacketData{};
+            Unpack::process_whole(source, definition, manifest, packet_data);
+            auto image_subgroup = std::vector<std::pair<std::string, SubgroupInformation *>>{};
+            for (auto &[group_id, group_information] : definition.group)
+            {
+                for (auto it = group_information.subgroup.begin(); it != group_information.subgroup.end();)
+                {
+                    auto &[subgroup_id, subgroup_information] = *it;
+                    if (!subgroup_information.category.is_image)
+                    {
+                        ++it;
+                        continue;
+                    }
+                    if (subgroup_information.category.resolution != resolution)
+                    {
+                        packet_data.erase(subgroup_id);
+                        if (auto manifest_group = manifest.group.find(group_id); manifest_group != manifest.group.end())
+                        {
+                            manifest_group->second.subgroup.erase(subgroup_id);
+                        }
+                        it = group_information.subgroup.erase(it);
+                        continue;
+                    }
+                    image_subgroup.emplace_back(subgroup_id, &subgroup_information);
+                    ++it;
+                }
+            }
+            // each task owns one packet and one subgroup, the maps are not resized while the pool runs
+            ThreadPool::parallel_for_each(image_subgroup, [&packet_data](auto &element) {
+                auto &[subgroup_id, subgroup_information] = element;
+                convert_packet(packet_data.at(subgroup_id), *subgroup_information);
+            });
+            Pack::process_whole(destination, definition, manifest, packet_data);
+            return;
+        }
+
+        inline static auto process_fs(
+            std::string_view source,
+            std::string_view destination,
+            std::string_view resolution) -> void
+        {
+            auto source_stream = DataStreamView{source};
+            auto destination_stream = DataStreamView{};
+            destination_stream.use_write_buffer();
+            process_whole(source_stream, destination_stream, exchange_resolution(resolution));
+            destination_stream.out_file(destination);
+            return;
+        }
+    };
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "kernel/definition/utility.hpp"
+#include "kernel/support/popcap/resource_stream_bundle/common.hpp"
+
+namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous
+{
+    using namespace Definition;
+
+    /**
+     * Scramble the names of every subgroup and pool and the head of every packet,
+     * the tables are patched in place, packet data is never copied
+     */
+
+    struct Obfuscate
+    {
+    public:
+        struct Result
+        {
+            uint8_t version;
+            uint32_t modify_count;
+        };
+
+    protected:
+        inline static constexpr auto k_version_offset = 0x04_size;
+
+        inline static constexpr auto k_subgroup_section_size = 0x80_size;
+
+        inline static constexpr auto k_packet_offset_in_subgroup = 0x80_size;
+
+        inline static constexpr auto k_packet_section_offset_in_subgroup = 0x84_size;
+
+        inline static constexpr auto k_packet_section_size = 0x10_size;
+
+        inline static constexpr auto k_packet_head_size = 0x40_size;
+
+        template <typename Engine>
+        inline static auto make_random(
+            Engine &engine,
+            size_t size) -> std::vector<uint8_t>
+        {
+            auto distribution = std::uniform_int_distribution<int>{0x00, 0xFF};
+            auto result = std::vector<uint8_t>(size);
+            for (auto &e : result)
+            {
+                e = static_cast<uint8_t>(distribution(engine));
+            }
+            return result;
+        }
+
+        // any byte in [0x00, 0xFF) except a valid version, so the bundle no longer parses as 3 or 4
+
+        template <typename Engine>
+        inline static auto make_version(
+            Engine &engine) -> uint8_t
+        {
+            auto distribution = std::uniform_int_distribution<int>{0x00, 0xFE};
+            auto result = uint8_t{};
+            do
+            {
+                result = static_cast<uint8_t>(distribution(engine));
+            } while (result == 3_byte || result == 4_byte);
+            return result;
+        }
+
+        inline static auto write_section(
+            DataStreamView &stream,
+            std::vector<uint8_t> const &value,
+            size_t offset) -> void
+        {
+            assert_conditional(offset <= stream.size() && value.size() <= stream.size() - offset, fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "write_section");
+            stream.writeBytes(value, offset);
+            return;
+        }
+
+    public:
+        inline static auto process_whole(
+            DataStreamView &stream) -> Result
+        {
+            auto header = Common::HeaderInformaiton{};
+            Common::exchange_to_header(stream, header);
+            assert_conditional(header.magic == Common::k_magic_identifier, fmt::format("{}", Language::get("popcap.rsb.unpack.invalid_rsb_magic")), "process_whole");
+            auto engine = std::mt19937{std::random_device{}()};
+            auto result = Result{
+                .version = make_version(engine),
+                .modify_count = header.subgroup_information_section_block_count};
+            stream.writeUint8(result.version, k_version_offset);
+            auto subgroup_section = make_random(engine, k_subgroup_section_size);
+            auto packet_section = make_random(engine, k_packet_section_size);
+            auto packet_head = make_random(engine, k_packet_head_size);
+            for (auto index : Range(static_cast<size_t>(header.subgroup_information_section_block_count)))
+            {
+                auto subgroup_offset = static_cast<size_t>(header.subgroup_information_section_offset) + index * static_cast<size_t>(header.subgroup_information_section_block_size);
+                auto pool_offset = static_cast<size_t>(header.pool_information_section_offset) + index * static_cast<size_t>(header.pool_information_section_block_size);
+                write_section(stream, subgroup_section, subgroup_offset);
+                write_section(stream, subgroup_section, pool_offset);
+                write_section(stream, packet_section, subgroup_offset + k_packet_section_offset_in_subgroup);
+                write_section(stream, packet_head, static_cast<size_t>(stream.readUint32(subgroup_offset + k_packet_offset_in_subgroup)));
+            }
+            return result;
+        }
+
+        inline static auto process_fs(
+            std::string_view source,
+            std::string_view destination) -> Result
+        {
+            auto stream = DataStreamView{source};
+            auto result = process_whole(stream);
+            stream.out_file(destination);
+            return result;
+        }
+    };
+}
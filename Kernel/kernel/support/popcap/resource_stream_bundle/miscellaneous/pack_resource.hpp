@@ -11,23 +11,54 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous
     struct PackResource
     {
     protected:
+        struct PacketTask
+        {
+            std::string subgroup_id;
+            PacketStructure packet_structure;
+        };
+
         inline static auto exchange_packet(
             PacketStructure const &packet_structure,
-            std::string source
+            std::string const &source
         ) -> std::vector<uint8_t>
         {
             auto packet_stream = DataStreamView{};
-            ResourceStreamGroup::Pack::process_whole(packet_stream, packet_structure, source);
+            auto packet_source = source;
+            ResourceStreamGroup::Pack::process_whole(packet_stream, packet_structure, packet_source);
             return packet_stream.toBytes();
         }
 
+        // the packet is at most as large as its resources, a missing file is reported by the pack itself
+
+        inline static auto exchange_packet_size(
+            PacketStructure const &packet_structure,
+            std::string const &source) -> size_t
+        {
+            auto size = k_none_size;
+            for (auto &resource : packet_structure.resource)
+            {
+                auto error = std::error_code{};
+                auto resource_path = fmt::format("{}/resource/{}", source, resource.path);
+                #if WINDOWS
+                auto resource_size = std::filesystem::file_size(std::filesystem::path{String::utf8_to_utf16(resource_path.data())}, error);
+                #else
+                auto resource_size = std::filesystem::file_size(std::filesystem::path{resource_path}, error);
+                #endif
+                if (!error)
+                {
+                    size += static_cast<size_t>(resource_size);
+                }
+            }
+            return size;
+        }
+
         inline static auto process(
             DataStreamView &stream,
             BundleStructure const &definition,
             ManifestStructure const &manifest,
             std::string &source) -> void
         {
-            auto work_map = std::map<std::string, std::future<std::vector<uint8_t>>>{};
+            auto packet_list = std::vector<PacketTask>{};
             for (auto &[group_id, group_information] : definition.group)
             {
                 for (auto &[subgroup_id, subgroup_information] : group_information.subgroup)
@@ -36,13 +67,20 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous
                         .version = definition.version,
                         .resource = subgroup_information.resource};
                     Sen::Kernel::Support::PopCap::ResourceStreamGroup::Common::packet_compression_from_data(subgroup_information.compression, packet_structure.compression);
-                    work_map[subgroup_id] = std::async(&exchange_packet, packet_structure, source);
+                    packet_list.emplace_back(PacketTask{
+                        .subgroup_id = subgroup_id,
+                        .packet_structure = std::move(packet_structure)});
                 }
             }
             auto packet_data_section_view_stored = std::map<std::string, std::vector<uint8_t>>{};
-            for (auto &[subgroup_id, future]: work_map) {
-                packet_data_section_view_stored[subgroup_id] = future.get();
-            }
+            process_in_order_bounded(
+                packet_list.size(),
+                [&](size_t index)
+                { return exchange_packet_size(packet_list[index].packet_structure, source); },
+                [&](size_t index)
+                { return exchange_packet(packet_list[index].packet_structure, source); },
+                [&](size_t index, std::vector<uint8_t> &&packet_data)
+                { packet_data_section_view_stored[packet_list[index].subgroup_id] = std::move(packet_data); });
             ResourceStreamBundle::Pack::process_whole(stream, definition, manifest, packet_data_section_view_stored);
             return;
         }
@@ -0,0 +1,334 @@
+#pragma once
+
+#include "kernel/definition/utility.hpp"
+#include "kernel/support/popcap/resource_stream_group/unpack.hpp"
+#include "kernel/support/popcap/resource_stream_bundle/unpack.hpp"
+
+namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous
+{
+    using namespace Definition;
+
+    /**
+     * Random access to the resources of an RSB without unpacking it
+     * Only the bundle information section and the information section of each packet are parsed,
+     * a resource is looked up by its posix path, case-insensitive
+     */
+
+    class RsbIndex
+    {
+    public:
+        struct Packet
+        {
+            std::string id;
+            size_t offset;
+            ResourceStreamGroup::Common::HeaderInformaiton header;
+            ResourceStreamGroup::Common::PacketCompression compression;
+        };
+
+        struct Location
+        {
+            size_t packet;
+            bool is_texture;
+            size_t offset;
+            size_t size;
+        };
+
+    protected:
+        inline static constexpr auto k_information_section_size_offset = 0x0C_size;
+
+        std::unique_ptr<FileSystem::MappedFile> file{};
+
+        std::span<uint8_t const> source{};
+
+        std::vector<Packet> packet{};
+
+        std::vector<std::string> resource_path{};
+
+        std::unordered_map<std::string, Location> resource{};
+
+        inline static auto make_key(
+            std::string_view path) -> std::string
+        {
+            return tolower_back(String::to_posix_style(std::string{path}));
+        }
+
+        inline auto view(
+            size_t offset,
+            size_t size) const -> std::span<uint8_t const>
+        {
+            assert_conditional(offset <= thiz.source.size() && size <= thiz.source.size() - offset, fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "view");
+            return thiz.source.subspan(offset, size);
+        }
+
+        // only the information sections are copied, packet data is always read from the source view
+
+        inline auto read_information(
+            DataStreamView &stream,
+            size_t offset,
+            size_t size) const -> void
+        {
+            stream.write_cursor(size).writeBytes(thiz.view(offset, size));
+            stream.read_pos = k_begin_index;
+            return;
+        }
+
+        inline auto load_packet(
+            Common::BasicSubgroupInformation const &subgroup_information) -> void
+        {
+            auto stream = DataStreamView{};
+            thiz.read_information(stream, static_cast<size_t>(subgroup_information.offset), static_cast<size_t>(subgroup_information.information_section_size));
+            auto &packet_information = thiz.packet.emplace_back(Packet{
+                .id = subgroup_information.id,
+                .offset = static_cast<size_t>(subgroup_information.offset),
+                .header = ResourceStreamGroup::Common::HeaderInformaiton{},
+                .compression = ResourceStreamGroup::Common::PacketCompression{}});
+            ResourceStreamGroup::Common::exchange_header(stream, packet_information.header);
+            assert_conditional(packet_information.header.magic == ResourceStreamGroup::Common::k_magic_identifier, fmt::format("{}", Language::get("popcap.rsg.unpack.invalid_rsg_magic")), "load_packet");
+            ResourceStreamGroup::Common::packet_compression_from_data(packet_information.header.resource_data_section_compression, packet_information.compression);
+            auto resource_information_structure = std::map<std::string, ResourceStreamGroup::Common::ResourceInformation>{};
+            CompiledMapData::decode(stream, packet_information.header.resource_information_section_offset, packet_information.header.resource_information_section_size, resource_information_structure, &ResourceStreamGroup::Common::exchange_to_resource_infomation);
+            for (auto &[path, resource_information] : resource_information_structure)
+            {
+                auto location = Location{
+                    .packet = thiz.packet.size() - 1_size,
+                    .is_texture = resource_information.read_texture_additional,
+                    .offset = static_cast<size_t>(resource_information.resource_data_section_offset),
+                    .size = static_cast<size_t>(resource_information.resource_data_section_size)};
+                if (thiz.resource.emplace(make_key(path), location).second)
+                {
+                    thiz.resource_path.emplace_back(String::to_posix_style(path));
+                }
+            }
+            return;
+        }
+
+        // the data section holding location, a compressed section is inflated into buffer up to size
+
+        inline auto read_section(
+            Location const &location,
+            size_t size,
+            std::vector<uint8_t> &buffer) const -> std::span<uint8_t const>
+        {
+            auto &packet_information = thiz.packet[location.packet];
+            auto &header = packet_information.header;
+            auto section_offset = static_cast<size_t>(location.is_texture ? header.texture_resource_data_section_offset : header.general_resource_data_section_offset);
+            auto section_size = static_cast<size_t>(location.is_texture ? header.texture_resource_data_section_size : header.general_resource_data_section_size);
+            auto is_compressed = location.is_texture ? packet_information.compression.texture : packet_information.compression.general;
+            auto section = thiz.view(packet_information.offset + section_offset, section_size);
+            if (!is_compressed)
+            {
+                return section;
+            }
+            buffer.resize(size);
+            auto inflate = Definition::Compression::Zlib::Inflate{std::span<uint8_t>{buffer}};
+            inflate.update(section);
+            assert_conditional(inflate.size() == buffer.size(), fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "read_section");
+            return buffer;
+        }
+
+        inline static auto read_resource(
+            std::span<uint8_t const> section,
+            Location const &location) -> std::span<uint8_t const>
+        {
+            assert_conditional(location.offset <= section.size() && location.size <= section.size() - location.offset, fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "read_resource");
+            return section.subspan(location.offset, location.size);
+        }
+
+        inline auto load(
+        ) -> void
+        {
+            auto information_section_size = uint32_t{};
+            std::memcpy(&information_section_size, thiz.view(k_information_section_size_offset, sizeof(uint32_t)).data(), sizeof(uint32_t));
+            auto stream = DataStreamView{};
+            thiz.read_information(stream, k_begin_index, static_cast<size_t>(information_section_size));
+            auto header = Common::HeaderInformaiton{};
+            Common::exchange_to_header(stream, header);
+            assert_conditional(header.magic == Common::k_magic_identifier, fmt::format("{}", Language::get("popcap.rsb.unpack.invalid_rsb_magic")), "load");
+            auto index = std::find(Common::k_version_list.begin(), Common::k_version_list.end(), static_cast<int>(header.version));
+            assert_conditional((index != Common::k_version_list.end()), String::format(fmt::format("{}", Language::get("popcap.rsb.invalid_rsb_version")), std::to_string(static_cast<int>(header.version))), "load");
+            auto subgroup_information = std::vector<Common::BasicSubgroupInformation>{};
+            stream.read_pos = header.subgroup_information_section_offset;
+            if (header.version == 1_ui)
+            {
+                exchange_list(stream, subgroup_information, &Common::exchange_to_basic_subgroup<1_ui>, static_cast<size_t>(header.subgroup_information_section_block_count));
+            }
+            else
+            {
+                exchange_list(stream, subgroup_information, &Common::exchange_to_basic_subgroup<3_ui>, static_cast<size_t>(header.subgroup_information_section_block_count));
+            }
+            thiz.packet.reserve(subgroup_information.size());
+            for (auto &element : subgroup_information)
+            {
+                thiz.load_packet(element);
+            }
+            return;
+        }
+
+    public:
+        /**
+         * source: the bundle, must outlive the index
+         */
+
+        explicit RsbIndex(
+            std::span<uint8_t const> source) : source(source)
+        {
+            thiz.load();
+        }
+
+        /**
+         * source: the bundle file, mapped for the lifetime of the index
+         */
+
+        explicit RsbIndex(
+            std::string_view source) : file(std::make_unique<FileSystem::MappedFile>(source))
+        {
+            thiz.source = thiz.file->view();
+            thiz.load();
+        }
+
+        RsbIndex(
+            RsbIndex const &that) = delete;
+
+        auto operator=(
+            RsbIndex const &that) -> RsbIndex & = delete;
+
+        ~RsbIndex() = default;
+
+        inline auto contains(
+            std::string_view path) const -> bool
+        {
+            return thiz.resource.contains(make_key(path));
+        }
+
+        inline auto find(
+            std::string_view path) const -> std::optional<Location>
+        {
+            if (auto it = thiz.resource.find(make_key(path)); it != thiz.resource.end())
+            {
+                return it->second;
+            }
+            return std::nullopt;
+        }
+
+        inline auto packet_list(
+        ) const -> std::vector<Packet> const &
+        {
+            return thiz.packet;
+        }
+
+        // resource paths in bundle order, posix style
+
+        inline auto list(
+        ) const -> std::vector<std::string> const &
+        {
+            return thiz.resource_path;
+        }
+
+        /**
+         * Only the section holding the resource is touched,
+         * a compressed section is inflated up to the end of the resource
+         * path: resource path, case-insensitive
+         * return: the resource data
+         */
+
+        inline auto extract(
+            std::string_view path) const -> std::vector<uint8_t>
+        {
+            auto location = thiz.find(path);
+            assert_conditional(location.has_value(), String::format(fmt::format("{}", Language::get("popcap.rsb.index.cannot_find_resource")), std::string{path}), "extract");
+            auto buffer = std::vector<uint8_t>{};
+            auto data = read_resource(thiz.read_section(location.value(), location->offset + location->size, buffer), location.value());
+            return std::vector<uint8_t>{data.begin(), data.end()};
+        }
+
+        /**
+         * Resources sharing a section are read together, so a compressed section is inflated once
+         * resource: resource paths, case-insensitive
+         * callback: (index in resource, resource data), the data is only valid during the call
+         */
+
+        template <typename Callback>
+        inline auto extract_each(
+            std::vector<std::string> const &resource,
+            Callback &&callback) const -> void
+        {
+            auto location = std::vector<Location>{};
+            location.reserve(resource.size());
+            for (auto &path : resource)
+            {
+                auto current = thiz.find(path);
+                assert_conditional(current.has_value(), String::format(fmt::format("{}", Language::get("popcap.rsb.index.cannot_find_resource")), path), "extract_each");
+                location.emplace_back(current.value());
+            }
+            auto order = std::vector<size_t>(resource.size());
+            std::iota(order.begin(), order.end(), k_begin_index);
+            std::stable_sort(order.begin(), order.end(), [&](size_t left, size_t right)
+                             { return std::tie(location[left].packet, location[left].is_texture) < std::tie(location[right].packet, location[right].is_texture); });
+            auto buffer = std::vector<uint8_t>{};
+            for (auto begin = k_begin_index; begin < order.size();)
+            {
+                auto &first = location[order[begin]];
+                auto end = begin;
+                auto size = k_none_size;
+                while (end < order.size() && location[order[end]].packet == first.packet && location[order[end]].is_texture == first.is_texture)
+                {
+                    size = std::max(size, location[order[end]].offset + location[order[end]].size);
+                    ++end;
+                }
+                auto section = thiz.read_section(first, size, buffer);
+                for (auto current = begin; current < end; ++current)
+                {
+                    callback(order[current], read_resource(section, location[order[current]]));
+                }
+                begin = end;
+            }
+            return;
+        }
+
+        /**
+         * resource: resource paths, case-insensitive
+         * return: the data of each resource, in the order of resource
+         */
+
+        inline auto extract_list(
+            std::vector<std::string> const &resource) const -> std::vector<std::vector<uint8_t>>
+        {
+            auto result = std::vector<std::vector<uint8_t>>(resource.size());
+            thiz.extract_each(resource, [&](size_t index, std::span<uint8_t const> data)
+                              { result[index].assign(data.begin(), data.end()); });
+            return result;
+        }
+
+        /**
+         * source: the bundle file
+         * resource: resource paths to extract
+         * destination: each resource is written to destination/path
+         */
+
+        inline static auto extract_fs(
+            std::string_view source,
+            std::vector<std::string> const &resource,
+            std::string_view destination) -> void
+        {
+            auto index = RsbIndex{source};
+            index.extract_each(resource, [&](size_t current, std::span<uint8_t const> data)
+                               {
+                auto resource_destination = fmt::format("{}/{}", destination, String::to_posix_style(resource[current]));
+                FileSystem::create_directory(Path::getParents(resource_destination));
+                FileSystem::write_binary(resource_destination, data); });
+            return;
+        }
+
+        /**
+         * source: the bundle file
+         * return: every resource path in the bundle
+         */
+
+        inline static auto list_fs(
+            std::string_view source) -> std::vector<std::string>
+        {
+            auto index = RsbIndex{source};
+            return index.list();
+        }
+    };
+}
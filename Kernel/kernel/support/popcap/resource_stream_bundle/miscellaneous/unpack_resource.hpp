@@ -12,12 +12,14 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous
     {
     protected:
         inline static auto exchange_packet(
-            std::vector<uint8_t> const &packet_data,
-            std::string destination) -> void
+            std::span<uint8_t const> packet_data,
+            std::string const &destination) -> void
         {
-            auto packet_stream = DataStreamView{packet_data};
+            auto packet_stream = DataStreamView{};
+            packet_stream.write_cursor(packet_data.size()).writeBytes(packet_data);
             auto packet_definition = ResourceStreamGroup::PacketStructure{};
-            ResourceStreamGroup::Unpack::process_whole(packet_stream, packet_definition, destination);
+            auto packet_destination = destination;
+            ResourceStreamGroup::Unpack::process_whole(packet_stream, packet_definition, packet_destination);
             return;
         }
 
@@ -27,15 +29,21 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous
             ManifestStructure &manifest,
             std::string &destination) -> void
         {
-            auto packet_data_section_view_stored = std::map<std::string, std::vector<uint8_t>>{};
+            auto packet_data_section_view_stored = std::map<std::string, std::span<uint8_t const>>{};
             ResourceStreamBundle::Unpack::process_whole(stream, definition, manifest, packet_data_section_view_stored);
-            auto packet_definition = ResourceStreamGroup::PacketStructure{};
-            auto work_list = std::vector<std::future<void>>{};
-            for (auto const &it : packet_data_section_view_stored)
+            auto packet_list = std::vector<std::span<uint8_t const>>{};
+            packet_list.reserve(packet_data_section_view_stored.size());
+            for (auto &[subgroup_id, packet_data] : packet_data_section_view_stored)
             {
-                work_list.emplace_back(std::async(&exchange_packet, it.second, destination));
+                packet_list.emplace_back(packet_data);
             }
-            async_process_list<void>(work_list);
+            process_in_order_bounded(
+                packet_list.size(),
+                [&](size_t index)
+                { return packet_list[index].size(); },
+                [&](size_t index)
+                { exchange_packet(packet_list[index], destination); },
+                [](size_t) {});
             return;
         }
 
@@ -387,6 +387,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
             std::string_view destination) -> void
         {
             auto stream = DataStreamView{};
+            stream.use_write_buffer();
             BundleStructure definition = *FileSystem::read_json(fmt::format("{}/data.json", source));
             auto manifest = ManifestStructure{};
             if (definition.version <= 3_ui) {
@@ -36,12 +36,20 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
             manifest.manifest_has = true;
             auto group_manifest_information_data_stream = DataStreamView{stream.getBytes(static_cast<size_t>(header_structure.group_manifest_information_section_offset), static_cast<size_t>(header_structure.resource_manifest_information_section_offset))};
             auto resource_manifest_information_data_stream = DataStreamView{stream.getBytes(static_cast<size_t>(header_structure.resource_manifest_information_section_offset), static_cast<size_t>(header_structure.string_manifest_information_section_offset))};
-            auto string_manifest_information_data_stream = DataStreamView{stream.getBytes(static_cast<size_t>(header_structure.string_manifest_information_section_offset), static_cast<size_t>(header_structure.information_section_size))};
+            auto string_manifest_information_section_offset = static_cast<size_t>(header_structure.string_manifest_information_section_offset);
+            auto information_section_size = static_cast<size_t>(header_structure.information_section_size);
+            assert_conditional(string_manifest_information_section_offset <= information_section_size && information_section_size <= stream.size(), fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "process_package_manifest");
+            // a string must end inside the string section, never in the packet data after it
+            auto string_manifest_information_section = stream.data_view().subspan(string_manifest_information_section_offset, information_section_size - string_manifest_information_section_offset);
             auto get_string = [&](
                                   uint32_t const &offset) -> std::string
             {
-                string_manifest_information_data_stream.read_pos = static_cast<size_t>(offset);
-                return string_manifest_information_data_stream.readStringByEmpty();
+                auto string_offset = static_cast<size_t>(offset);
+                assert_conditional(string_offset < string_manifest_information_section.size(), fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "process_package_manifest");
+                auto begin = reinterpret_cast<char const *>(string_manifest_information_section.data() + string_offset);
+                auto terminator = static_cast<char const *>(std::memchr(begin, 0, string_manifest_information_section.size() - string_offset));
+                assert_conditional(terminator != nullptr, fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "process_package_manifest");
+                return std::string{begin, terminator};
             };
             while (group_manifest_information_data_stream.read_pos < group_manifest_information_data_stream.size())
             {
@@ -102,7 +110,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
 
     protected:
         template <auto unpack_for_work, typename Args>
-           requires std::is_same<Args, std::map<std::string, std::vector<uint8_t>>>::value || std::is_same<Args, std::string_view>::value
+           requires std::is_same<Args, std::map<std::string, std::vector<uint8_t>>>::value || std::is_same<Args, std::map<std::string, std::span<uint8_t const>>>::value || std::is_same<Args, std::string_view>::value
         inline static auto process_package(
             DataStreamView &stream,
             BundleStructure &definition,
@@ -200,8 +208,23 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
                     auto texture_resource_count = basic_subgroup_information.texture_resource_count;
                     assert_conditional(pool_information.texture_resource_begin == 0_ui, fmt::format("{}", Language::get("popcap.rsb.invalid_texture_resource")), "process_package");
                     assert_conditional(pool_information.texture_resource_count == 0_ui, fmt::format("{}", Language::get("popcap.rsb.invalid_texture_resource")), "process_package");
-                    auto packet_data = stream.getBytes(basic_subgroup_information.offset, basic_subgroup_information.offset + basic_subgroup_information.size);
-                    auto packet_stream = DataStreamView{packet_data};
+                    auto packet_offset = static_cast<size_t>(basic_subgroup_information.offset);
+                    auto packet_size = static_cast<size_t>(basic_subgroup_information.size);
+                    assert_conditional(packet_offset <= stream.size() && packet_size <= stream.size() - packet_offset, fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "process_package");
+                    auto packet_view = stream.data_view().subspan(packet_offset, packet_size);
+                    auto packet_stream = DataStreamView{};
+                    if constexpr (std::is_same<Args, std::map<std::string, std::span<uint8_t const>>>::value)
+                    {
+                        // only the information section is read to get the packet structure, the packet stays a view of the bundle
+                        auto information_section_size = static_cast<size_t>(basic_subgroup_information.information_section_size);
+                        assert_conditional(information_section_size <= packet_view.size(), fmt::format("{}", Language::get("offset_outside_bounds_of_data_stream")), "process_package");
+                        packet_stream.write_cursor(information_section_size).writeBytes(packet_view.first(information_section_size));
+                    }
+                    else
+                    {
+                        packet_stream.write_cursor(packet_view.size()).writeBytes(packet_view);
+                    }
+                    packet_stream.read_pos = k_begin_index;
                     auto packet_structure = PacketStructure{};
                     auto get_packet_structure_only = true;
                     ResourceStreamGroup::Unpack::process_whole(packet_stream, packet_structure, get_packet_structure_only);
@@ -227,14 +250,18 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
                     group_information.subgroup[subgroup_id] = subgroup_information;
                     if constexpr (std::is_same<Args, std::map<std::string, std::vector<uint8_t>>>::value)
                     {
-                        args[subgroup_id] = std::move(packet_data);
+                        args[subgroup_id] = packet_stream.toBytes();
+                    }
+                    if constexpr (std::is_same<Args, std::map<std::string, std::span<uint8_t const>>>::value)
+                    {
+                        args[subgroup_id] = packet_view;
                     }
                     if constexpr (std::is_same<Args, std::string_view>::value)
                     {
                         #if WINDOWS 
-                        async_work_process.emplace_back(std::async(&write_bytes, fmt::format("{}/packet/{}.rsg", args, subgroup_id), packet_data));
+                        async_work_process.emplace_back(std::async(&write_bytes, fmt::format("{}/packet/{}.rsg", args, subgroup_id), packet_stream.toBytes()));
                         #else
-                        write_bytes(fmt::format("{}/packet/{}.rsg", args, subgroup_id), packet_data);
+                        write_bytes(fmt::format("{}/packet/{}.rsg", args, subgroup_id), packet_stream.toBytes());
                         #endif
                     }
                 }
@@ -248,7 +275,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
 
     public:
         template <auto unpack_for_work = false, typename Args>
-            requires std::is_same<Args, std::map<std::string, std::vector<uint8_t>>>::value || std::is_same<Args, std::string_view>::value
+            requires std::is_same<Args, std::map<std::string, std::vector<uint8_t>>>::value || std::is_same<Args, std::map<std::string, std::span<uint8_t const>>>::value || std::is_same<Args, std::string_view>::value
         inline static auto process_whole(
             DataStreamView &stream,
             BundleStructure &definition,
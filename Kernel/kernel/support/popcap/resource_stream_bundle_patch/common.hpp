@@ -1,6 +1,7 @@
 #pragma once
 
 #include "kernel/definition/utility.hpp"
+#include "kernel/support/miscellaneous/shared.hpp"
 #include "kernel/support/popcap/resource_stream_bundle/definition.hpp"
 #include "kernel/support/popcap/resource_stream_bundle/unpack.hpp"
 
@@ -8,6 +9,8 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundlePatch
 {
     using namespace Definition;
 
+    using namespace Sen::Kernel::Support::Miscellaneous::Shared;
+
     struct Common
     {
         inline static constexpr auto k_magic_identifier = uint32_t{0x52534250};
@@ -135,6 +138,15 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundlePatch
             return;
         }
 
+        inline static auto packet_view(
+            DataStreamView &stream,
+            size_t offset,
+            size_t size) -> std::span<uint8_t const>
+        {
+            assert_conditional(offset <= stream.size() && size <= stream.size() - offset, fmt::format("{}, {}: {}, {}: {}", Language::get("buffer.read_offset_outside_bounds_of_dataview"), Language::get("buffer.new_position"), offset + size, Language::get("buffer.actual_size"), stream.size()), "packet_view");
+            return stream.data_view().subspan(offset, size);
+        }
+
         inline static auto read_package_information_structure(
             DataStreamView &stream,
             ResourceStreamBundle::Common::Information &value) -> void
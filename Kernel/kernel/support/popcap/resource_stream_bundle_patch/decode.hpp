@@ -14,8 +14,15 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundlePatch
     struct Decode : Common
     {
     protected:
+        struct PacketTask
+        {
+            PacketInformation information;
+            std::span<uint8_t const> before;
+            std::span<uint8_t const> patch;
+        };
+
         inline static auto test_hash(
-            std::vector<uint8_t> const &data,
+            std::span<uint8_t const> data,
             std::string const &hash) -> void
         {
             auto hash_test = Encryption::MD5::hash(data);
@@ -24,15 +31,13 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundlePatch
         }
 
         inline static auto process_sub(
-            std::vector<uint8_t> const &before,
-            DataStreamView &stream_patch,
-            DataStreamView &stream_after,
-            size_t const &patch_size
-        ) -> void
+            std::span<uint8_t const> before,
+            std::span<uint8_t const> patch) -> std::vector<uint8_t>
         {
-            auto patch = stream_patch.readBytes(patch_size);
-            stream_after.writeBytes(Diff::VCDiff::decode<std::size_t>(reinterpret_cast<char const *>(before.data()), before.size(), reinterpret_cast<char const *>(patch.data()), patch.size()));
-            return;
+            auto after = std::vector<uint8_t>{};
+            auto output = Diff::VCDiff::VectorOutput{after};
+            Diff::VCDiff::decode(before, patch, output);
+            return after;
         }
 
         inline static auto process(
@@ -50,41 +55,62 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundlePatch
             auto information_section_before_structure = ResourceStreamBundle::Common::Information{};
             auto information_section_after_structure = ResourceStreamBundle::Common::Information{};
             read_package_information_structure(stream_before, information_section_before_structure);
-            auto information_section_before = stream_before.getBytes(k_begin_index, static_cast<size_t>(information_section_before_structure.header.information_section_size));
+            auto information_section_before = packet_view(stream_before, k_begin_index, static_cast<size_t>(information_section_before_structure.header.information_section_size));
             test_hash(information_section_before, package_information.before_hash);
             if (!information_section_patch_exist)
             {
-                stream_after.writeBytes(information_section_before);
+                stream_after.write_cursor(information_section_before.size()).writeBytes(information_section_before);
             }
             else {
-                process_sub(information_section_before, stream_patch, stream_after, information_section_patch_size);
+                auto information_section_patch = packet_view(stream_patch, stream_patch.read_pos, information_section_patch_size);
+                stream_patch.read_pos += information_section_patch_size;
+                auto output = Diff::VCDiff::StreamOutput{stream_after};
+                Diff::VCDiff::decode(information_section_before, information_section_patch, output);
             }
             read_package_information_structure(stream_after, information_section_after_structure);
             assert_conditional(packet_count == information_section_after_structure.subgroup_information.size(), fmt::format("{}", Language::get("popcap.rsb_patch.invalid_packet_count")), "process");
             auto packet_before_subgroup_information_index_map = std::map<std::string, size_t>{};
             indexing_subgroup_information_by_id(information_section_before_structure.subgroup_information, packet_before_subgroup_information_index_map);
+            // packet headers are interleaved with the patch data, so they are located first
+            auto packet_task_list = std::vector<PacketTask>(packet_count);
             for (auto packet_index : Range(packet_count)) {
                 auto & packet_after_subgroup_information = information_section_after_structure.subgroup_information.at(packet_index);
-                auto packet_information = PacketInformation{};
-                exchange_packet_information(stream_patch, packet_information);
-                auto packet_name = packet_after_subgroup_information.id;
-                auto packet_patch_exist = static_cast<bool>(packet_information.patch_exist);
-                auto packet_patch_size = static_cast<size_t>(packet_information.patch_size);
-                auto packet_before = std::vector<uint8_t>{};
-                if (packet_before_subgroup_information_index_map.contains(packet_name)) {
-                    auto packet_before_subgroup_information_index = packet_before_subgroup_information_index_map[packet_name];
-                    auto packet_before_subgroup_information = information_section_before_structure.subgroup_information.at(packet_before_subgroup_information_index);
-                    packet_before = stream_before.getBytes(static_cast<size_t>(packet_before_subgroup_information.offset), static_cast<size_t>(packet_before_subgroup_information.offset + packet_before_subgroup_information.size));
-                }
-                test_hash(packet_before, packet_information.before_hash);
-                if (!packet_patch_exist) {
+                auto & packet_task = packet_task_list[packet_index];
+                exchange_packet_information(stream_patch, packet_task.information);
+                auto packet_patch_size = static_cast<size_t>(packet_task.information.patch_size);
+                if (!static_cast<bool>(packet_task.information.patch_exist)) {
                     assert_conditional(packet_patch_size == k_none_size, fmt::format("{}", Language::get("popcap.rsb_patch.invalid_packet_patch_size")), "process");
-                    stream_after.writeBytes(packet_before);
                 }
                 else {
-                    process_sub(packet_before, stream_patch, stream_after, packet_patch_size);
+                    packet_task.patch = packet_view(stream_patch, stream_patch.read_pos, packet_patch_size);
+                    stream_patch.read_pos += packet_patch_size;
+                }
+                if (auto packet_before_subgroup_information_index = packet_before_subgroup_information_index_map.find(packet_after_subgroup_information.id); packet_before_subgroup_information_index != packet_before_subgroup_information_index_map.end()) {
+                    auto & packet_before_subgroup_information = information_section_before_structure.subgroup_information.at(packet_before_subgroup_information_index->second);
+                    packet_task.before = packet_view(stream_before, static_cast<size_t>(packet_before_subgroup_information.offset), static_cast<size_t>(packet_before_subgroup_information.size));
                 }
             }
+            process_in_order_bounded(packet_count,
+                [&](size_t packet_index) {
+                    return packet_task_list[packet_index].before.size() + packet_task_list[packet_index].patch.size();
+                },
+                [&](size_t packet_index) -> std::vector<uint8_t> {
+                    auto & packet_task = packet_task_list[packet_index];
+                    test_hash(packet_task.before, packet_task.information.before_hash);
+                    if (!static_cast<bool>(packet_task.information.patch_exist)) {
+                        return std::vector<uint8_t>{};
+                    }
+                    return process_sub(packet_task.before, packet_task.patch);
+                },
+                [&](size_t packet_index, std::vector<uint8_t> &&packet_after) -> void {
+                    auto & packet_task = packet_task_list[packet_index];
+                    if (!static_cast<bool>(packet_task.information.patch_exist)) {
+                        stream_after.write_cursor(packet_task.before.size()).writeBytes(packet_task.before);
+                    }
+                    else {
+                        stream_after.writeBytes(packet_after);
+                    }
+                });
             return;
         }
 
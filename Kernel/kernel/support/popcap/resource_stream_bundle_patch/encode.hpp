@@ -12,8 +12,20 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundlePatch
     struct Encode : Common
     {
     protected:
+        struct PacketTask
+        {
+            std::span<uint8_t const> before;
+            std::span<uint8_t const> after;
+        };
+
+        struct PacketResult
+        {
+            std::string before_hash;
+            std::optional<std::vector<uint8_t>> patch;
+        };
+
         inline static auto test_hash(
-            std::vector<uint8_t> const &data,
+            std::span<uint8_t const> data,
             std::string &hash
         ) -> void
         {
@@ -22,13 +34,27 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundlePatch
         }
 
         inline static auto process_sub(
-            std::vector<uint8_t> const &before_data,
-            std::vector<uint8_t> const &after_data
+            std::span<uint8_t const> before_data,
+            std::span<uint8_t const> after_data
         ) -> std::vector<uint8_t>
         {
-            return Diff::VCDiff::encode<std::size_t, Diff::VCDiff::Flag::VCD_FORMAT_INTERLEAVED>(
-                    reinterpret_cast<char const *>(before_data.data()), before_data.size(),
-                    reinterpret_cast<char const *>(after_data.data()), after_data.size());
+            auto patch = std::vector<uint8_t>{};
+            auto output = Diff::VCDiff::VectorOutput{patch};
+            Diff::VCDiff::encode<Diff::VCDiff::Flag::VCD_FORMAT_INTERLEAVED>(before_data, after_data, output);
+            return patch;
+        }
+
+        // nullopt when the packet is unchanged
+
+        inline static auto process_packet(
+            std::span<uint8_t const> before_data,
+            std::span<uint8_t const> after_data
+        ) -> std::optional<std::vector<uint8_t>>
+        {
+            if (std::ranges::equal(before_data, after_data)) {
+                return std::nullopt;
+            }
+            return process_sub(before_data, after_data);
         }
 
         inline static auto process(
@@ -42,17 +68,17 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundlePatch
             auto information_section_after_structure = ResourceStreamBundle::Common::Information{};
             read_package_information_structure(stream_before, information_section_before_structure);
             read_package_information_structure(stream_after, information_section_after_structure);
-            auto information_section_before = stream_before.getBytes(k_begin_index, static_cast<size_t>(information_section_before_structure.header.information_section_size));
-            auto information_section_after = stream_after.getBytes(k_begin_index, static_cast<size_t>(information_section_after_structure.header.information_section_size));
+            auto information_section_before = packet_view(stream_before, k_begin_index, static_cast<size_t>(information_section_before_structure.header.information_section_size));
+            auto information_section_after = packet_view(stream_after, k_begin_index, static_cast<size_t>(information_section_after_structure.header.information_section_size));
             test_hash(information_section_before, package_information.before_hash);
             auto information_section_patch_exist = false;
             auto information_section_patch_size = k_none_size;
             stream_patch.writeNull(information_header_section_size);
-            information_section_patch_exist = information_section_after != information_section_before;
+            auto information_section_patch = process_packet(information_section_before, information_section_after);
+            information_section_patch_exist = information_section_patch.has_value();
             if (information_section_patch_exist) {
-                auto vcdiff_data = process_sub(information_section_before, information_section_after);
-                information_section_patch_size = vcdiff_data.size();
-                stream_patch.writeBytes(vcdiff_data);
+                information_section_patch_size = information_section_patch->size();
+                stream_patch.writeBytes(information_section_patch.value());
             }
             package_information.patch_exist = static_cast<uint32_t>(information_section_patch_exist);
             package_information.patch_size = static_cast<uint32_t>(information_section_patch_size);
@@ -60,31 +86,49 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundlePatch
             indexing_subgroup_information_by_id(information_section_before_structure.subgroup_information, packet_before_subgroup_information_index_map);
             auto packet_count = information_section_after_structure.header.subgroup_information_section_block_count;
             package_information.packet_count = packet_count;
-            for (auto packet_index : Range<size_t>(packet_count)) {
+            auto packet_task_list = std::vector<PacketTask>(static_cast<size_t>(packet_count));
+            for (auto packet_index : Range(static_cast<size_t>(packet_count))) {
                 auto & packet_after_subgroup_information = information_section_after_structure.subgroup_information.at(packet_index);
-                auto packet_information = PacketInformation{};
-                auto packet_patch_size = k_none_size;
-                auto packet_name = packet_after_subgroup_information.id;
-                auto packet_before = std::vector<uint8_t>{};
-                if (packet_before_subgroup_information_index_map.contains(packet_name)) {
-                    auto packet_before_subgroup_information_index = packet_before_subgroup_information_index_map[packet_name];
-                    auto & packet_before_subgroup_information = information_section_before_structure.subgroup_information.at(packet_before_subgroup_information_index);
-                    packet_before = stream_before.getBytes(static_cast<size_t>(packet_before_subgroup_information.offset), static_cast<size_t>(packet_before_subgroup_information.offset + packet_before_subgroup_information.size));
-                }
-                test_hash(packet_before, packet_information.before_hash);
-                auto packet_after = stream_after.getBytes(static_cast<size_t>(packet_after_subgroup_information.offset), static_cast<size_t>(packet_after_subgroup_information.offset + packet_after_subgroup_information.size));
-                auto packet_patch_exist = !((packet_before.size() == packet_after.size()) && std::equal(packet_before.begin(), packet_before.end(), packet_after.begin()));
-                packet_information.name = packet_name;
-                packet_information.patch_exist = static_cast<uint32_t>(packet_patch_exist);
-                packet_information.patch_size = static_cast<uint32_t>(packet_patch_size);
-                auto vcdiff_data = std::vector<uint8_t>{};
-                if (packet_patch_exist) {
-                    vcdiff_data = process_sub(packet_before, packet_after);
-                    packet_information.patch_size = vcdiff_data.size();
+                auto & packet_task = packet_task_list[packet_index];
+                if (auto packet_before_subgroup_information_index = packet_before_subgroup_information_index_map.find(packet_after_subgroup_information.id); packet_before_subgroup_information_index != packet_before_subgroup_information_index_map.end()) {
+                    auto & packet_before_subgroup_information = information_section_before_structure.subgroup_information.at(packet_before_subgroup_information_index->second);
+                    packet_task.before = packet_view(stream_before, static_cast<size_t>(packet_before_subgroup_information.offset), static_cast<size_t>(packet_before_subgroup_information.size));
                 }
-                exchange_packet_information(packet_information, stream_patch);
-                stream_patch.writeBytes(vcdiff_data);
+                packet_task.after = packet_view(stream_after, static_cast<size_t>(packet_after_subgroup_information.offset), static_cast<size_t>(packet_after_subgroup_information.size));
             }
+            // task 2 * i hashes packet i and task 2 * i + 1 diffs it, so the hash runs beside the diff
+            auto before_hash = std::string{};
+            process_in_order_bounded(packet_task_list.size() * 2,
+                [&](size_t task_index) {
+                    auto & packet_task = packet_task_list[task_index / 2];
+                    return task_index % 2 == 0 ? packet_task.before.size() : packet_task.before.size() + packet_task.after.size();
+                },
+                [&](size_t task_index) -> PacketResult {
+                    auto & packet_task = packet_task_list[task_index / 2];
+                    auto result = PacketResult{};
+                    if (task_index % 2 == 0) {
+                        test_hash(packet_task.before, result.before_hash);
+                    }
+                    else {
+                        result.patch = process_packet(packet_task.before, packet_task.after);
+                    }
+                    return result;
+                },
+                [&](size_t task_index, PacketResult &&result) -> void {
+                    if (task_index % 2 == 0) {
+                        before_hash = std::move(result.before_hash);
+                        return;
+                    }
+                    auto packet_information = PacketInformation{};
+                    packet_information.name = information_section_after_structure.subgroup_information.at(task_index / 2).id;
+                    packet_information.before_hash = std::move(before_hash);
+                    packet_information.patch_exist = static_cast<uint32_t>(result.patch.has_value());
+                    packet_information.patch_size = static_cast<uint32_t>(result.patch.has_value() ? result.patch->size() : k_none_size);
+                    exchange_packet_information(packet_information, stream_patch);
+                    if (result.patch.has_value()) {
+                        stream_patch.writeBytes(result.patch.value());
+                    }
+                });
             package_information.all_after_size = static_cast<uint32_t>(stream_after.size());
             package_information.packet_count = static_cast<uint32_t>(packet_count);
             package_information.patch_exist = static_cast<uint32_t>(information_section_patch_exist);
@@ -12,7 +12,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
     /*
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PacketCompression &nlohmann_json_t) -> void
     {
         nlohmann_json_j["general"] = nlohmann_json_t.general;
@@ -21,7 +21,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PacketCompression &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("general").get_to(nlohmann_json_t.general);
@@ -37,7 +37,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const GeneralResourceAdditional &nlohmann_json_t) -> void
     {
         nlohmann_json_j["type"] = Common::k_general_type_string;
@@ -45,7 +45,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         GeneralResourceAdditional &nlohmann_json_t) -> void
     {
         assert(nlohmann_json_j.at("type").get<std::string_view>() == Common::k_general_type_string);
@@ -67,7 +67,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const TextureDimension &nlohmann_json_t) -> void
     {
         nlohmann_json_j["width"] = nlohmann_json_t.width;
@@ -76,7 +76,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         TextureDimension &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("width").get_to(nlohmann_json_t.width);
@@ -93,7 +93,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const TextureValue &nlohmann_json_t) -> void
     {
         //nlohmann_json_j["index"] = nlohmann_json_t.index; 
@@ -126,7 +126,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         TextureValue &nlohmann_json_t) -> void
     {
         //nlohmann_json_j.at("index").get_to(nlohmann_json_t.index);
@@ -137,7 +137,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
             nlohmann_json_j.at("format").get_to(nlohmann_json_t.texture_infomation.format);
             texture_resource_information_section_block_size += size_t{4};
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
@@ -145,7 +145,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
             nlohmann_json_j.at("pitch").get_to(nlohmann_json_t.texture_infomation.pitch);
             texture_resource_information_section_block_size += size_t{4};
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
@@ -153,7 +153,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
             nlohmann_json_j.at("alpha_size").get_to(nlohmann_json_t.texture_infomation.alpha_size);
             texture_resource_information_section_block_size += size_t{4};
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
@@ -161,7 +161,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
             nlohmann_json_j.at("scale").get_to(nlohmann_json_t.texture_infomation.scale);
             texture_resource_information_section_block_size += size_t{4};
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         if (texture_resource_information_section_block_size != size_t{0}) {
@@ -178,7 +178,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
 
     /*
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const TextureResourceAdditional &nlohmann_json_t) -> void
     {
        // nlohmann_json_j["type"] = Common::k_texture_type_string;
@@ -187,7 +187,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         TextureResourceAdditional &nlohmann_json_t) -> void
     {
       //  assert(nlohmann_json_j.at("type").get<std::string_view>() == Common::k_texture_type_string);
@@ -205,7 +205,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Resource &nlohmann_json_t) -> void
     {
         nlohmann_json_j["path"] = nlohmann_json_t.path;
@@ -221,7 +221,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Resource &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("path").get_to(nlohmann_json_t.path);
@@ -230,7 +230,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
             nlohmann_json_j.at("additional").get_to(nlohmann_json_t.texture_additional.value);
             nlohmann_json_t.use_texture_additional_instead = true;
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         return;
@@ -244,7 +244,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PacketStructure &nlohmann_json_t) -> void
     {
         nlohmann_json_j["version"] = nlohmann_json_t.version;
@@ -256,7 +256,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PacketStructure &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("version").get_to(nlohmann_json_t.version);
@@ -12,6 +12,9 @@
 #include "kernel/support/popcap/resource_stream_bundle/miscellaneous/unpack_resource.hpp"
 #include "kernel/support/popcap/resource_stream_bundle/miscellaneous/pack_resource.hpp"
 #include "kernel/support/popcap/resource_stream_bundle/miscellaneous/unpack_cipher.hpp"
+#include "kernel/support/popcap/resource_stream_bundle/miscellaneous/rsb_index.hpp"
+#include "kernel/support/popcap/resource_stream_bundle/miscellaneous/obfuscate.hpp"
+#include "kernel/support/popcap/resource_stream_bundle/miscellaneous/convert_android_to_ios.hpp"
 #include "kernel/support/popcap/resource_stream_bundle/pack.hpp"
 #include "kernel/support/popcap/resource_stream_bundle/common.hpp"
 #include "kernel/support/popcap/resource_stream_group/definition.hpp"
@@ -21,6 +24,7 @@
 #include "kernel/support/popcap/reflection_object_notation/decode.hpp"
 #include "kernel/support/popcap/reflection_object_notation/encode.hpp"
 #include "kernel/support/popcap/reflection_object_notation/instance.hpp"
+#include "kernel/support/popcap/lawn_strings/convert.hpp"
 #include "kernel/support/popcap/new_type_object_notation/encode.hpp"
 #include "kernel/support/popcap/new_type_object_notation/decode.hpp"
 #include "kernel/support/popcap/compiled_text/decode.hpp"
@@ -166,6 +166,10 @@ namespace Sen::Kernel::Support::WWise::SoundBank
             return;
         }
 
+        inline static constexpr auto k_media_write_thread_count = 4_size;
+
+        // DATA is not copied, each wem is written from a view of the bank buffer on a small I/O pool
+
         inline static auto exchange_media(
             DataStreamView &stream,
             std::vector<uint32_t> &value,
@@ -182,11 +186,46 @@ namespace Sen::Kernel::Support::WWise::SoundBank
             auto data_sign = ChunkSign{};
             exchange_chuck_sign(stream, data_sign);
             assert_conditional(data_sign.id == ChunkSignFlag::data, fmt::format("{}", Kernel::Language::get("wwise.soundbank.decode.invalid_wem_data_bank")), "exchange_media");
-            auto data_stream = DataStreamView{stream.readBytes(static_cast<size_t>(data_sign.size))};
+            assert_conditional(stream.read_pos + static_cast<size_t>(data_sign.size) <= stream.size(), fmt::format("{}", Kernel::Language::get("offset_outside_bounds_of_data_stream")), "exchange_media");
+            auto data_view = stream.data_view().subspan(stream.read_pos, static_cast<size_t>(data_sign.size));
+            stream.read_pos += static_cast<size_t>(data_sign.size);
+            if (data_list.empty())
+            {
+                return;
+            }
+            FileSystem::create_directory(fmt::format("{}/media", destination));
+            auto thread_pool = ThreadPool{std::min(ThreadPool::default_thread_count(), k_media_write_thread_count)};
+            auto result = std::vector<std::future<void>>{};
+            result.reserve(data_list.size());
             for (auto data_index : Range(data_list.size()))
             {
-                auto data = data_stream.getBytes(data_list[data_index].pos, data_list[data_index].pos + data_list[data_index].size);
-                write_bytes(fmt::format("{}/media/{}.wem", destination, value.at(data_index)), data);
+                auto &data = data_list[data_index];
+                assert_conditional(static_cast<size_t>(data.pos) + static_cast<size_t>(data.size) <= data_view.size(), fmt::format("{}", Kernel::Language::get("offset_outside_bounds_of_data_stream")), "exchange_media");
+                auto media_view = data_view.subspan(static_cast<size_t>(data.pos), static_cast<size_t>(data.size));
+                auto media_path = fmt::format("{}/media/{}.wem", destination, value[data_index]);
+                result.emplace_back(thread_pool.enqueue([media_view, media_path = std::move(media_path)]() -> void {
+                    FileSystem::write_binary(media_path, media_view);
+                    return;
+                }));
+            }
+            for (auto &element : result)
+            {
+                element.get();
+            }
+            return;
+        }
+
+        inline static auto exchange_media_index(
+            DataStreamView &stream,
+            std::vector<MediaIndex> &value,
+            uint32_t const &chuck_size) -> void
+        {
+            value.resize(chuck_size / (3_size * k_block_size));
+            for (auto &element : value)
+            {
+                element.id = stream.readUint32();
+                element.offset = stream.readUint32();
+                element.size = stream.readUint32();
             }
             return;
         }
@@ -3779,6 +3818,46 @@ namespace Sen::Kernel::Support::WWise::SoundBank
             return;
         }
 
+        // only BKHD, DIDX and the DATA position are read, every other chunk (HIRC included) is skipped by its size
+
+        inline static auto exchange_sound_bank_index(
+            DataStreamView &stream,
+            SoundBankIndex &definition) -> void
+        {
+            auto bank_header_chunk_sign_flag = stream.readString(4_size);
+            assert_conditional(bank_header_chunk_sign_flag == ChunkSignFlag::bkhd, fmt::format("{}", Kernel::Language::get("wwise.soundbank.decode.invalid_bnk_magic")), "process_index");
+            stream.read_pos = k_begin_index;
+            auto data_position = std::optional<size_t>{};
+            while (stream.read_pos < stream.size())
+            {
+                auto sign_id = stream.readString(4_size);
+                auto sign_size = static_cast<size_t>(stream.readUint32());
+                auto sign_end = stream.read_pos + sign_size;
+                assert_conditional(sign_end <= stream.size(), fmt::format("{} | {}: {:02x}", Kernel::Language::get("wwise.decode.invalid_bnk"), Kernel::Language::get("offset"), stream.read_pos), "exchange_sound_bank_index");
+                if (sign_id == ChunkSignFlag::bkhd)
+                {
+                    exchange_bank_header(stream, definition.bank_header, static_cast<uint32_t>(sign_size));
+                }
+                else if (sign_id == ChunkSignFlag::didx)
+                {
+                    exchange_media_index(stream, definition.media, static_cast<uint32_t>(sign_size));
+                }
+                else if (sign_id == ChunkSignFlag::data)
+                {
+                    data_position = stream.read_pos;
+                }
+                stream.read_pos = sign_end;
+            }
+            if (data_position.has_value())
+            {
+                for (auto &element : definition.media)
+                {
+                    element.offset += static_cast<uint32_t>(data_position.value());
+                }
+            }
+            return;
+        }
+
     public:
         inline static auto process_whole(
             DataStreamView &stream,
@@ -3789,6 +3868,67 @@ namespace Sen::Kernel::Support::WWise::SoundBank
             return;
         }
 
+        inline static auto process_index(
+            DataStreamView &stream,
+            SoundBankIndex &definition) -> void
+        {
+            exchange_sound_bank_index(stream, definition);
+            return;
+        }
+
+        // only the BKHD and DIDX payloads are read from disk, the other chunks are seeked over
+
+        inline static auto process_index_fs(
+            std::string_view source,
+            std::string_view destination) -> void
+        {
+            #if WINDOWS
+            auto file = std::ifstream(String::utf8_to_utf16(fmt::format("\\\\?\\{}", String::to_windows_style(source.data()))).data(), std::ios::binary);
+            #else
+            auto file = std::ifstream(source.data(), std::ios::binary);
+            #endif
+            assert_conditional(file.is_open(), fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(source.data())), "process_index_fs");
+            file.seekg(0, std::ios::end);
+            auto file_size = static_cast<size_t>(file.tellg());
+            file.seekg(0, std::ios::beg);
+            auto stream = DataStreamView{};
+            auto data_position = std::optional<size_t>{};
+            auto position = k_begin_index;
+            while (position + 2_size * k_block_size <= file_size)
+            {
+                auto sign = std::vector<uint8_t>(2_size * k_block_size);
+                file.read(reinterpret_cast<char *>(sign.data()), static_cast<std::streamsize>(sign.size()));
+                auto sign_id = std::string_view{reinterpret_cast<char const *>(sign.data()), k_block_size};
+                auto sign_size = 0_ui;
+                std::memcpy(&sign_size, sign.data() + k_block_size, sizeof(uint32_t));
+                position += sign.size();
+                if (sign_id == ChunkSignFlag::bkhd || sign_id == ChunkSignFlag::didx)
+                {
+                    auto payload = std::vector<uint8_t>(std::min(static_cast<size_t>(sign_size), file_size - position));
+                    file.read(reinterpret_cast<char *>(payload.data()), static_cast<std::streamsize>(payload.size()));
+                    stream.writeBytes(sign);
+                    stream.writeBytes(payload);
+                }
+                else if (sign_id == ChunkSignFlag::data)
+                {
+                    data_position = position;
+                }
+                position += static_cast<size_t>(sign_size);
+                file.seekg(static_cast<std::streamoff>(position), std::ios::beg);
+            }
+            auto definition = SoundBankIndex{};
+            process_index(stream, definition);
+            if (data_position.has_value())
+            {
+                for (auto &element : definition.media)
+                {
+                    element.offset += static_cast<uint32_t>(data_position.value());
+                }
+            }
+            write_json(std::string{destination}, definition);
+            return;
+        }
+
         inline static auto process_fs(
             std::string_view source,
             std::string_view destination) -> void
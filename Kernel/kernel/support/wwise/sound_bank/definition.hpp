@@ -21,7 +21,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const HeadValue &nlohmann_json_t) -> void
     {
         nlohmann_json_j["values"] = nlohmann_json_t.values;
@@ -39,7 +39,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         HeadValue &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("values").get_to(nlohmann_json_t.values);
@@ -48,14 +48,14 @@ namespace Sen::Kernel::Support::WWise::SoundBank
         {
             nlohmann_json_j.at("soundbank_type").get_to(nlohmann_json_t.soundbank_type);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         try
         {
             nlohmann_json_j.at("bank_hash").get_to(nlohmann_json_t.bank_hash);
         }
-        catch (nlohmann::ordered_json::exception &e)
+        catch (ordered_json::exception &e)
         {
         }
         nlohmann_json_j.at("padding").get_to(nlohmann_json_t.padding);
@@ -71,7 +71,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const BankHeader &nlohmann_json_t) -> void
     {
         nlohmann_json_j["version"] = nlohmann_json_t.version;
@@ -83,7 +83,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         BankHeader &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("version").get_to(nlohmann_json_t.version);
@@ -500,7 +500,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioSwitcherSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["is_state"] = nlohmann_json_t.is_state;
@@ -511,7 +511,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioSwitcherSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("is_state").get_to(nlohmann_json_t.is_state);
@@ -536,7 +536,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioSourceSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["plug_in"] = nlohmann_json_t.plug_in;
@@ -554,7 +554,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioSourceSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("plug_in").get_to(nlohmann_json_t.plug_in);
@@ -581,7 +581,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Position &nlohmann_json_t) -> void
     {
         nlohmann_json_j["x"] = nlohmann_json_t.x;
@@ -594,7 +594,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Position &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("x").get_to(nlohmann_json_t.x);
@@ -615,7 +615,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Position2 &nlohmann_json_t) -> void
     {
         nlohmann_json_j["x"] = nlohmann_json_t.x;
@@ -624,7 +624,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Position2 &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("x").get_to(nlohmann_json_t.x);
@@ -641,7 +641,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Position2ID &nlohmann_json_t) -> void
     {
         nlohmann_json_j["x"] = nlohmann_json_t.x;
@@ -650,7 +650,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Position2ID &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("x").get_to(nlohmann_json_t.x);
@@ -667,7 +667,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const CoordinatePoint &nlohmann_json_t) -> void
     {
         nlohmann_json_j["position"] = nlohmann_json_t.position;
@@ -676,7 +676,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         CoordinatePoint &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("position").get_to(nlohmann_json_t.position);
@@ -693,7 +693,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const CoordinateIDPoint &nlohmann_json_t) -> void
     {
         nlohmann_json_j["position"] = nlohmann_json_t.position;
@@ -702,7 +702,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         CoordinateIDPoint &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("position").get_to(nlohmann_json_t.position);
@@ -720,7 +720,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTransitionSettingItemFade &nlohmann_json_t) -> void
     {
         nlohmann_json_j["time"] = nlohmann_json_t.time;
@@ -730,7 +730,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTransitionSettingItemFade &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("time").get_to(nlohmann_json_t.time);
@@ -749,7 +749,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTrackTransitionSettingItemSource &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -762,7 +762,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTrackTransitionSettingItemSource &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -782,7 +782,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTrackTransitionSettingItemDestination &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -793,7 +793,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTrackTransitionSettingItemDestination &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -813,7 +813,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTrackTransitionSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -826,7 +826,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTrackTransitionSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -848,7 +848,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTrackClipCurveItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["index"] = nlohmann_json_t.index;
@@ -858,7 +858,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTrackClipCurveItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("index").get_to(nlohmann_json_t.index);
@@ -881,7 +881,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTrackClipItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["u1"] = nlohmann_json_t.u1;
@@ -898,7 +898,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTrackClipItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("u1").get_to(nlohmann_json_t.u1);
@@ -924,7 +924,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTrackClip &nlohmann_json_t) -> void
     {
         nlohmann_json_j["u1"] = nlohmann_json_t.u1;
@@ -934,7 +934,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTrackClip &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("u1").get_to(nlohmann_json_t.u1);
@@ -954,7 +954,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTrackPlaybackSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["clip"] = nlohmann_json_t.clip;
@@ -968,7 +968,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTrackPlaybackSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("clip").get_to(nlohmann_json_t.clip);
@@ -989,7 +989,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTrackStream &nlohmann_json_t) -> void
     {
         nlohmann_json_j["look_ahead_time"] = nlohmann_json_t.look_ahead_time;
@@ -997,7 +997,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTrackStream &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("look_ahead_time").get_to(nlohmann_json_t.look_ahead_time);
@@ -1018,7 +1018,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     template <typename T>
         requires std::integral<T> or std::floating_point<T>
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const RandomizableValue<T> &nlohmann_json_t) -> void
     {
         nlohmann_json_j["value"] = nlohmann_json_t.value;
@@ -1030,7 +1030,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     template <typename T>
         requires std::integral<T> or std::floating_point<T>
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         RandomizableValue<T> &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("value").get_to(nlohmann_json_t.value);
@@ -1050,7 +1050,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const BusVoiceSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["volume"] = nlohmann_json_t.volume;
@@ -1064,7 +1064,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         BusVoiceSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("volume").get_to(nlohmann_json_t.volume);
@@ -1088,7 +1088,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioVoice &nlohmann_json_t) -> void
     {
         nlohmann_json_j["volume"] = nlohmann_json_t.volume;
@@ -1102,7 +1102,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioVoice &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("volume").get_to(nlohmann_json_t.volume);
@@ -1126,7 +1126,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioOutputBusSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["bus"] = nlohmann_json_t.bus;
@@ -1140,7 +1140,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioOutputBusSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("bus").get_to(nlohmann_json_t.bus);
@@ -1164,7 +1164,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioGameDefinedAuxiliarySendSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["enable"] = nlohmann_json_t.enable;
@@ -1178,7 +1178,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioGameDefinedAuxiliarySendSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("enable").get_to(nlohmann_json_t.enable);
@@ -1202,7 +1202,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioUserDefinedAuxiliarySendSettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["bus"] = nlohmann_json_t.bus;
@@ -1216,7 +1216,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioUserDefinedAuxiliarySendSettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("bus").get_to(nlohmann_json_t.bus);
@@ -1241,7 +1241,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioUserDefinedAuxiliarySendSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["enable"] = nlohmann_json_t.enable;
@@ -1253,7 +1253,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioUserDefinedAuxiliarySendSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("enable").get_to(nlohmann_json_t.enable);
@@ -1273,7 +1273,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioEarlyReflectionAuxiliarySendSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["bus"] = nlohmann_json_t.bus;
@@ -1282,7 +1282,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioEarlyReflectionAuxiliarySendSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("bus").get_to(nlohmann_json_t.bus);
@@ -1300,7 +1300,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioAuxiliarySendSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["game_defined"] = nlohmann_json_t.game_defined;
@@ -1313,7 +1313,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioAuxiliarySendSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("game_defined").get_to(nlohmann_json_t.game_defined);
@@ -1337,7 +1337,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioEffectSettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["index"] = nlohmann_json_t.index;
@@ -1355,7 +1355,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioEffectSettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("index").get_to(nlohmann_json_t.index);
@@ -1381,7 +1381,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioEffectSetting &nlohmann_json_t) -> void
     {
         if (k_version < 150_ui)
@@ -1397,7 +1397,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioEffectSetting &nlohmann_json_t) -> void
     {
         if (k_version < 150_ui)
@@ -1422,7 +1422,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioMetadataSettingItem &nlohmann_json_t) -> void
     {
         if (k_version >= 140_ui)
@@ -1436,7 +1436,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioMetadataSettingItem &nlohmann_json_t) -> void
     {
         if (k_version >= 140_ui)
@@ -1456,7 +1456,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioMetadataSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 140)
@@ -1467,7 +1467,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioMetadataSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 140_ui)
@@ -1487,7 +1487,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPositioningSettingSpeakerPanning &nlohmann_json_t) -> void
     {
         if (k_version < 132_ui)
@@ -1503,7 +1503,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPositioningSettingSpeakerPanning &nlohmann_json_t) -> void
     {
         if (k_version < 132_ui)
@@ -1527,7 +1527,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPositioningSettingListenerRoutingAttenuation &nlohmann_json_t) -> void
     {
         if (k_version >= 134_ui)
@@ -1539,7 +1539,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPositioningSettingListenerRoutingAttenuation &nlohmann_json_t) -> void
     {
         if (k_version >= 134_ui)
@@ -1559,7 +1559,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPositioningSettingListenerRoutingPositionSourceAutomationPoint &nlohmann_json_t) -> void
     {
         nlohmann_json_j["position"] = nlohmann_json_t.position;
@@ -1568,7 +1568,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPositioningSettingListenerRoutingPositionSourceAutomationPoint &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("position").get_to(nlohmann_json_t.position);
@@ -1583,7 +1583,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPositioningSettingListenerRoutingPositionSourceAutomationPathPoint &nlohmann_json_t) -> void
     {
         nlohmann_json_j["begin"] = nlohmann_json_t.begin;
@@ -1592,7 +1592,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPositioningSettingListenerRoutingPositionSourceAutomationPathPoint &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("begin").get_to(nlohmann_json_t.begin);
@@ -1608,7 +1608,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPositioningSettingListenerRoutingPositionSourceAutomationPathRandomRange &nlohmann_json_t) -> void
     {
         nlohmann_json_j["left_right"] = nlohmann_json_t.left_right;
@@ -1621,7 +1621,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPositioningSettingListenerRoutingPositionSourceAutomationPathRandomRange &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("left_right").get_to(nlohmann_json_t.left_right);
@@ -1642,7 +1642,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPositioningSettingListenerRoutingPositionSourceAutomationPath &nlohmann_json_t) -> void
     {
         nlohmann_json_j["point"] = nlohmann_json_t.point;
@@ -1651,7 +1651,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPositioningSettingListenerRoutingPositionSourceAutomationPath &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("point").get_to(nlohmann_json_t.point);
@@ -1673,7 +1673,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPositioningSettingListenerRoutingPositionSourceAutomation &nlohmann_json_t) -> void
     {
         nlohmann_json_j["play_type"] = magic_enum::enum_name(nlohmann_json_t.play_type);
@@ -1687,7 +1687,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPositioningSettingListenerRoutingPositionSourceAutomation &nlohmann_json_t) -> void
     {
         nlohmann_json_t.play_type = magic_enum_cast<AudioPlayType>(nlohmann_json_j.at("play_type").get<std::string>());
@@ -1713,7 +1713,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPositioningSettingListenerRoutingPositionSource &nlohmann_json_t) -> void
     {
         nlohmann_json_j["mode"] = magic_enum::enum_name(nlohmann_json_t.mode);
@@ -1735,7 +1735,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPositioningSettingListenerRoutingPositionSource &nlohmann_json_t) -> void
     {
         nlohmann_json_t.mode = magic_enum_cast<AudioPositioningSettingListenerRoutingPositionSourceMode>(nlohmann_json_j.at("mode").get<std::string>());
@@ -1769,7 +1769,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPositioningSettingListenerRouting &nlohmann_json_t) -> void
     {
         if (k_version < 128_ui)
@@ -1791,7 +1791,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPositioningSettingListenerRouting &nlohmann_json_t) -> void
     {
         if (k_version < 128_ui)
@@ -1824,7 +1824,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPositioningSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 125_ui && k_version < 132_ui)
@@ -1842,7 +1842,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPositioningSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 125_ui && k_version < 132_ui)
@@ -1868,7 +1868,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioMotionSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["volume_offset"] = nlohmann_json_t.volume_offset;
@@ -1877,7 +1877,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioMotionSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("volume_offset").get_to(nlohmann_json_t.volume_offset);
@@ -1894,7 +1894,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Parameter &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -1906,7 +1906,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Parameter &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -1930,7 +1930,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const RealTimeParameterControlSettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["type"] = nlohmann_json_t.type;
@@ -1946,7 +1946,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         RealTimeParameterControlSettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("type").get_to(nlohmann_json_t.type);
@@ -1969,7 +1969,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const RealTimeParameterControlSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["item"] = nlohmann_json_t.item;
@@ -1977,7 +1977,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         RealTimeParameterControlSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("item").get_to(nlohmann_json_t.item);
@@ -1993,7 +1993,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const StateSettingApplyItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["target"] = nlohmann_json_t.target;
@@ -2002,7 +2002,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         StateSettingApplyItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("target").get_to(nlohmann_json_t.target);
@@ -2020,7 +2020,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const StateSettingAttribute &nlohmann_json_t) -> void
     {
         if (k_version >= 125_ui)
@@ -2036,7 +2036,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         StateSettingAttribute &nlohmann_json_t) -> void
     {
         if (k_version >= 125_ui)
@@ -2061,7 +2061,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const StateSettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["group"] = nlohmann_json_t.group;
@@ -2071,7 +2071,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         StateSettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("group").get_to(nlohmann_json_t.group);
@@ -2089,7 +2089,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const StateSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 125_ui)
@@ -2101,7 +2101,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         StateSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 125_ui)
@@ -2121,7 +2121,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioHDRSettingEnvelopeTracking &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -2133,7 +2133,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioHDRSettingEnvelopeTracking &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -2152,7 +2152,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioHDRSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -2163,7 +2163,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioHDRSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -2182,7 +2182,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundMIDISettingEvent &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2194,7 +2194,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundMIDISettingEvent &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2214,7 +2214,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundMIDISettingNoteTracking &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2226,7 +2226,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundMIDISettingNoteTracking &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2246,7 +2246,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundMIDISettingTransformation &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2258,7 +2258,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundMIDISettingTransformation &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2281,7 +2281,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundMIDISettingFilter &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2296,7 +2296,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundMIDISettingFilter &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2321,7 +2321,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundMIDISetting &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2335,7 +2335,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundMIDISetting &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2360,7 +2360,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTransitionSettingItemSource &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -2372,7 +2372,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTransitionSettingItemSource &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -2397,7 +2397,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTransitionSettingItemDestination &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -2414,7 +2414,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTransitionSettingItemDestination &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -2443,7 +2443,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTransitionSettingItemSegment &nlohmann_json_t) -> void
     {
         nlohmann_json_j["enable"] = nlohmann_json_t.enable;
@@ -2456,7 +2456,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTransitionSettingItemSegment &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("enable").get_to(nlohmann_json_t.enable);
@@ -2479,7 +2479,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTransitionSettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["u1"] = nlohmann_json_t.u1;
@@ -2490,7 +2490,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTransitionSettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("u1").get_to(nlohmann_json_t.u1);
@@ -2508,7 +2508,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTransitionSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["item"] = nlohmann_json_t.item;
@@ -2516,7 +2516,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTransitionSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("item").get_to(nlohmann_json_t.item);
@@ -2531,7 +2531,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicMIDISettingTarget &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2542,7 +2542,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicMIDISettingTarget &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2560,7 +2560,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicMIDISettingClipTempo &nlohmann_json_t) -> void
     {
         if (k_version >= 112)
@@ -2571,7 +2571,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicMIDISettingClipTempo &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2590,7 +2590,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicMIDISetting &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2602,7 +2602,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicMIDISetting &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2621,7 +2621,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioBusMuteForBackgroundMusic &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2632,7 +2632,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioBusMuteForBackgroundMusic &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -2653,7 +2653,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPlaybackLimitSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["value"] = nlohmann_json_t.value;
@@ -2664,7 +2664,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPlaybackLimitSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("value").get_to(nlohmann_json_t.value);
@@ -2683,7 +2683,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioVirtualVoiceSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["behavior"] = magic_enum::enum_name(nlohmann_json_t.behavior);
@@ -2692,7 +2692,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioVirtualVoiceSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_t.behavior = magic_enum_cast<AudioVirtualVoiceSettingBehavior>(nlohmann_json_j.at("behavior").get<std::string>());
@@ -2710,7 +2710,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPlaybackPrioritySetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["value"] = nlohmann_json_t.value;
@@ -2720,7 +2720,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPlaybackPrioritySetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("value").get_to(nlohmann_json_t.value);
@@ -2737,7 +2737,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioMixerSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 112 && k_version < 150)
@@ -2748,7 +2748,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioMixerSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 112 && k_version < 150)
@@ -2768,7 +2768,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioVoiceVolumeGainSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["normalization"] = nlohmann_json_t.normalization;
@@ -2784,7 +2784,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioVoiceVolumeGainSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("normalization").get_to(nlohmann_json_t.normalization);
@@ -2842,7 +2842,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicTrack &nlohmann_json_t) -> void
     {
         nlohmann_json_j["parent"] = nlohmann_json_t.parent;
@@ -2918,7 +2918,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicTrack &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("parent").get_to(nlohmann_json_t.parent);
@@ -3003,7 +3003,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const StatefulPropertySettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["type"] = nlohmann_json_t.type;
@@ -3012,7 +3012,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         StatefulPropertySettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("type").get_to(nlohmann_json_t.type);
@@ -3026,7 +3026,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const StatefulPropertySetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["value"] = nlohmann_json_t.value;
@@ -3034,7 +3034,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         StatefulPropertySetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("value").get_to(nlohmann_json_t.value);
@@ -3092,7 +3092,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const EventActionException &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -3101,7 +3101,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         EventActionException &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -3121,7 +3121,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PlayAudio &nlohmann_json_t) -> void
     {
         nlohmann_json_j["delay"] = nlohmann_json_t.delay;
@@ -3133,7 +3133,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PlayAudio &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("delay").get_to(nlohmann_json_t.delay);
@@ -3154,7 +3154,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const StopAudio &nlohmann_json_t) -> void
     {
         nlohmann_json_j["delay"] = nlohmann_json_t.delay;
@@ -3169,7 +3169,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         StopAudio &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("delay").get_to(nlohmann_json_t.delay);
@@ -3194,7 +3194,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PauseAudio &nlohmann_json_t) -> void
     {
         nlohmann_json_j["delay"] = nlohmann_json_t.delay;
@@ -3210,7 +3210,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PauseAudio &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("delay").get_to(nlohmann_json_t.delay);
@@ -3236,7 +3236,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ResumeAudio &nlohmann_json_t) -> void
     {
         nlohmann_json_j["delay"] = nlohmann_json_t.delay;
@@ -3252,7 +3252,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ResumeAudio &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("delay").get_to(nlohmann_json_t.delay);
@@ -3273,7 +3273,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const BreakAudio &nlohmann_json_t) -> void
     {
         nlohmann_json_j["delay"] = nlohmann_json_t.delay;
@@ -3281,7 +3281,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         BreakAudio &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("delay").get_to(nlohmann_json_t.delay);
@@ -3297,7 +3297,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SeekAudio &nlohmann_json_t) -> void
     {
         nlohmann_json_j["delay"] = nlohmann_json_t.delay;
@@ -3308,7 +3308,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SeekAudio &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("delay").get_to(nlohmann_json_t.delay);
@@ -3324,7 +3324,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PostEvent &nlohmann_json_t) -> void
     {
         if (k_version >= 113_ui)
@@ -3335,7 +3335,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PostEvent &nlohmann_json_t) -> void
     {
         if (k_version >= 113_ui)
@@ -3356,7 +3356,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SetBusVolume &nlohmann_json_t) -> void
     {
         nlohmann_json_j["reset"] = nlohmann_json_t.reset;
@@ -3369,7 +3369,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SetBusVolume &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("reset").get_to(nlohmann_json_t.reset);
@@ -3392,7 +3392,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SetVoiceVolume &nlohmann_json_t) -> void
     {
         nlohmann_json_j["reset"] = nlohmann_json_t.reset;
@@ -3405,7 +3405,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SetVoiceVolume &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("reset").get_to(nlohmann_json_t.reset);
@@ -3428,7 +3428,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SetVolumePitch &nlohmann_json_t) -> void
     {
         nlohmann_json_j["reset"] = nlohmann_json_t.reset;
@@ -3441,7 +3441,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SetVolumePitch &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("reset").get_to(nlohmann_json_t.reset);
@@ -3464,7 +3464,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SetVolumeLowPassFilter &nlohmann_json_t) -> void
     {
         nlohmann_json_j["reset"] = nlohmann_json_t.reset;
@@ -3477,7 +3477,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SetVolumeLowPassFilter &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("reset").get_to(nlohmann_json_t.reset);
@@ -3500,7 +3500,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SetVolumeHighPassFilter &nlohmann_json_t) -> void
     {
         nlohmann_json_j["reset"] = nlohmann_json_t.reset;
@@ -3513,7 +3513,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SetVolumeHighPassFilter &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("reset").get_to(nlohmann_json_t.reset);
@@ -3534,7 +3534,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SetMute &nlohmann_json_t) -> void
     {
         nlohmann_json_j["reset"] = nlohmann_json_t.reset;
@@ -3545,7 +3545,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SetMute &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("reset").get_to(nlohmann_json_t.reset);
@@ -3567,7 +3567,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SetGameParameter &nlohmann_json_t) -> void
     {
         nlohmann_json_j["reset"] = nlohmann_json_t.reset;
@@ -3584,7 +3584,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SetGameParameter &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("reset").get_to(nlohmann_json_t.reset);
@@ -3607,7 +3607,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SetStateAvailability &nlohmann_json_t) -> void
     {
         nlohmann_json_j["enable"] = nlohmann_json_t.enable;
@@ -3616,7 +3616,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SetStateAvailability &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("enable").get_to(nlohmann_json_t.enable);
@@ -3632,7 +3632,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ActivateState &nlohmann_json_t) -> void
     {
         nlohmann_json_j["delay"] = nlohmann_json_t.delay;
@@ -3642,7 +3642,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ActivateState &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("delay").get_to(nlohmann_json_t.delay);
@@ -3659,7 +3659,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ActivateSwitch &nlohmann_json_t) -> void
     {
         nlohmann_json_j["delay"] = nlohmann_json_t.delay;
@@ -3669,7 +3669,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ActivateSwitch &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("delay").get_to(nlohmann_json_t.delay);
@@ -3684,7 +3684,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ActivateTrigger &nlohmann_json_t) -> void
     {
         nlohmann_json_j["delay"] = nlohmann_json_t.delay;
@@ -3692,7 +3692,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ActivateTrigger &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("delay").get_to(nlohmann_json_t.delay);
@@ -3708,7 +3708,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SetBypassEffect &nlohmann_json_t) -> void
     {
         nlohmann_json_j["reset"] = nlohmann_json_t.reset;
@@ -3719,7 +3719,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SetBypassEffect &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("reset").get_to(nlohmann_json_t.reset);
@@ -3735,7 +3735,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ReleaseEnvelope &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -3746,7 +3746,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ReleaseEnvelope &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -3762,7 +3762,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ResetPlaylist &nlohmann_json_t) -> void
     {
         if (k_version >= 113_ui)
@@ -3773,7 +3773,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ResetPlaylist &nlohmann_json_t) -> void
     {
         if (k_version >= 113_ui)
@@ -3820,7 +3820,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const EventAction &nlohmann_json_t) -> void
     {
         nlohmann_json_j["target"] = nlohmann_json_t.target;
@@ -3828,9 +3828,9 @@ namespace Sen::Kernel::Support::WWise::SoundBank
         nlohmann_json_j["exception"] = nlohmann_json_t.exception;
         nlohmann_json_j["scope"] = magic_enum::enum_name(nlohmann_json_t.scope);
         nlohmann_json_j["u1"] = nlohmann_json_t.u1;
-        nlohmann_json_j["property"] = nlohmann::ordered_json{
+        nlohmann_json_j["property"] = ordered_json{
             {"type", magic_enum::enum_name(nlohmann_json_t.action_type)},
-            {"value", nlohmann::ordered_json{}}};
+            {"value", ordered_json{}}};
         switch (nlohmann_json_t.type)
         {
         case 4_byte:
@@ -3959,7 +3959,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         EventAction &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("target").get_to(nlohmann_json_t.target);
@@ -4089,7 +4089,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Event &nlohmann_json_t) -> void
     {
         nlohmann_json_j["child"] = nlohmann_json_t.child;
@@ -4097,7 +4097,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Event &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("child").get_to(nlohmann_json_t.child);
@@ -4113,7 +4113,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioAssociationSettingArgument &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -4125,7 +4125,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioAssociationSettingArgument &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -4147,7 +4147,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioAssociationSettingPath &nlohmann_json_t) -> void
     {
         nlohmann_json_j["key"] = nlohmann_json_t.key;
@@ -4158,7 +4158,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioAssociationSettingPath &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("key").get_to(nlohmann_json_t.key);
@@ -4179,7 +4179,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioAssociationSetting &nlohmann_json_t) -> void
     {
         if (k_version < 88_ui)
@@ -4193,7 +4193,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioAssociationSetting &nlohmann_json_t) -> void
     {
         if (k_version < 88_ui)
@@ -4215,7 +4215,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const DialogueEvent &nlohmann_json_t) -> void
     {
         nlohmann_json_j["probability"] = nlohmann_json_t.probability;
@@ -4227,7 +4227,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         DialogueEvent &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("probability").get_to(nlohmann_json_t.probability);
@@ -4273,7 +4273,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AttenuationApplySetting &nlohmann_json_t) -> void
     {
         if (k_version < 88_ui)
@@ -4327,7 +4327,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AttenuationApplySetting &nlohmann_json_t) -> void
     {
         if (k_version < 88_ui)
@@ -4389,7 +4389,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AttenuationCurve &nlohmann_json_t) -> void
     {
         nlohmann_json_j["mode"] = nlohmann_json_t.mode;
@@ -4398,7 +4398,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AttenuationCurve &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("mode").get_to(nlohmann_json_t.mode);
@@ -4419,7 +4419,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AttenuationCone &nlohmann_json_t) -> void
     {
         if (k_version < 112_ui)
@@ -4435,7 +4435,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AttenuationCone &nlohmann_json_t) -> void
     {
         if (k_version < 112_ui)
@@ -4462,7 +4462,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Attenuation &nlohmann_json_t) -> void
     {
         nlohmann_json_j["apply"] = nlohmann_json_t.apply;
@@ -4477,7 +4477,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Attenuation &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("apply").get_to(nlohmann_json_t.apply);
@@ -4507,7 +4507,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const LowFrequencyOscillatorModulator &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -4526,7 +4526,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         LowFrequencyOscillatorModulator &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -4561,7 +4561,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const EnvelopeModulator &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -4581,7 +4581,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         EnvelopeModulator &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -4615,7 +4615,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const TimeModulator &nlohmann_json_t) -> void
     {
         if (k_version >= 132_ui)
@@ -4633,7 +4633,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         TimeModulator &nlohmann_json_t) -> void
     {
         if (k_version >= 132_ui)
@@ -4660,7 +4660,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const EffectU1 &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -4681,7 +4681,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         EffectU1 &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -4712,7 +4712,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Effect &nlohmann_json_t) -> void
     {
         nlohmann_json_j["plug_in"] = nlohmann_json_t.plug_in;
@@ -4730,7 +4730,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Effect &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("plug_in").get_to(nlohmann_json_t.plug_in);
@@ -4759,7 +4759,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Source &nlohmann_json_t) -> void
     {
         nlohmann_json_j["plug_in"] = nlohmann_json_t.plug_in;
@@ -4777,7 +4777,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Source &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("plug_in").get_to(nlohmann_json_t.plug_in);
@@ -4807,7 +4807,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioDevice &nlohmann_json_t) -> void
     {
         if (k_version >= 128_ui)
@@ -4826,7 +4826,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioDevice &nlohmann_json_t) -> void
     {
         if (k_version >= 128_ui)
@@ -4852,7 +4852,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioBusConfiguration &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -4863,7 +4863,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioBusConfiguration &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -4881,7 +4881,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const BusVoiceVolumeGainSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 125_ui)
@@ -4892,7 +4892,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         BusVoiceVolumeGainSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 125_ui)
@@ -4910,7 +4910,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const BusBusSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["volume"] = nlohmann_json_t.volume;
@@ -4918,7 +4918,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         BusBusSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("volume").get_to(nlohmann_json_t.volume);
@@ -4935,7 +4935,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const BusOutputBusSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 128_ui)
@@ -4948,7 +4948,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         BusOutputBusSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 128_ui)
@@ -4973,7 +4973,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const BusAutomaticDuckingSettingBus &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -4986,7 +4986,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         BusAutomaticDuckingSettingBus &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -5008,7 +5008,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const BusAutomaticDuckingSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["recovery_time"] = nlohmann_json_t.recovery_time;
@@ -5018,7 +5018,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         BusAutomaticDuckingSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("recovery_time").get_to(nlohmann_json_t.recovery_time);
@@ -5038,7 +5038,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const BusHDRSettingDynamic &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -5052,7 +5052,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         BusHDRSettingDynamic &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -5075,7 +5075,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const BusHDRSettingWindowTopOutputGameParameter &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -5088,7 +5088,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         BusHDRSettingWindowTopOutputGameParameter &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -5111,7 +5111,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const BusHDRSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -5125,7 +5125,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         BusHDRSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -5165,7 +5165,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioBus &nlohmann_json_t) -> void
     {
         nlohmann_json_j["parent"] = nlohmann_json_t.parent;
@@ -5224,7 +5224,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioBus &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("parent").get_to(nlohmann_json_t.parent);
@@ -5309,7 +5309,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AuxiliaryAudioBus &nlohmann_json_t) -> void
     {
         nlohmann_json_j["parent"] = nlohmann_json_t.parent;
@@ -5368,7 +5368,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AuxiliaryAudioBus &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("parent").get_to(nlohmann_json_t.parent);
@@ -5435,7 +5435,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -5447,7 +5447,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -5498,7 +5498,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Sound &nlohmann_json_t) -> void
     {
         nlohmann_json_j["parent"] = nlohmann_json_t.parent;
@@ -5573,7 +5573,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Sound &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("parent").get_to(nlohmann_json_t.parent);
@@ -5656,7 +5656,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundPlaylistContainerPlaylistItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["item"] = nlohmann_json_t.item;
@@ -5665,7 +5665,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundPlaylistContainerPlaylistItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("item").get_to(nlohmann_json_t.item);
@@ -5682,7 +5682,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPlayTypeRandomSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["type"] = magic_enum::enum_name(nlohmann_json_t.type);
@@ -5691,7 +5691,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPlayTypeRandomSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_t.type = magic_enum_cast<AudioPlayTypeRandomType>(nlohmann_json_j.at("type").get<std::string>());
@@ -5707,7 +5707,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPlayTypeSequenceSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["at_end_of_playlist"] = magic_enum::enum_name(nlohmann_json_t.at_end_of_playlist);
@@ -5715,7 +5715,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPlayTypeSequenceSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_t.at_end_of_playlist = magic_enum_cast<AudioPlayTypeSequenceAtEndOfPlaylist>(nlohmann_json_j.at("at_end_of_playlist").get<std::string>());
@@ -5731,7 +5731,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPlayTypeSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["random"] = nlohmann_json_t.random;
@@ -5740,7 +5740,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPlayTypeSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("random").get_to(nlohmann_json_t.random);
@@ -5755,14 +5755,14 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPlayModeStepSetting &nlohmann_json_t) -> void
     {
         return;
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPlayModeStepSetting &nlohmann_json_t) -> void
     {
         return;
@@ -5779,7 +5779,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPlayModeContinuousSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["always_reset_playlist"] = nlohmann_json_t.always_reset_playlist;
@@ -5797,7 +5797,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPlayModeContinuousSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("always_reset_playlist").get_to(nlohmann_json_t.always_reset_playlist);
@@ -5821,7 +5821,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioPlayModeSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["step"] = nlohmann_json_t.step;
@@ -5830,7 +5830,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioPlayModeSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("step").get_to(nlohmann_json_t.step);
@@ -5852,7 +5852,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundPlaylistContainerPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -5869,7 +5869,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundPlaylistContainerPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui) {
@@ -5925,7 +5925,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundPlaylistContainer &nlohmann_json_t) -> void
     {
         nlohmann_json_j["parent"] = nlohmann_json_t.parent;
@@ -6001,7 +6001,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundPlaylistContainer &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("parent").get_to(nlohmann_json_t.parent);
@@ -6089,7 +6089,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundSwitchContainerObjectAttributeItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -6102,7 +6102,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundSwitchContainerObjectAttributeItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -6123,7 +6123,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundSwitchContainerObjectAssignItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["item"] = nlohmann_json_t.item;
@@ -6132,7 +6132,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundSwitchContainerObjectAssignItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("item").get_to(nlohmann_json_t.item);
@@ -6152,7 +6152,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundSwitchContainerPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -6167,7 +6167,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundSwitchContainerPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui) {
@@ -6223,7 +6223,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundSwitchContainer &nlohmann_json_t) -> void
     {
         nlohmann_json_j["parent"] = nlohmann_json_t.parent;
@@ -6299,7 +6299,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundSwitchContainer &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("parent").get_to(nlohmann_json_t.parent);
@@ -6383,7 +6383,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundBlendContainerTrackChildItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -6392,7 +6392,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundBlendContainerTrackChildItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -6411,7 +6411,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundBlendContainerTrackItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -6422,7 +6422,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundBlendContainerTrackItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -6442,7 +6442,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundBlendContainerPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -6458,7 +6458,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundBlendContainerPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 88_ui)
@@ -6514,7 +6514,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundBlendContainer &nlohmann_json_t) -> void
     {
         nlohmann_json_j["parent"] = nlohmann_json_t.parent;
@@ -6590,7 +6590,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundBlendContainer &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("parent").get_to(nlohmann_json_t.parent);
@@ -6672,14 +6672,14 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ActorMixerPlaybackSetting &nlohmann_json_t) -> void
     {
         return;
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ActorMixerPlaybackSetting &nlohmann_json_t) -> void
     {
         return;
@@ -6726,7 +6726,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ActorMixer &nlohmann_json_t) -> void
     {
         nlohmann_json_j["parent"] = nlohmann_json_t.parent;
@@ -6802,7 +6802,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ActorMixer &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("parent").get_to(nlohmann_json_t.parent);
@@ -6887,7 +6887,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicSegmentCueItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -6897,7 +6897,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicSegmentCueItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -6914,7 +6914,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicSegmentCue &nlohmann_json_t) -> void
     {
         nlohmann_json_j["item"] = nlohmann_json_t.item;
@@ -6922,7 +6922,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicSegmentCue &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("item").get_to(nlohmann_json_t.item);
@@ -6939,7 +6939,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicSegmentPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -6952,7 +6952,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicSegmentPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -6973,7 +6973,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioTimeSettingSignature &nlohmann_json_t) -> void
     {
         nlohmann_json_j["first"] = nlohmann_json_t.first;
@@ -6982,7 +6982,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioTimeSettingSignature &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("first").get_to(nlohmann_json_t.first);
@@ -7001,7 +7001,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const AudioTimeSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["time"] = nlohmann_json_t.time;
@@ -7012,7 +7012,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         AudioTimeSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("time").get_to(nlohmann_json_t.time);
@@ -7035,7 +7035,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicStingerSettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["trigger"] = nlohmann_json_t.trigger;
@@ -7048,7 +7048,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicStingerSettingItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("trigger").get_to(nlohmann_json_t.trigger);
@@ -7068,7 +7068,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicStingerSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["item"] = nlohmann_json_t.item;
@@ -7076,7 +7076,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicStingerSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("item").get_to(nlohmann_json_t.item);
@@ -7126,7 +7126,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicSegment &nlohmann_json_t) -> void
     {
         nlohmann_json_j["parent"] = nlohmann_json_t.parent;
@@ -7204,7 +7204,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicSegment &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("parent").get_to(nlohmann_json_t.parent);
@@ -7297,7 +7297,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicPlaylistContainerPlaylistItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j["u1"] = nlohmann_json_t.u1;
@@ -7313,7 +7313,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicPlaylistContainerPlaylistItem &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("u1").get_to(nlohmann_json_t.u1);
@@ -7337,7 +7337,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicPlaylistContainerPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -7349,7 +7349,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicPlaylistContainerPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version >= 112_ui)
@@ -7404,7 +7404,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicPlaylistContainer &nlohmann_json_t) -> void
     {
         nlohmann_json_j["parent"] = nlohmann_json_t.parent;
@@ -7483,7 +7483,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicPlaylistContainer &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("parent").get_to(nlohmann_json_t.parent);
@@ -7570,7 +7570,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicSwitchContainerAssociationItem &nlohmann_json_t) -> void
     {
         if (k_version < 88_ui)
@@ -7582,7 +7582,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicSwitchContainerAssociationItem &nlohmann_json_t) -> void
     {
         if (k_version < 88_ui)
@@ -7605,7 +7605,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicSwitchContainerPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version < 88_ui)
@@ -7624,7 +7624,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicSwitchContainerPlaybackSetting &nlohmann_json_t) -> void
     {
         if (k_version < 88_ui)
@@ -7686,7 +7686,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicSwitchContainer &nlohmann_json_t) -> void
     {
         nlohmann_json_j["parent"] = nlohmann_json_t.parent;
@@ -7765,7 +7765,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicSwitchContainer &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("parent").get_to(nlohmann_json_t.parent);
@@ -7854,7 +7854,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const EffectSine &nlohmann_json_t) -> void
     {
         nlohmann_json_j["frequency"] = nlohmann_json_t.frequency;
@@ -7865,7 +7865,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         EffectSine &nlohmann_json_t) -> void
     {
     }
@@ -7879,7 +7879,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const EffectSlience &nlohmann_json_t) -> void
     {
         nlohmann_json_j["duration"] = nlohmann_json_t.duration;
@@ -7889,7 +7889,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         EffectSlience &nlohmann_json_t) -> void
     {
     }
@@ -7941,7 +7941,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ToneGenSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["gain"] = nlohmann_json_t.gain;
@@ -7964,7 +7964,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ToneGenSetting &nlohmann_json_t) -> void
     {
     }
@@ -7993,7 +7993,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ParameterEQModule &nlohmann_json_t) -> void
     {
         nlohmann_json_j["filter_type"] = magic_enum::enum_name(nlohmann_json_t.filter_type);
@@ -8005,7 +8005,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ParameterEQModule &nlohmann_json_t) -> void
     {
     }
@@ -8017,7 +8017,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ParameterEQ &nlohmann_json_t) -> void
     {
         nlohmann_json_j["band"] = nlohmann_json_t.band;
@@ -8027,7 +8027,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ParameterEQ &nlohmann_json_t) -> void
     {
     }
@@ -8041,7 +8041,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const RealTimeParameterControlEffectSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["feedback"] = nlohmann_json_t.feedback;
@@ -8051,7 +8051,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         RealTimeParameterControlEffectSetting &nlohmann_json_t) -> void
     {
     }
@@ -8065,7 +8065,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const DelayEffect &nlohmann_json_t) -> void
     {
         nlohmann_json_j["delay_time"] = nlohmann_json_t.delay_time;
@@ -8075,7 +8075,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         DelayEffect &nlohmann_json_t) -> void
     {
     }
@@ -8113,7 +8113,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Hierarchy &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -8241,7 +8241,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Hierarchy &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -8373,7 +8373,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundBankReference &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -8382,7 +8382,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundBankReference &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -8399,7 +8399,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PlugInReference &nlohmann_json_t) -> void
     {
         if (k_version >= 118_ui)
@@ -8411,7 +8411,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PlugInReference &nlohmann_json_t) -> void
     {
         if (k_version >= 118_ui)
@@ -8440,7 +8440,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ObstructionSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["enable"] = nlohmann_json_t.enable;
@@ -8450,7 +8450,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ObstructionSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("enable").get_to(nlohmann_json_t.enable);
@@ -8469,7 +8469,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const ObstructionSettingBundle &nlohmann_json_t) -> void
     {
         nlohmann_json_j["volume"] = nlohmann_json_t.volume;
@@ -8482,7 +8482,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         ObstructionSettingBundle &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("volume").get_to(nlohmann_json_t.volume);
@@ -8508,7 +8508,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Setting &nlohmann_json_t) -> void
     {
         if (k_version >= 113_ui)
@@ -8531,7 +8531,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Setting &nlohmann_json_t) -> void
     {
         if (k_version >= 113_ui)
@@ -8563,7 +8563,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const StateGroupCustomTransition &nlohmann_json_t) -> void
     {
         nlohmann_json_j["from"] = nlohmann_json_t.from;
@@ -8573,7 +8573,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         StateGroupCustomTransition &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("from").get_to(nlohmann_json_t.from);
@@ -8592,7 +8592,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const StateGroup &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -8602,7 +8602,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         StateGroup &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -8621,7 +8621,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SwitchGroup &nlohmann_json_t) -> void
     {
         nlohmann_json_j["id"] = nlohmann_json_t.id;
@@ -8631,7 +8631,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SwitchGroup &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
@@ -8653,7 +8653,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const GameParameter &nlohmann_json_t) -> void
     {
         
@@ -8670,7 +8670,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         GameParameter &nlohmann_json_t) -> void
     {
         
@@ -8700,7 +8700,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const GameSynchronizationU1 &nlohmann_json_t) -> void
     {
         if (k_version >= 140_ui)
@@ -8717,7 +8717,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         GameSynchronizationU1 &nlohmann_json_t) -> void
     {
         if (k_version >= 140_ui)
@@ -8743,7 +8743,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const GameSynchronization &nlohmann_json_t) -> void
     {
         nlohmann_json_j["state_group"] = nlohmann_json_t.state_group;
@@ -8757,7 +8757,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         GameSynchronization &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("state_group").get_to(nlohmann_json_t.state_group);
@@ -8788,7 +8788,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundBankInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j["bank_header"] = nlohmann_json_t.bank_header;
@@ -8810,7 +8810,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundBankInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("bank_header").get_to(nlohmann_json_t.bank_header);
@@ -8861,4 +8861,40 @@ namespace Sen::Kernel::Support::WWise::SoundBank
         }
         return;
     }
+
+    //---------------------------------
+
+    struct MediaIndex
+    {
+        uint32_t id;
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    inline auto to_json(
+        ordered_json &nlohmann_json_j,
+        const MediaIndex &nlohmann_json_t) -> void
+    {
+        nlohmann_json_j["id"] = nlohmann_json_t.id;
+        nlohmann_json_j["offset"] = nlohmann_json_t.offset;
+        nlohmann_json_j["size"] = nlohmann_json_t.size;
+        return;
+    }
+
+    // bank header and media table only, offset is absolute in the bank
+
+    struct SoundBankIndex
+    {
+        BankHeader bank_header;
+        std::vector<MediaIndex> media;
+    };
+
+    inline auto to_json(
+        ordered_json &nlohmann_json_j,
+        const SoundBankIndex &nlohmann_json_t) -> void
+    {
+        nlohmann_json_j["bank_header"] = nlohmann_json_t.bank_header;
+        nlohmann_json_j["media"] = nlohmann_json_t.media;
+        return;
+    }
 }
\ No newline at end of file
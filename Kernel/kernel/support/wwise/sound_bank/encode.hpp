@@ -17,21 +17,51 @@ namespace Sen::Kernel::Support::WWise::SoundBank
     struct Encode : Common
     {
     protected:
+        // nibble of each hex digit, 0xFF for anything else
+
+        inline static constexpr auto k_hex_value = []() {
+            auto result = std::array<uint8_t, 256>{};
+            result.fill(0xFF);
+            for (auto c = '0'; c <= '9'; ++c)
+            {
+                result[static_cast<uint8_t>(c)] = static_cast<uint8_t>(c - '0');
+            }
+            for (auto c = 'a'; c <= 'f'; ++c)
+            {
+                result[static_cast<uint8_t>(c)] = static_cast<uint8_t>(c - 'a' + 10);
+                result[static_cast<uint8_t>(c - 'a' + 'A')] = static_cast<uint8_t>(c - 'a' + 10);
+            }
+            return result;
+        }();
+
+        // spaced hex string, decoded in one pass straight into the stream
+
         inline static auto exchange_data(
             DataStreamView &stream,
             std::string const &value) -> void
         {
-            auto hexString = value;
-            hexString.erase(std::remove(hexString.begin(), hexString.end(), ' '), hexString.end());
-            auto bytes = std::vector<uint8_t>{};
-            for (auto i = static_cast<unsigned int>(0); i < hexString.length(); i += 2)
+            auto digit_count = static_cast<size_t>(std::count_if(value.begin(), value.end(), [](auto c)
+                                                                 { return c != ' '; }));
+            assert_conditional(digit_count % 2_size == 0_size, String::format(fmt::format("{}", Language::get("wwise.soundbank.encode.invalid_hex_string")), value), "exchange_data");
+            stream.writeUint32(static_cast<uint32_t>(digit_count / 2_size));
+            auto cursor = stream.write_cursor(digit_count / 2_size);
+            auto high = uint8_t{0xFF};
+            for (auto c : value)
             {
-                auto byteString = hexString.substr(i, 2);
-                auto byte = static_cast<std::uint8_t>(std::strtol(byteString.data(), NULL, 16));
-                bytes.push_back(byte);
+                if (c == ' ')
+                {
+                    continue;
+                }
+                auto nibble = k_hex_value[static_cast<uint8_t>(c)];
+                assert_conditional(nibble != 0xFF, String::format(fmt::format("{}", Language::get("wwise.soundbank.encode.invalid_hex_string")), value), "exchange_data");
+                if (high == 0xFF)
+                {
+                    high = nibble;
+                    continue;
+                }
+                cursor.writeUint8(static_cast<uint8_t>((high << 4) | nibble));
+                high = 0xFF;
             }
-            stream.writeUint32(static_cast<uint32_t>(bytes.size()));
-            stream.writeBytes(bytes);
             return;
         }
 
@@ -3306,33 +3336,127 @@ namespace Sen::Kernel::Support::WWise::SoundBank
             return;
         }
 
-        inline static auto exchange_media(
-            DataStreamView &stream,
+        struct MediaSlot
+        {
+            uint32_t id;
+            uint32_t offset;
+            uint32_t size;
+            std::string path;
+        };
+
+        // every slot is placed from the file size alone, no media is read here
+
+        inline static auto exchange_media_layout(
             std::vector<uint32_t> const &value,
-            ChunkSign &sign,
-            std::string_view source) -> void
+            std::string_view source) -> std::vector<MediaSlot>
         {
-            chuck_sign_set(stream, sign);
-            auto data_stream = DataStreamView{};
-            auto data_count = value.size();
-            for (auto data_index : Range(data_count))
-            {
-                auto data = FileSystem::read_binary<uint8_t>(fmt::format("{}/media/{}.wem", source, value[data_index]));
-                stream.writeUint32(value[data_index]);
-                stream.writeUint32(static_cast<uint32_t>(data_stream.write_pos));
-                stream.writeUint32(static_cast<uint32_t>(data.size()));
-                data_stream.writeBytes(data);
-                if (data_index < data_count - 1_size)
+            auto result = std::vector<MediaSlot>{};
+            result.reserve(value.size());
+            auto offset = k_none_size;
+            for (auto data_index : Range(value.size()))
+            {
+                if (data_index > 0_size)
                 {
-                    data_stream.writeNull(compute_padding_size(data_stream.write_pos, k_data_block_padding_size));
+                    offset += compute_padding_size(offset, k_data_block_padding_size);
                 }
+                auto path = fmt::format("{}/media/{}.wem", source, value[data_index]);
+#if WINDOWS
+                auto size = static_cast<size_t>(std::filesystem::file_size(std::filesystem::path{String::utf8_to_utf16(path.data())}));
+#else
+                auto size = static_cast<size_t>(std::filesystem::file_size(std::filesystem::path{path}));
+#endif
+                result.emplace_back(MediaSlot{
+                    .id = value[data_index],
+                    .offset = static_cast<uint32_t>(offset),
+                    .size = static_cast<uint32_t>(size),
+                    .path = std::move(path)});
+                offset += size;
+            }
+            return result;
+        }
+
+        inline static auto exchange_media_size(
+            std::vector<MediaSlot> const &layout) -> size_t
+        {
+            return layout.empty() ? k_none_size : static_cast<size_t>(layout.back().offset) + static_cast<size_t>(layout.back().size);
+        }
+
+        // DIDX and the DATA chunk sign, the DATA content follows
+
+        inline static auto exchange_media_index(
+            DataStreamView &stream,
+            std::vector<MediaSlot> const &layout,
+            ChunkSign &sign) -> void
+        {
+            chuck_sign_set(stream, sign);
+            for (auto &slot : layout)
+            {
+                stream.writeUint32(slot.id);
+                stream.writeUint32(slot.offset);
+                stream.writeUint32(slot.size);
             }
             chuck_sign_write(stream, sign);
             auto data_sign = ChunkSign{
                 .id = ChunkSignFlag::data,
-                .size = static_cast<uint32_t>(data_stream.size())};
+                .size = static_cast<uint32_t>(exchange_media_size(layout))};
             exchange_chuck_sign(data_sign, stream);
-            stream.writeBytes(data_stream.toBytes());
+            return;
+        }
+
+        // each file is read straight into its slot of the stream
+
+        inline static auto exchange_media_data(
+            DataStreamView &stream,
+            std::vector<MediaSlot> const &layout) -> void
+        {
+            auto begin = stream.write_pos;
+            auto cursor = stream.write_cursor(exchange_media_size(layout));
+            auto position = k_begin_index;
+            for (auto &slot : layout)
+            {
+                cursor.writeNull(static_cast<size_t>(slot.offset) - position);
+                auto file = FileSystem::FileHandler{slot.path, "rb"};
+                auto size = std::fread(cursor.position, 1_size, static_cast<size_t>(slot.size), file.file.get());
+                assert_conditional(size == static_cast<size_t>(slot.size), fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(slot.path)), "exchange_media_data");
+                cursor.position += size;
+                position = static_cast<size_t>(slot.offset) + size;
+            }
+            assert_conditional(stream.write_pos - begin == position, fmt::format("{}", Language::get("wwise.soundbank.decode.invalid_wem_data_bank")), "exchange_media_data");
+            return;
+        }
+
+        // a short write means the destination could not take the whole bank
+
+        inline static auto write_data(
+            FileSystem::FileHandler &destination,
+            std::string_view destination_path,
+            std::span<uint8_t const> data) -> void
+        {
+            auto size = std::fwrite(data.data(), 1_size, data.size(), destination.file.get());
+            assert_conditional(size == data.size(), fmt::format("{}: {}", Language::get("write_file_error"), String::to_posix_style(std::string{destination_path})), "write_data");
+            return;
+        }
+
+        // each file is copied in chunks behind the part of the bank already written to the destination
+
+        inline static auto exchange_media_data(
+            FileSystem::FileHandler &destination,
+            std::string_view destination_path,
+            std::vector<MediaSlot> const &layout) -> void
+        {
+            auto padding = std::array<uint8_t, k_data_block_padding_size>{};
+            auto position = k_begin_index;
+            for (auto &slot : layout)
+            {
+                write_data(destination, destination_path, std::span<uint8_t const>{padding.data(), static_cast<size_t>(slot.offset) - position});
+                auto size = k_none_size;
+                FileSystem::read_chunk(slot.path, FileSystem::k_chunk_size, [&](std::span<uint8_t const> chunk)
+                                       {
+                    write_data(destination, destination_path, chunk);
+                    size += chunk.size(); });
+                assert_conditional(size == static_cast<size_t>(slot.size), fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(slot.path)), "exchange_media_data");
+                position = static_cast<size_t>(slot.offset) + size;
+            }
             return;
         }
 
@@ -3677,21 +3801,36 @@ namespace Sen::Kernel::Support::WWise::SoundBank
             return;
         }
 
-        inline static auto exchange_sound_bank(
+        // BKHD, then DIDX and the DATA sign when the bank has media
+        // return: where each media file goes in the DATA chunk
+
+        inline static auto exchange_sound_bank_head(
             DataStreamView &stream,
             SoundBankInformation const &definition,
-            std::string_view source) -> void
+            std::string_view source) -> std::vector<MediaSlot>
         {
             auto sign = ChunkSign{};
             sign.id = ChunkSignFlag::bkhd;
             chuck_sign_set(stream, sign);
             exchange_bank_header(stream, definition.bank_header);
             chuck_sign_write(stream, sign);
+            auto layout = std::vector<MediaSlot>{};
             if (definition.has_media)
             {
                 sign.id = ChunkSignFlag::didx;
-                exchange_media(stream, definition.media, sign, source);
+                layout = exchange_media_layout(definition.media, source);
+                exchange_media_index(stream, layout, sign);
             }
+            return layout;
+        }
+
+        // every chunk after DATA
+
+        inline static auto exchange_sound_bank_tail(
+            DataStreamView &stream,
+            SoundBankInformation const &definition) -> void
+        {
+            auto sign = ChunkSign{};
             if (definition.has_setting && k_version >= 118_ui)
             {
                 sign.id = ChunkSignFlag::init;
@@ -3743,18 +3882,46 @@ namespace Sen::Kernel::Support::WWise::SoundBank
             SoundBankInformation const &definition,
             std::string_view source) -> void
         {
-            exchange_sound_bank(stream, definition, source);
+            auto layout = exchange_sound_bank_head(stream, definition, source);
+            exchange_media_data(stream, layout);
+            exchange_sound_bank_tail(stream, definition);
             return;
         }
 
+        /**
+         * Only the chunks around DATA are built in memory,
+         * the media is copied from disk into the destination in chunks
+         * The bank is written next to destination and renamed over it once every write succeeds,
+         * a failed write leaves no truncated bank behind
+         */
+
         inline static auto process_fs(
             std::string_view source,
             std::string_view destination) -> void
         {
-            auto stream = DataStreamView{};
-            auto definition = *FileSystem::read_json(fmt::format("{}/data.json", source));
-            process_whole(stream, definition, source);
-            stream.out_file(destination);
+            SoundBankInformation definition = *FileSystem::read_json(fmt::format("{}/data.json", source));
+            auto temporary_file = fmt::format("{}.tmp", destination);
+            try {
+                auto head = DataStreamView{};
+                auto layout = exchange_sound_bank_head(head, definition, source);
+                head.out_file(temporary_file);
+                auto tail = DataStreamView{};
+                exchange_sound_bank_tail(tail, definition);
+                auto file = FileSystem::FileHandler{temporary_file, "ab"};
+                exchange_media_data(file, temporary_file, layout);
+                write_data(file, temporary_file, tail.data_view());
+                assert_conditional(std::fflush(file.file.get()) == 0, fmt::format("{}: {}", Language::get("write_file_error"), String::to_posix_style(temporary_file)), "process_fs");
+            }
+            catch (...) {
+                auto error = std::error_code{};
+                #if WINDOWS
+                std::filesystem::remove(std::filesystem::path{String::utf8_to_utf16(temporary_file)}, error);
+                #else
+                std::filesystem::remove(std::filesystem::path{temporary_file}, error);
+                #endif
+                throw;
+            }
+            Path::Script::rename(temporary_file, destination);
             return;
         }
     };
@@ -23,7 +23,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j["bank_version"] = nlohmann_json_t.bank_version;
@@ -32,7 +32,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicSetting &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("bank_version").get_to(nlohmann_json_t.bank_version);
@@ -48,7 +48,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MediaSource &nlohmann_json_t) -> void
     {
         nlohmann_json_j["target_index"] = nlohmann_json_t.target_index;
@@ -59,7 +59,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MediaSource &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("target_index").get_to(nlohmann_json_t.target_index);
@@ -75,7 +75,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicChild &nlohmann_json_t) -> void
     {
         nlohmann_json_j["switches_name"] = nlohmann_json_t.switches_name;
@@ -84,7 +84,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicChild &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("switches_name").get_to(nlohmann_json_t.switches_name);
@@ -99,7 +99,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const MusicInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j["audio_name"] = nlohmann_json_t.audio_name;
@@ -109,7 +109,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         MusicInformation &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("audio_name").get_to(nlohmann_json_t.audio_name);
@@ -126,7 +126,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const InjectionMusicStruct &nlohmann_json_t) -> void
     {
         nlohmann_json_j["setting"] = nlohmann_json_t.setting;
@@ -136,7 +136,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         InjectionMusicStruct &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("setting").get_to(nlohmann_json_t.setting);
@@ -154,7 +154,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundBankGroup &nlohmann_json_t) -> void
     {
         nlohmann_json_j["name"] = nlohmann_json_t.name;
@@ -163,7 +163,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundBankGroup &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("name").get_to(nlohmann_json_t.name);
@@ -177,7 +177,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const Position &nlohmann_json_t) -> void
     {
         nlohmann_json_j["group_index"] = nlohmann_json_t.group_index;
@@ -186,7 +186,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         Position &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("group_index").get_to(nlohmann_json_t.group_index);
@@ -201,7 +201,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const PostitionSource &nlohmann_json_t) -> void
     {
         nlohmann_json_j["is_state"] = nlohmann_json_t.is_state;
@@ -211,7 +211,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         PostitionSource &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("is_state").get_to(nlohmann_json_t.is_state);
@@ -226,7 +226,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const InteractiveMusic &nlohmann_json_t) -> void
     {
         nlohmann_json_j["position_source"] = nlohmann_json_t.position_source;
@@ -235,7 +235,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         InteractiveMusic &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("position_source").get_to(nlohmann_json_t.position_source);
@@ -250,7 +250,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundBankEvent &nlohmann_json_t) -> void
     {
         nlohmann_json_j["name"] = nlohmann_json_t.name;
@@ -260,7 +260,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundBankEvent &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("name").get_to(nlohmann_json_t.name);
@@ -275,7 +275,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundBankCreateInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j["name"] = nlohmann_json_t.name;
@@ -284,7 +284,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundBankCreateInfo &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("name").get_to(nlohmann_json_t.name);
@@ -301,7 +301,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     };
 
     inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
+        ordered_json &nlohmann_json_j,
         const SoundBankCreateStruct &nlohmann_json_t) -> void
     {
         nlohmann_json_j["setting"] = nlohmann_json_t.setting;
@@ -313,7 +313,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank::Miscellaneous
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
+        const ordered_json &nlohmann_json_j,
         SoundBankCreateStruct &nlohmann_json_t) -> void
     {
         nlohmann_json_j.at("setting").get_to(nlohmann_json_t.setting);
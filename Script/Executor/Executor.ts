@@ -673,6 +673,19 @@ namespace Sen.Script.Executor {
             } else {
                 parse_argument(argument as Argument & { source: Array<string> }, loader);
             }
+            if (loader.method === "host") {
+                Host.serve(
+                    (loader.address as string | undefined) ?? "127.0.0.1",
+                    BigInt((loader.port as bigint | string | undefined) ?? 9999n),
+                    BigInt((loader.worker as bigint | string | undefined) ?? Kernel.Thread.hardware_concurrency()),
+                    (loader.token_file as string | undefined) ?? "",
+                );
+                return;
+            }
+            if (loader.method === "host.worker") {
+                Host.work();
+                return;
+            }
             if (loader.method !== undefined) {
                 const method = loader.method;
                 delete (loader as any).method;
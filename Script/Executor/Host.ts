@@ -0,0 +1,77 @@
+namespace Sen.Script.Executor.Host {
+    /**
+     * A job posted to the host, the argument is the same as the one given by the command line
+     */
+
+    export interface Job {
+        method: string;
+        argument?: Record<string, unknown>;
+    }
+
+    // integers become bigint like the "n" suffix of a command line argument
+
+    export function exchange_job_argument(argument: Record<string, unknown> | undefined): Base {
+        const destination: Record<string, unknown> = {};
+        for (const [key, value] of Object.entries(argument ?? {})) {
+            destination[key] = typeof value === "number" && Number.isInteger(value) ? BigInt(value) : value;
+        }
+        return destination as Base;
+    }
+
+    // the job endpoint can run any script, so it never listens beyond this machine, "unix:<path>" is a Unix socket
+
+    export function is_loopback(address: string): boolean {
+        return address === "127.0.0.1" || address === "::1" || address === "localhost" || (address.startsWith("unix:") && address.length > "unix:".length);
+    }
+
+    /**
+     * Listen for jobs and run each one on a worker, a Shell child that has already loaded the environment,
+     * every worker runs a single job on its own runtime and is replaced after, so jobs never share globals
+     * Every request must send the token made at startup as "Authorization: Bearer <token>"
+     * @param address - loopback address or "unix:<path>" to listen
+     * @param port - port to listen
+     * @param worker - number of jobs running at the same time
+     * @param token_file - file the token is written to, readable by the owner only, the token is printed once if empty
+     */
+
+    export function serve(address: string, port: bigint, worker: bigint, token_file: string): void {
+        assert(is_loopback(address), format(Kernel.Language.get("js.host.address_must_be_loopback"), address));
+        assert(worker >= 1n, format(Kernel.Language.get("js.host.invalid_worker"), worker));
+        const token: string = Shell.callback(["host_listen", address, port.toString(), worker.toString(), token_file]);
+        assert(token !== "", format(Kernel.Language.get("js.host.cannot_listen"), address, port));
+        Console.finished(format(Kernel.Language.get("js.host.listening"), address, port));
+        if (token_file === "") {
+            Console.finished(format(Kernel.Language.get("js.host.token"), token));
+        } else {
+            Console.finished(format(Kernel.Language.get("js.host.token_written"), token_file));
+        }
+        Shell.callback(["host_wait"]);
+        Console.finished(Kernel.Language.get("js.host.stopped"));
+        return;
+    }
+
+    /**
+     * Inside a worker: wait for the job the host hands over, run it and report its result,
+     * a failed job is reported on its stream like any other result
+     */
+
+    export function work(): void {
+        const received: string = Shell.callback(["host_receive"]);
+        if (received === "") {
+            return;
+        }
+        const separator = received.indexOf("\n");
+        const id = received.substring(0, separator);
+        let result: string | undefined = undefined;
+        try {
+            const job: Job = JSON.parse(received.substring(separator + 1));
+            assert(is_string(job.method), Kernel.Language.get("js.host.invalid_job"));
+            result = execute<Base>(exchange_job_argument(job.argument), job.method, Forward.DIRECT, "simple");
+        } catch (e: any) {
+            result = Exception.make_exception(e);
+            Console.error(result);
+        }
+        Shell.callback(["host_finish", id, result === undefined ? "ok" : "error", result ?? ""]);
+        return;
+    }
+}
@@ -77,7 +77,20 @@ namespace Sen.Script.Executor.Methods.PopCap.ReAnimation.Decode {
                 return;
             },
             batch_forward(argument: BatchArgument): void {
-                return basic_batch(this, argument, false);
+                const files: Array<string> = Kernel.FileSystem.read_directory(argument.directory).filter((path: string) => Kernel.FileSystem.is_file(path) && this.filter[1].test(path));
+                Console.argument(Kernel.Language.get("popcap.reanim.decode.generic"));
+                configurate_or_input(argument, "platform", Detail.platform());
+                clock.start_safe();
+                // the kernel decodes the whole directory on its own pool
+                Kernel.Support.PopCap.ReAnimation.decode_many_fs(
+                    files,
+                    files.map((source: string) => `${Kernel.Path.except_extension(source)}.json`),
+                    argument.platform!,
+                    BigInt(Math.min(files.length, Number(Kernel.Thread.hardware_concurrency()))),
+                );
+                clock.stop_safe();
+                Console.finished(format(Kernel.Language.get("batch.process.count"), files.length));
+                return;
             },
             is_enabled: true,
             configuration: undefined!,
@@ -9,6 +9,7 @@ namespace Sen.Script.Executor.Methods.PvZ2.Custom.SCG.Encode {
         destination?: string;
         generic?: Generic;
         animation_split_label?: boolean;
+        high_quality_resize?: boolean;
         enable_debug?: boolean;
     }
 
@@ -76,9 +77,13 @@ namespace Sen.Script.Executor.Methods.PvZ2.Custom.SCG.Encode {
                 if (argument.generic! == 1n) {
                     load_boolean(argument, "animation_split_label", this.configuration, Kernel.Language.get("pvz2.custom.scg.animation_split_label"));
                 }
+                if (argument.generic! != 2n) {
+                    load_boolean(argument, "high_quality_resize", this.configuration, Kernel.Language.get("pvz2.custom.scg.high_quality_resize"));
+                }
                 const setting: Script.Support.Miscellaneous.Custom.StreamCompressedGroup.Configuration.Setting = {
                     decode_method: argument.generic!,
                     animation_split_label: argument.animation_split_label! ?? false,
+                    resize_method: argument.high_quality_resize! ? 1n : 0n,
                 };
                 clock.start_safe();
                 Kernel.Support.Miscellaneous.Custom.StreamCompressedGroup.encode_fs(argument.source, argument.destination!, setting);
@@ -436,6 +436,13 @@ declare namespace Sen {
             export function now(): number {
                 return performance.now(); // Use performance.now() for high-resolution timestamps
             }
+
+            /**
+             * Gets the worker count a kernel thread pool uses by default.
+             *
+             * @returns: The hardware concurrency, at least 1.
+             */
+            export function hardware_concurrency(): bigint;
         }
 
         /**
@@ -762,6 +769,77 @@ declare namespace Sen {
             export function evaluate_fs<T>(source: string): T;
         }
 
+        /**
+         * JavaScript Kernel interactive : Runtime
+         * Heap limits and statistics of the runtime running the script
+         */
+
+        declare namespace Runtime {
+            /**
+             * Heap statistics, sizes are in bytes
+             */
+
+            export interface MemoryUsage {
+                malloc_size: bigint;
+                malloc_limit: bigint;
+                memory_used_size: bigint;
+                malloc_count: bigint;
+                memory_used_count: bigint;
+                atom_count: bigint;
+                atom_size: bigint;
+                str_count: bigint;
+                str_size: bigint;
+                obj_count: bigint;
+                obj_size: bigint;
+                prop_count: bigint;
+                prop_size: bigint;
+                shape_count: bigint;
+                shape_size: bigint;
+                js_func_count: bigint;
+                js_func_size: bigint;
+                js_func_code_size: bigint;
+                js_func_pc2line_count: bigint;
+                js_func_pc2line_size: bigint;
+                c_func_count: bigint;
+                array_count: bigint;
+                fast_array_count: bigint;
+                fast_array_elements: bigint;
+                binary_object_count: bigint;
+                binary_object_size: bigint;
+            }
+
+            /**
+             * An allocation past the limit throws an out of memory error in the script.
+             *
+             * @param limit The limit in bytes, 0 is unlimited.
+             */
+            export function set_memory_limit(limit: bigint): void;
+
+            /**
+             * The collector runs once this many bytes are allocated since the last collection.
+             *
+             * @param threshold The threshold in bytes.
+             */
+            export function set_gc_threshold(threshold: bigint): void;
+
+            /**
+             * Must stay below the stack of the thread running the script.
+             *
+             * @param size The stack size in bytes, 0 disables the check.
+             */
+            export function set_max_stack_size(size: bigint): void;
+
+            /**
+             * Runs the collector now.
+             */
+            export function gc(): void;
+
+            /**
+             * @returns The heap statistics of the runtime.
+             */
+            export function memory_usage(): MemoryUsage;
+        }
+
         /**
          * JavaScript Kernel interactive : Encryption
          */
@@ -932,6 +1010,23 @@ declare namespace Sen {
                 export function hash_fs(source: string): string;
             }
 
+            /**
+             * JavaScript batch file hashing
+             */
+            declare namespace Hash {
+                export type Algorithm = "md5" | "sha224" | "sha256" | "sha384" | "sha512" | "fnv";
+
+                /**
+                 * Hashes many files on a bounded thread pool, files are streamed in fixed-size chunks.
+                 *
+                 * @param source The paths of the files to hash.
+                 * @param algorithm The hash algorithm, FNV is returned as 8 hex digits.
+                 * @param thread The worker count, clamped to the hardware concurrency.
+                 * @returns The hashes in the same order as source.
+                 */
+                export function hash_many_fs(source: Array<string>, algorithm: Algorithm, thread: bigint): Array<string>;
+            }
+
             /**
              * JavaScript XOR Hashing methods
              */
@@ -1019,6 +1114,28 @@ declare namespace Sen {
                  * --------------------------------------------------
                  */
                 export function decode_fs_as_multiple_threads<source extends string, destination extends string>(argument: Array<[source, destination]>): void;
+
+                /**
+                 * --------------------------------------------------
+                 * JavaScript Base64 encoding method for many files on a bounded thread pool, source[i] is written to destination[i]
+                 * @param source - Source file paths
+                 * @param destination - Destination file paths
+                 * @param thread - Worker count, clamped to the hardware concurrency
+                 * @returns: (void) - This function doesn't return a value, it modifies the destination files
+                 * --------------------------------------------------
+                 */
+                export function encode_many_fs(source: Array<string>, destination: Array<string>, thread: bigint): void;
+
+                /**
+                 * --------------------------------------------------
+                 * JavaScript Base64 decoding method for many files on a bounded thread pool, source[i] is written to destination[i]
+                 * @param source - Source file paths
+                 * @param destination - Destination file paths
+                 * @param thread - Worker count, clamped to the hardware concurrency
+                 * @returns: (void) - This function doesn't return a value, it modifies the destination files
+                 * --------------------------------------------------
+                 */
+                export function decode_many_fs(source: Array<string>, destination: Array<string>, thread: bigint): void;
             }
         }
 
@@ -1479,6 +1596,25 @@ declare namespace Sen {
                     export function encode_fs_as_multiple_threads(...params: Array<[string, string]>): void;
                 }
 
+                /**
+                 * LawnStrings Support
+                 *
+                 * This namespace provides the conversion between the LawnStrings text and the LawnStringsData JSON.
+                 */
+
+                declare namespace LawnStrings {
+                    /**
+                     * Converts a LawnStrings file.
+                     *
+                     * @param source {string} Path to the source file.
+                     * @param destination {string} Path to the destination file.
+                     * @param source_type {string} One of "text", "cn-text", "array" or "map".
+                     * @param destination_type {string} One of "text", "cn-text", "array" or "map", must differ from source_type.
+                     * @returns {void}
+                     */
+                    export function convert_fs(source: string, destination: string, source_type: string, destination_type: string): void;
+                }
+
                 /**
                  * Zlib Support
                  *
@@ -2169,6 +2305,66 @@ declare namespace Sen {
                     export function pack_resource(source: string, destination: string): void;
                     export function unpack_cipher(source: string, destination: string): void;
 
+                    /**
+                     * Lists the resources of an RSB bundle without unpacking it.
+                     *
+                     * @param source {string} Path to the source RSB bundle file.
+                     * @returns {Array<string>} Every resource path in the bundle.
+                     */
+                    export function list_resource(source: string): Array<string>;
+
+                    /**
+                     * Reads one resource out of an RSB bundle.
+                     *
+                     * Only the packet section holding the resource is read or inflated,
+                     * use extract_resource_list to read many resources of one bundle.
+                     *
+                     * @param source {string} Path to the source RSB bundle file.
+                     * @param path {string} Resource path inside the bundle, case-insensitive.
+                     * @returns {ArrayBuffer} The resource data.
+                     */
+                    export function extract_resource(source: string, path: string): ArrayBuffer;
+
+                    /**
+                     * Reads several resources out of an RSB bundle.
+                     *
+                     * The bundle is indexed once and each compressed section is inflated once.
+                     *
+                     * @param source {string} Path to the source RSB bundle file.
+                     * @param resource {Array<string>} Resource paths inside the bundle, case-insensitive.
+                     * @returns {Array<ArrayBuffer>} The data of each resource, in the given order.
+                     */
+                    export function extract_resource_list(source: string, resource: Array<string>): Array<ArrayBuffer>;
+
+                    /**
+                     * Extracts the given resources of an RSB bundle.
+                     *
+                     * @param source {string} Path to the source RSB bundle file.
+                     * @param resource {Array<string>} Resource paths inside the bundle.
+                     * @param destination {string} Each resource is written to destination/path.
+                     * @returns {void}
+                     */
+                    export function extract_resource_fs(source: string, resource: Array<string>, destination: string): void;
+
+                    /**
+                     * Scrambles the subgroup, pool and packet headers of an RSB bundle.
+                     *
+                     * @param source {string} Path to the source RSB bundle file.
+                     * @param destination {string} Path to the obfuscated RSB bundle file.
+                     * @returns {{ version: bigint; modify_count: bigint }} The version byte written and the number of subgroups modified.
+                     */
+                    export function obfuscate_fs(source: string, destination: string): { version: bigint; modify_count: bigint };
+
+                    /**
+                     * Converts an Android RSB bundle to the iOS texture layout.
+                     *
+                     * @param source {string} Path to the source RSB bundle file.
+                     * @param destination {string} Path to the converted RSB bundle file.
+                     * @param resolution {string} high_quality_resolution or low_quality_resolution.
+                     * @returns {void}
+                     */
+                    export function convert_android_to_ios_fs(source: string, destination: string, resolution: string): void;
+
                     /**
                      * Unpacks an RSB bundle file and returns the manifest for modding purposes.
                      *
@@ -2417,6 +2613,17 @@ declare namespace Sen {
                      */
                     export function decode_fs(source: string, destination: string, platform: Platform): void;
 
+                    /**
+                     * Decodes many files on a bounded thread pool, source[i] is written to destination[i].
+                     *
+                     * @param {Array<string>} source - The paths of the compiled reanims.
+                     * @param {Array<string>} destination - The paths of the decoded files.
+                     * @param {Platform} platform - The platform of every source.
+                     * @param {bigint} thread - The worker count, clamped to the hardware concurrency.
+                     * @returns {void}
+                     */
+                    export function decode_many_fs(source: Array<string>, destination: Array<string>, platform: Platform, thread: bigint): void;
+
                     /**
                      * Encodes a directory and its contents into a file system archive at the destination path,
                      * targeting a specific platform.
@@ -2854,6 +3061,17 @@ declare namespace Sen {
                      */
                     export function decode_fs(source: string, destination: string): void;
 
+                    /**
+                     * JavaScript function to index a WWise sound bank file
+                     *
+                     * Reads only the bank header and the media table, the hierarchy is not decoded.
+                     *
+                     * @param {string} source - Path to the source WWise sound bank file.
+                     * @param {string} destination - Path to the destination JSON file, media offsets are absolute in the bank.
+                     * @returns {void} - Doesn't return any data, writes the index at the specified destination.
+                     */
+                    export function decode_index_fs(source: string, destination: string): void;
+
                     /**
                      * JavaScript function to encode a sound bank file into WWise format
                      *
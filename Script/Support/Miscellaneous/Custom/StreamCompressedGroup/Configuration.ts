@@ -8,5 +8,12 @@ namespace Sen.Script.Support.Miscellaneous.Custom.StreamCompressedGroup.Configur
     export interface Setting extends Record<string, unknown> {
         decode_method: bigint;
         animation_split_label: boolean;
+        resize_method?: ResizeMethod;
     }
+
+    // -----------------------------------------------------
+
+    // 0n: nearest neighbour, 1n: avir
+
+    export type ResizeMethod = 0n | 1n;
 }
@@ -291,44 +291,7 @@ namespace Sen.Script.Support.PopCap.LawnStrings.Convert {
      */
 
     export function process_fs(source: string, destination: string, source_type: Conversion, destination_type: Conversion): void {
-        let source_data: string | JsonArray | JsonMap = undefined!;
-        switch (source_type) {
-            case "text": {
-                source_data = Kernel.FileSystem.read_file_encode_with_utf16le(source);
-                break;
-            }
-            case "cn-text": {
-                source_data = Kernel.FileSystem.read_file(source);
-                break;
-            }
-            case "array":
-            case "map": {
-                source_data = Kernel.JSON.deserialize_fs(source);
-                break;
-            }
-            default: {
-                throw new Error(format(Kernel.Language.get("popcap.lawnstrings.convert.unsupported_type"), source_type));
-            }
-        }
-        const destination_data: string | JsonMap | JsonArray = process(source_data, source_type, destination_type);
-        switch (destination_type) {
-            case "text": {
-                Kernel.FileSystem.write_file_encode_with_utf16le(destination, destination_data as string);
-                break;
-            }
-            case "cn-text": {
-                Kernel.FileSystem.write_file(destination, destination_data as string);
-                break;
-            }
-            case "map":
-            case "array": {
-                Kernel.JSON.serialize_fs(destination, destination_data, 1, false);
-                break;
-            }
-            default: {
-                throw new Error(format(Kernel.Language.get("popcap.lawnstrings.convert.unsupported_type"), source_type));
-            }
-        }
+        Kernel.Support.PopCap.LawnStrings.convert_fs(source, destination, source_type, destination_type);
         return;
     }
 }
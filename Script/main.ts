@@ -302,6 +302,7 @@ namespace Sen.Script {
             Module.load();
             Console.send(`Sen ~ Shell: ${Shell.version()} & Kernel: ${Kernel.version()} & Script: ${version} ~ ${Kernel.OperatingSystem.current()} & ${Kernel.OperatingSystem.architecture()}`);
             Setting.load();
+            Runtime.load(args);
             Console.finished(Kernel.Language.get("current_status"), format(Kernel.Language.get("js.environment_has_been_loaded"), 1n, 1n, Module.script_list.length + 1));
             Executor.forward({ source: args });
         } catch (e: any) {
@@ -310,6 +311,32 @@ namespace Sen.Script {
         return result;
     }
 
+    /**
+     * Runtime options given by the command line, removed before the arguments are forwarded
+     * -memory_limit, -gc_threshold, -stack_size: size in bytes
+     */
+
+    export namespace Runtime {
+        export const option: Map<string, (size: bigint) => void> = new Map([
+            ["-memory_limit", Kernel.Runtime.set_memory_limit],
+            ["-gc_threshold", Kernel.Runtime.set_gc_threshold],
+            ["-stack_size", Kernel.Runtime.set_max_stack_size],
+        ]);
+
+        export function load(args: Array<string>): void {
+            for (let i = 0; i < args.length; ) {
+                const setter = option.get(args[i]);
+                if (setter === undefined || i + 1 === args.length) {
+                    ++i;
+                    continue;
+                }
+                setter(BigInt(args[i + 1].replace(/n$/, "")));
+                args.splice(i, 2);
+            }
+            return;
+        }
+    }
+
     /**
      * JavaScript Modules
      */
@@ -357,6 +384,7 @@ namespace Sen.Script {
             "~/Support/Wwise/Media/Decode.js",
             "~/Support/Wwise/Media/Encode.js",
             "~/Executor/Executor.js",
+            "~/Executor/Host.js",
             "~/Executor/Methods/js.evaluate.js",
             "~/Executor/Methods/data.md5.hash.js",
             "~/Executor/Methods/data.base64.encode.js",
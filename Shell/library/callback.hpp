@@ -2,6 +2,7 @@
 
 #include "library/macro.hpp"
 #include "library/dialog.hpp"
+#include "library/host.hpp"
 
 namespace Sen::Shell {
 	
@@ -93,6 +94,11 @@ namespace Sen::Shell {
 			delete[] copy;
 			copy = nullptr;
 			assert_conditional(result.size() >= 2, "argument must be greater than 2");
+			// the standard output of a worker belongs to its job stream
+			if (Host::Worker::is_running()) {
+				Host::Worker::report(result[1], result.size() >= 3 ? result[2] : std::string{}, result.size() >= 4 ? result[3] : std::string{});
+				return;
+			}
 			switch (result.size()) {
 				case 2: {
 					Console::print(result[1]);
@@ -112,6 +118,8 @@ namespace Sen::Shell {
 		if (result[0] == "input") {
 			delete[] copy;
 			copy = nullptr;
+			// nobody is at the console while a hosted job runs
+			assert_conditional(!Host::Worker::is_running(), "input is not available while a host job is running");
 			auto c = Console::input();
 			copy = new char[c.size() + 1];
 			std::memcpy(copy, c.data(), c.size());
@@ -166,6 +174,60 @@ namespace Sen::Shell {
 			svr.listen(result[3], std::stoi(result[4]));
 			return;
 		}
+		if (result[0] == "host_listen") {
+			delete[] copy;
+			copy = nullptr;
+			assert_conditional(result.size() >= 5, "argument must be greater than 5");
+			assert_conditional(Host::server == nullptr, "host is already listening");
+			Host::server = std::make_unique<Host::JobServer>();
+			auto token = Host::server->listen(result[1], std::stoi(result[2]), static_cast<std::size_t>(std::stoull(result[3])), result[4]);
+			if (!token.has_value()) {
+				Host::server = nullptr;
+				destination->value = "";
+				destination->size = 0;
+				return;
+			}
+			// the token every request must carry, empty if the server cannot be bound
+			copy = new char[token->size() + 1];
+			std::memcpy(copy, token->data(), token->size());
+			copy[token->size()] = '\0';
+			destination->size = token->size();
+			destination->value = copy;
+			return;
+		}
+		if (result[0] == "host_wait") {
+			delete[] copy;
+			copy = nullptr;
+			assert_conditional(Host::server != nullptr, "host is not listening");
+			Host::server->wait();
+			Host::server = nullptr;
+			return;
+		}
+		if (result[0] == "host_receive") {
+			delete[] copy;
+			copy = nullptr;
+			auto job = Host::Worker::receive();
+			if (!job.has_value()) {
+				destination->value = "";
+				destination->size = 0;
+				return;
+			}
+			// id and description are separated by the first line break
+			auto c = std::format("{}\n{}", job->first, job->second);
+			copy = new char[c.size() + 1];
+			std::memcpy(copy, c.data(), c.size());
+			copy[c.size()] = '\0';
+			destination->size = c.size();
+			destination->value = copy;
+			return;
+		}
+		if (result[0] == "host_finish") {
+			delete[] copy;
+			copy = nullptr;
+			assert_conditional(result.size() >= 4, "argument must be greater than 4");
+			Host::Worker::finish(static_cast<std::size_t>(std::stoull(result[1])), result[2], result[3]);
+			return;
+		}
 		if (result[0] == "pick_file") {
 			delete[] copy;
 			copy = nullptr;
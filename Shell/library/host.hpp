@@ -0,0 +1,844 @@
+#pragma once
+
+#include "library/macro.hpp"
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <memory>
+#include <optional>
+#include <format>
+#include <chrono>
+#include <random>
+
+#if !WINDOWS
+#include <spawn.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+
+extern char** environ;
+#endif
+
+namespace Sen::Shell::Host {
+
+	/**
+	 * A job posted to the host, it runs on a worker: a Shell child that has already loaded the environment
+	 * A worker runs exactly one job on its own runtime and is replaced after, so no job sees the globals of another
+	 * Every line the script displays while the job runs is streamed back as ndjson,
+	 * the last line carries the result of the job
+	 */
+
+	struct Job {
+		std::size_t id;
+		std::string description;
+		std::deque<std::string> line{};
+		bool is_finished{ false };
+	};
+
+	inline static auto escape(
+		const std::string& that
+	) -> std::string
+	{
+		auto destination = std::string{};
+		destination.reserve(that.size() + 2);
+		destination += '"';
+		for (auto c : that) {
+			switch (c) {
+				case '"': {
+					destination += "\\\"";
+					break;
+				}
+				case '\\': {
+					destination += "\\\\";
+					break;
+				}
+				case '\n': {
+					destination += "\\n";
+					break;
+				}
+				case '\r': {
+					destination += "\\r";
+					break;
+				}
+				case '\t': {
+					destination += "\\t";
+					break;
+				}
+				default: {
+					if (static_cast<unsigned char>(c) < 0x20) {
+						destination += std::format("\\u{:04x}", static_cast<int>(c));
+					}
+					else {
+						destination += c;
+					}
+				}
+			}
+		}
+		destination += '"';
+		return destination;
+	}
+
+	// "unix:<path>" listens on a Unix domain socket instead of a port
+
+	inline static constexpr auto k_unix_socket_prefix = std::string_view{ "unix:" };
+
+	inline static auto is_unix_socket(
+		const std::string& address
+	) -> bool
+	{
+		return address.starts_with(k_unix_socket_prefix);
+	}
+
+	inline static auto is_loopback_name(
+		const std::string& name
+	) -> bool
+	{
+		return name == "127.0.0.1" || name == "::1" || name == "localhost";
+	}
+
+	// the job endpoint can run any script, it must never be reachable from another machine
+
+	inline static auto is_loopback(
+		const std::string& address
+	) -> bool
+	{
+		#if WINDOWS
+			return is_loopback_name(address);
+		#else
+			return is_loopback_name(address) || (is_unix_socket(address) && address.size() > k_unix_socket_prefix.size());
+		#endif
+	}
+
+	// Host header without its port, a rebound domain name is not a loopback name
+
+	inline static auto is_loopback_host(
+		const std::string& host
+	) -> bool
+	{
+		if (host.starts_with("[")) {
+			auto end = host.find(']');
+			return end != std::string::npos && is_loopback_name(host.substr(1, end - 1));
+		}
+		return is_loopback_name(host.substr(0, host.find(':')));
+	}
+
+	inline static auto is_json_content_type(
+		const std::string& content_type
+	) -> bool
+	{
+		auto media_type = content_type.substr(0, content_type.find(';'));
+		while (!media_type.empty() && media_type.back() == ' ') {
+			media_type.pop_back();
+		}
+		return media_type == "application/json";
+	}
+
+	inline static auto make_token(
+	) -> std::string
+	{
+		auto device = std::random_device{};
+		auto destination = std::string{};
+		for (auto i = 0; i < 8; ++i) {
+			destination += std::format("{:08x}", static_cast<std::uint32_t>(device()));
+		}
+		return destination;
+	}
+
+	// compare every byte so the time taken does not tell how much of the token was right
+
+	inline static auto is_same_token(
+		const std::string& that,
+		const std::string& token
+	) -> bool
+	{
+		if (that.size() != token.size()) {
+			return false;
+		}
+		auto difference = 0;
+		for (auto i = std::size_t{ 0 }; i < token.size(); ++i) {
+			difference |= that[i] ^ token[i];
+		}
+		return difference == 0;
+	}
+
+	// only the owner can read the token file
+
+	inline static auto write_token(
+		const std::string& destination,
+		const std::string& token
+	) -> bool
+	{
+		#if WINDOWS
+			auto file = std::ofstream{ std::filesystem::path{ utf8_to_utf16(destination) }, std::ios::binary | std::ios::trunc };
+			file << token;
+			return static_cast<bool>(file.flush());
+		#else
+			::unlink(destination.data());
+			auto file = ::open(destination.data(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, S_IRUSR | S_IWUSR);
+			if (file == -1) {
+				return false;
+			}
+			auto is_written = ::write(file, token.data(), token.size()) == static_cast<ssize_t>(token.size());
+			return ::close(file) == 0 && is_written;
+		#endif
+	}
+
+	inline static auto result_line(
+		std::size_t id,
+		const std::string& status,
+		const std::string& message
+	) -> std::string
+	{
+		return std::format("{{\"id\":{},\"type\":\"result\",\"status\":{},\"message\":{}}}\n", id, escape(status), escape(message));
+	}
+
+	/**
+	 * Command line used to start a worker, set by the Shell before the kernel is executed
+	 */
+
+	inline auto program = std::vector<std::string>{};
+
+	/**
+	 * A child process with its standard input and output piped to the host
+	 */
+
+	class Process {
+
+	protected:
+
+		#if WINDOWS
+			HANDLE process{ nullptr };
+			HANDLE input{ nullptr };
+			HANDLE output{ nullptr };
+		#else
+			pid_t process{ -1 };
+			int input{ -1 };
+			int output{ -1 };
+		#endif
+
+		std::string buffer{};
+
+		// handles of one child must not leak into another started at the same time
+
+		inline static auto spawn_mutex = std::mutex{};
+
+		#if WINDOWS
+			inline static auto quote(
+				const std::wstring& that
+			) -> std::wstring
+			{
+				if (!that.empty() && that.find_first_of(L" \t\n\v\"") == std::wstring::npos) {
+					return that;
+				}
+				auto destination = std::wstring{ L"\"" };
+				auto backslash = std::size_t{ 0 };
+				for (auto c : that) {
+					if (c == L'\\') {
+						++backslash;
+						continue;
+					}
+					destination.append(c == L'"' ? backslash * 2 + 1 : backslash, L'\\');
+					destination += c;
+					backslash = 0;
+				}
+				destination.append(backslash * 2, L'\\');
+				destination += L'"';
+				return destination;
+			}
+		#endif
+
+	public:
+
+		Process(
+		) = default;
+
+		Process(
+			const Process& that
+		) = delete;
+
+		auto operator=(
+			const Process& that
+		) -> Process& = delete;
+
+		~Process(
+		)
+		{
+			this->close_input();
+			this->wait();
+		}
+
+		/**
+		 * Start the program with its argument
+		 * return: nothing if the program cannot be started
+		 */
+
+		inline static auto spawn(
+			const std::vector<std::string>& argument
+		) -> std::unique_ptr<Process>
+		{
+			auto destination = std::make_unique<Process>();
+			auto lock = std::lock_guard<std::mutex>{ spawn_mutex };
+			#if WINDOWS
+				auto attribute = SECURITY_ATTRIBUTES{ .nLength = sizeof(SECURITY_ATTRIBUTES), .lpSecurityDescriptor = nullptr, .bInheritHandle = TRUE };
+				auto child_input = HANDLE{ nullptr };
+				auto child_output = HANDLE{ nullptr };
+				if (!CreatePipe(&child_input, &destination->input, &attribute, 0)) {
+					return nullptr;
+				}
+				if (!CreatePipe(&destination->output, &child_output, &attribute, 0)) {
+					CloseHandle(child_input);
+					return nullptr;
+				}
+				SetHandleInformation(destination->input, HANDLE_FLAG_INHERIT, 0);
+				SetHandleInformation(destination->output, HANDLE_FLAG_INHERIT, 0);
+				auto command = std::wstring{};
+				for (auto& e : argument) {
+					if (!command.empty()) {
+						command += L' ';
+					}
+					command += quote(utf8_to_utf16(e));
+				}
+				auto startup = STARTUPINFOW{};
+				startup.cb = sizeof(STARTUPINFOW);
+				startup.dwFlags = STARTF_USESTDHANDLES;
+				startup.hStdInput = child_input;
+				startup.hStdOutput = child_output;
+				startup.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+				auto information = PROCESS_INFORMATION{};
+				auto is_created = CreateProcessW(nullptr, command.data(), nullptr, nullptr, TRUE, 0, nullptr, nullptr, &startup, &information);
+				CloseHandle(child_input);
+				CloseHandle(child_output);
+				if (!is_created) {
+					return nullptr;
+				}
+				CloseHandle(information.hThread);
+				destination->process = information.hProcess;
+			#else
+				int child_input[2];
+				int child_output[2];
+				if (pipe(child_input) != 0) {
+					return nullptr;
+				}
+				if (pipe(child_output) != 0) {
+					close(child_input[0]);
+					close(child_input[1]);
+					return nullptr;
+				}
+				for (auto e : { child_input[0], child_input[1], child_output[0], child_output[1] }) {
+					fcntl(e, F_SETFD, FD_CLOEXEC);
+				}
+				destination->input = child_input[1];
+				destination->output = child_output[0];
+				auto action = posix_spawn_file_actions_t{};
+				posix_spawn_file_actions_init(&action);
+				posix_spawn_file_actions_adddup2(&action, child_input[0], STDIN_FILENO);
+				posix_spawn_file_actions_adddup2(&action, child_output[1], STDOUT_FILENO);
+				auto value = std::vector<char*>{};
+				for (auto& e : argument) {
+					value.emplace_back(const_cast<char*>(e.data()));
+				}
+				value.emplace_back(nullptr);
+				auto state = posix_spawn(&destination->process, value[0], &action, nullptr, value.data(), environ);
+				posix_spawn_file_actions_destroy(&action);
+				close(child_input[0]);
+				close(child_output[1]);
+				if (state != 0) {
+					destination->process = -1;
+					return nullptr;
+				}
+			#endif
+			return destination;
+		}
+
+		inline auto write(
+			const std::string& that
+		) -> bool
+		{
+			#if WINDOWS
+				auto size = DWORD{ 0 };
+				return WriteFile(this->input, that.data(), static_cast<DWORD>(that.size()), &size, nullptr) && size == that.size();
+			#else
+				auto offset = std::size_t{ 0 };
+				while (offset < that.size()) {
+					auto size = ::write(this->input, that.data() + offset, that.size() - offset);
+					if (size <= 0) {
+						return false;
+					}
+					offset += static_cast<std::size_t>(size);
+				}
+				return true;
+			#endif
+		}
+
+		// return: nothing once the child closed its output
+
+		inline auto read_line(
+		) -> std::optional<std::string>
+		{
+			while (true) {
+				auto position = this->buffer.find('\n');
+				if (position != std::string::npos) {
+					auto destination = this->buffer.substr(0, position);
+					this->buffer.erase(0, position + 1);
+					if (!destination.empty() && destination.back() == '\r') {
+						destination.pop_back();
+					}
+					return destination;
+				}
+				char chunk[0x1000];
+				#if WINDOWS
+					auto size = DWORD{ 0 };
+					if (!ReadFile(this->output, chunk, sizeof(chunk), &size, nullptr) || size == 0) {
+						return std::nullopt;
+					}
+				#else
+					auto size = ::read(this->output, chunk, sizeof(chunk));
+					if (size <= 0) {
+						return std::nullopt;
+					}
+				#endif
+				this->buffer.append(chunk, static_cast<std::size_t>(size));
+			}
+		}
+
+		inline auto close_input(
+		) -> void
+		{
+			#if WINDOWS
+				if (this->input != nullptr) {
+					CloseHandle(this->input);
+					this->input = nullptr;
+				}
+			#else
+				if (this->input != -1) {
+					close(this->input);
+					this->input = -1;
+				}
+			#endif
+			return;
+		}
+
+		inline auto wait(
+		) -> void
+		{
+			#if WINDOWS
+				if (this->output != nullptr) {
+					CloseHandle(this->output);
+					this->output = nullptr;
+				}
+				if (this->process != nullptr) {
+					WaitForSingleObject(this->process, INFINITE);
+					CloseHandle(this->process);
+					this->process = nullptr;
+				}
+			#else
+				if (this->output != -1) {
+					close(this->output);
+					this->output = -1;
+				}
+				if (this->process != -1) {
+					auto state = 0;
+					waitpid(this->process, &state, 0);
+					this->process = -1;
+				}
+			#endif
+			return;
+		}
+
+	};
+
+	class JobServer {
+
+	protected:
+
+		Server server{};
+
+		std::thread thread{};
+
+		std::vector<std::thread> worker{};
+
+		std::mutex mutex{};
+
+		std::condition_variable signal{};
+
+		std::deque<std::shared_ptr<Job>> pending{};
+
+		std::size_t running{ 0 };
+
+		std::size_t counter{ 0 };
+
+		bool is_stopped{ false };
+
+		std::string token{};
+
+		std::string socket_path{};
+
+		// the caller holds the lock
+
+		inline auto complete(
+			Job& job,
+			const std::string& status,
+			const std::string& message
+		) -> void
+		{
+			job.line.emplace_back(result_line(job.id, status, message));
+			job.is_finished = true;
+			return;
+		}
+
+		inline auto append(
+			Job& job,
+			std::string&& line
+		) -> void
+		{
+			{
+				auto lock = std::lock_guard<std::mutex>{ this->mutex };
+				job.line.emplace_back(std::move(line));
+			}
+			this->signal.notify_all();
+			return;
+		}
+
+		/**
+		 * Keep one worker warm, hand it the next job and replace it once the job is done
+		 * The worker says it is ready before anything it displays is streamed,
+		 * so the lines printed while it loads the environment are dropped
+		 */
+
+		inline auto run_worker(
+		) -> void
+		{
+			while (true) {
+				{
+					auto lock = std::lock_guard<std::mutex>{ this->mutex };
+					if (this->is_stopped) {
+						break;
+					}
+				}
+				auto process = Process::spawn(program);
+				auto is_ready = false;
+				if (process != nullptr) {
+					while (auto line = process->read_line()) {
+						if (*line == "ready") {
+							is_ready = true;
+							break;
+						}
+					}
+				}
+				auto job = std::shared_ptr<Job>{};
+				{
+					auto lock = std::unique_lock<std::mutex>{ this->mutex };
+					this->signal.wait(lock, [this]() { return !this->pending.empty() || this->is_stopped; });
+					if (this->pending.empty()) {
+						break;
+					}
+					job = this->pending.front();
+					this->pending.pop_front();
+					++this->running;
+					if (!is_ready) {
+						// a worker that cannot start fails the job instead of leaving it queued forever
+						this->complete(*job, "error", "worker cannot be started");
+						--this->running;
+					}
+				}
+				if (!is_ready) {
+					this->signal.notify_all();
+					std::this_thread::sleep_for(std::chrono::seconds(1));
+					continue;
+				}
+				// json cannot hold a raw line break outside of whitespace, so the job always fits on one line
+				auto description = job->description;
+				std::replace_if(description.begin(), description.end(), [](char c) { return c == '\n' || c == '\r'; }, ' ');
+				process->write(std::format("{}\n{}\n", job->id, description));
+				process->close_input();
+				auto is_finished = false;
+				while (auto line = process->read_line()) {
+					// whatever the worker prints after its result is not part of the job
+					if (is_finished) {
+						continue;
+					}
+					is_finished = line->starts_with(std::format("{{\"id\":{},\"type\":\"result\"", job->id));
+					line->push_back('\n');
+					this->append(*job, std::move(*line));
+				}
+				process->wait();
+				{
+					auto lock = std::lock_guard<std::mutex>{ this->mutex };
+					if (!is_finished) {
+						this->complete(*job, "error", "worker exited before the job was finished");
+					}
+					job->is_finished = true;
+					--this->running;
+				}
+				this->signal.notify_all();
+			}
+			return;
+		}
+
+		inline auto post(
+			const Request& request,
+			Response& response
+		) -> void
+		{
+			auto job = std::make_shared<Job>();
+			{
+				auto lock = std::lock_guard<std::mutex>{ this->mutex };
+				if (this->is_stopped) {
+					response.status = 503;
+					return;
+				}
+				job->id = this->counter++;
+				job->description = request.body;
+				this->pending.emplace_back(job);
+			}
+			this->signal.notify_all();
+			response.set_chunked_content_provider("application/x-ndjson", [this, job](std::size_t offset, DataSink& sink) -> bool {
+				auto line = std::deque<std::string>{};
+				auto is_finished = false;
+				{
+					auto lock = std::unique_lock<std::mutex>{ this->mutex };
+					this->signal.wait(lock, [&]() { return !job->line.empty() || job->is_finished; });
+					line.swap(job->line);
+					is_finished = job->is_finished;
+				}
+				for (auto& e : line) {
+					if (!sink.write(e.data(), e.size())) {
+						return false;
+					}
+				}
+				if (is_finished) {
+					sink.done();
+				}
+				return true;
+			});
+			return;
+		}
+
+		inline auto status(
+			const Request& request,
+			Response& response
+		) -> void
+		{
+			auto lock = std::lock_guard<std::mutex>{ this->mutex };
+			response.set_content(std::format("{{\"pending\":{},\"running\":{},\"worker\":{}}}", this->pending.size(), this->running, this->worker.size()), "application/json");
+			return;
+		}
+
+		/**
+		 * Every request must carry the token as "Authorization: Bearer <token>"
+		 * A web page can post to a loopback port without a preflight, so a request with an Origin,
+		 * a Host that is not a loopback name or a body that is not json is turned away before the token is looked at
+		 */
+
+		inline auto authorize(
+			const Request& request,
+			Response& response
+		) -> Server::HandlerResponse
+		{
+			if (request.has_header("Origin") || !is_loopback_host(request.get_header_value("Host"))) {
+				response.status = 403;
+				return Server::HandlerResponse::Handled;
+			}
+			if ((request.method == "POST" || request.has_header("Content-Type")) && !is_json_content_type(request.get_header_value("Content-Type"))) {
+				response.status = 415;
+				return Server::HandlerResponse::Handled;
+			}
+			if (!is_same_token(request.get_header_value("Authorization"), std::format("Bearer {}", this->token))) {
+				response.status = 401;
+				response.set_header("WWW-Authenticate", "Bearer");
+				return Server::HandlerResponse::Handled;
+			}
+			return Server::HandlerResponse::Unhandled;
+		}
+
+	public:
+
+		JobServer(
+		) = default;
+
+		JobServer(
+			const JobServer& that
+		) = delete;
+
+		auto operator=(
+			const JobServer& that
+		) -> JobServer& = delete;
+
+		~JobServer(
+		)
+		{
+			this->stop();
+			for (auto& e : this->worker) {
+				e.join();
+			}
+			if (this->thread.joinable()) {
+				this->thread.join();
+			}
+			if (!this->socket_path.empty()) {
+				std::filesystem::remove(this->socket_path);
+			}
+		}
+
+		/**
+		 * Bind the server on a loopback address or a Unix socket, start the workers and serve it on its own thread
+		 * POST /job: {"method": "...", "argument": {...}}, GET /status, POST /shutdown
+		 * token_file: if not empty, the token is also written there, readable by the owner only
+		 * return: the token every request must carry, nothing if the address cannot be bound
+		 */
+
+		inline auto listen(
+			const std::string& address,
+			int port,
+			std::size_t worker,
+			const std::string& token_file
+		) -> std::optional<std::string>
+		{
+			assert_conditional(is_loopback(address), "host can only listen on a loopback address or a unix socket");
+			assert_conditional(worker >= 1, "host needs at least one worker");
+			assert_conditional(!program.empty(), "worker program is not set");
+			#if !WINDOWS
+				// a worker that dies must not take the host down with it
+				::signal(SIGPIPE, SIG_IGN);
+			#endif
+			this->token = make_token();
+			if (!token_file.empty()) {
+				assert_conditional(write_token(token_file, this->token), "cannot write the host token file");
+			}
+			this->server.set_pre_routing_handler([this](const Request& request, Response& response) {
+				return this->authorize(request, response);
+			});
+			this->server.Post("/job", [this](const Request& request, Response& response) {
+				this->post(request, response);
+			});
+			this->server.Get("/status", [this](const Request& request, Response& response) {
+				this->status(request, response);
+			});
+			this->server.Post("/shutdown", [this](const Request& request, Response& response) {
+				response.set_content("{}", "application/json");
+				this->stop();
+			});
+			if (is_unix_socket(address)) {
+				#if !WINDOWS
+					auto path = address.substr(k_unix_socket_prefix.size());
+					// a socket left behind by a host that did not stop cleanly is replaced, any other file is kept
+					if (std::filesystem::is_socket(path)) {
+						std::filesystem::remove(path);
+					}
+					this->server.set_address_family(AF_UNIX);
+					// the socket is created owner only, no other thread runs yet so the umask can be swapped
+					auto mask = ::umask(S_IRWXG | S_IRWXO | S_IXUSR);
+					auto is_bound = this->server.bind_to_port(path, port);
+					::umask(mask);
+					if (!is_bound) {
+						return std::nullopt;
+					}
+					this->socket_path = path;
+				#endif
+			}
+			else if (!this->server.bind_to_port(address, port)) {
+				return std::nullopt;
+			}
+			for (auto i = std::size_t{ 0 }; i < worker; ++i) {
+				this->worker.emplace_back([this]() {
+					this->run_worker();
+				});
+			}
+			this->thread = std::thread{ [this]() {
+				this->server.listen_after_bind();
+			} };
+			return this->token;
+		}
+
+		// block until the server is stopped
+
+		inline auto wait(
+		) -> void
+		{
+			auto lock = std::unique_lock<std::mutex>{ this->mutex };
+			this->signal.wait(lock, [this]() { return this->is_stopped; });
+			return;
+		}
+
+		// jobs still queued are cancelled, the running ones are left to finish, stopping twice does nothing
+
+		inline auto stop(
+		) -> void
+		{
+			{
+				auto lock = std::lock_guard<std::mutex>{ this->mutex };
+				if (this->is_stopped) {
+					return;
+				}
+				this->is_stopped = true;
+				for (auto& e : this->pending) {
+					this->complete(*e, "cancelled", "");
+				}
+				this->pending.clear();
+			}
+			this->signal.notify_all();
+			this->server.stop();
+			return;
+		}
+
+	};
+
+	inline auto server = std::unique_ptr<JobServer>{};
+
+	/**
+	 * Inside a worker: the job comes from standard input, every displayed line and the result go to standard output
+	 */
+
+	namespace Worker {
+
+		inline auto id = std::optional<std::size_t>{};
+
+		// return: id and job description, nothing if the host closed the worker without a job
+
+		inline static auto receive(
+		) -> std::optional<std::pair<std::size_t, std::string>>
+		{
+			std::cout << "ready\n" << std::flush;
+			auto value = std::string{};
+			auto description = std::string{};
+			if (!std::getline(std::cin, value) || !std::getline(std::cin, description)) {
+				return std::nullopt;
+			}
+			id = static_cast<std::size_t>(std::stoull(value));
+			return std::make_pair(*id, description);
+		}
+
+		inline static auto is_running(
+		) -> bool
+		{
+			return id.has_value();
+		}
+
+		inline static auto report(
+			const std::string& title,
+			const std::string& message,
+			const std::string& color
+		) -> void
+		{
+			std::cout << std::format("{{\"id\":{},\"type\":\"display\",\"title\":{},\"message\":{},\"color\":{}}}\n", *id, escape(title), escape(message), escape(color)) << std::flush;
+			return;
+		}
+
+		inline static auto finish(
+			std::size_t job,
+			const std::string& status,
+			const std::string& message
+		) -> void
+		{
+			assert_conditional(id == job, "job is not running");
+			std::cout << result_line(job, status, message) << std::flush;
+			id = std::nullopt;
+			return;
+		}
+
+	}
+
+}
@@ -32,6 +32,16 @@ MAIN_FUNCTION
                     script = std::filesystem::absolute("./Script/main.js").string();
             #endif
         }
+        // a host starts its workers with the same kernel and script
+        #if WINDOWS
+            auto program = std::array<wchar_t, MAX_PATH>{};
+            GetModuleFileNameW(nullptr, program.data(), static_cast<DWORD>(program.size()));
+            Host::program = { Sen::Shell::utf16_to_utf8(std::wstring{ program.data() }), kernel, script, "-method", "host.worker" };
+        #elif LINUX
+            Host::program = { std::filesystem::read_symlink("/proc/self/exe").string(), kernel, script, "-method", "host.worker" };
+        #else
+            Host::program = { std::filesystem::absolute(argc[0]).string(), kernel, script, "-method", "host.worker" };
+        #endif
         #if WIN32
             auto hinstLib = LoadLibrary(TEXT(kernel.c_str()));
         #else